@@ -6,95 +6,98 @@
 #define __MODERN_STL_NEW_ARRAY_H__
 
 #include <mstl/global.h>
+#include <mstl/slice.h>
 #include <mstl/ops/range.h>
 #include <mstl/intrinsics.h>
 #include <mstl/basic_concepts.h>
 #include <mstl/iter/iter_concepts.h>
 
 #include <initializer_list>
+#include <type_traits>
 
 namespace mstl::collection {
+    /**
+     * @brief 按值迭代Array中的元素, 由`Array::into_iter()`创建.
+     *
+     * 迭代器不复制元素, 而是借用数组的存储, 在返回每个元素时将其从数组中移出.
+     * 因此移动迭代器(如传入适配器)只需复制两个指针, 与N无关; 但数组须在迭代器之前保持存活.
+     * 与`std::move_iterator`相同, 复制迭代器只复制指针, 副本与原迭代器共享数组的存储,
+     * 因此同一元素只应经由其中一个迭代器取得.
+     */
     template<typename T, usize N>
     class ArrayIter {
     public:
         using Item = T;
-        constexpr ArrayIter(Item* arr_data) {
-            for (usize i = 0; i < N; i++) {
-                data[i] = std::move(arr_data[i]);
-            }
-        }
-        /// impl copy
-        constexpr ArrayIter(const ArrayIter&) requires basic::CopyAble<T> = default;
-        constexpr ArrayIter& operator=(const ArrayIter& other)
-        requires basic::CopyAble<T> {
-            if (this == &other) {
-                return *this;
-            }
+        constexpr ArrayIter(Item* arr_data): start(arr_data), end(arr_data + N) {}
+
+        /// impl copy: 复制后两个迭代器共享数组的存储
+        constexpr ArrayIter(const ArrayIter&) = default;
+        constexpr ArrayIter& operator=(const ArrayIter&) = default;
 
-            for (usize pos = 0; pos < N; pos++) {
-                data[pos] = other.data[pos];
-            }
-            return *this;
-        }
-        ArrayIter(const ArrayIter&) requires (!basic::CopyAble<T>) = delete;
-        ArrayIter& operator=(const ArrayIter& other)
-        requires (!basic::CopyAble<T>) = delete;
         /// impl move
-        constexpr ArrayIter(ArrayIter&& other) noexcept {
-            if (this == &other) {
-                return ;
-            }
-            for (usize i = 0; i < N; i++) {
-                data[i] = std::move(other.data[i]);
-            }
-            range = other.range;
+        constexpr ArrayIter(ArrayIter&& other) noexcept: start(other.start), end(other.end) {
+            other.start = other.end;
         }
         constexpr ArrayIter& operator=(ArrayIter&& other) noexcept {
-            if (this == &other) {
-                return *this;
-            }
-            for (usize i = 0; i < N; i++) {
-                data[i] = std::move(other.data[i]);
-            }
-            range = other.range;
+            start = other.start;
+            end = other.end;
+            other.start = other.end;
+            return *this;
         }
-        ArrayIter(ArrayIter&& other) noexcept
-        requires (!basic::Movable<T>) = delete;
-        ArrayIter& operator=(ArrayIter&& other) noexcept
-        requires (!basic::Movable<T>) = delete;
+
         /// impl Iterator
         MSTL_INLINE constexpr
         Option<T> next() {
-            return range.next().map([&](usize pos){
-                Item item = std::move(data[pos]);
-                return item;
-            });
+            if (start == end) {
+                return Option<T>::none();
+            }
+            return Option<T>::some(std::move(*start++));
         }
         /// impl DoubleEndedIterator
         MSTL_INLINE constexpr
         Option<T> prev() {
-            return range.prev().map([&](usize pos){
-                Item item = std::move(data[pos]);
-                return item;
-            });
+            if (start == end) {
+                return Option<T>::none();
+            }
+            return Option<T>::some(std::move(*--end));
         }
         /// impl ExactSizeIterator
         MSTL_INLINE constexpr
         usize len() {
-            return N;
+            return end - start;
         }
         MSTL_INLINE constexpr
         bool is_empty() {
-            return range.is_empty();
+            return start == end;
         }
         /// impl ContinuousIterator
         MSTL_INLINE constexpr
         const T* start_addr() {
-            return &data[0];
+            return start;
+        }
+
+        /// impl InternalIterator
+        template<typename F>
+        MSTL_INLINE constexpr
+        void for_each_internal(F&& f) {
+            for (; start != end; start++) {
+                f(std::move(*start));
+            }
+        }
+
+        template<typename Acc, typename F>
+        MSTL_INLINE constexpr
+        bool try_fold(Acc& acc, F&& f) {
+            while (start != end) {
+                if (!f(acc, std::move(*start++))) {
+                    return false;
+                }
+            }
+            return true;
         }
     private:
-        Item data[N];
-        ops::Range<usize> range = {0, N};
+        T* start = nullptr;
+        T* end = nullptr;
     };
 
     template <typename T, usize N>
@@ -138,6 +141,26 @@ namespace mstl::collection {
         const T* start_addr() {
             return start;
         }
+
+        /// impl InternalIterator
+        template<typename F>
+        MSTL_INLINE constexpr
+        void for_each_internal(F&& f) {
+            for (; start != end; start++) {
+                f(*start);
+            }
+        }
+
+        template<typename Acc, typename F>
+        MSTL_INLINE constexpr
+        bool try_fold(Acc& acc, F&& f) {
+            while (start != end) {
+                if (!f(acc, *start++)) {
+                    return false;
+                }
+            }
+            return true;
+        }
     private:
         T *start = nullptr;
         T *end = nullptr;
@@ -219,11 +242,13 @@ namespace mstl::collection {
         Array(Array&& other) requires (!basic::Movable<T>) = delete;
         Array& operator=(Array&& other)
         requires (!basic::Movable<T>) = delete;
-        /// impl IntoIter
+        /// impl IntoIter: 元素在迭代时被逐个移出, 数组须在迭代器之前保持存活
         MSTL_INLINE constexpr
-        IntoIter into_iter() {
-            return IntoIter { const_cast<T*>(values) };
+        IntoIter into_iter() & {
+            return IntoIter { values };
         }
+        /// 迭代器借用数组的存储, 临时数组在迭代之前即被销毁
+        IntoIter into_iter() && = delete;
         MSTL_INLINE constexpr
         IterRef iter() const {
             return IterRef { const_cast<T*>(values) };
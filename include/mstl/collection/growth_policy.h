@@ -0,0 +1,134 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef MODERN_STL_GROWTH_POLICY_H
+#define MODERN_STL_GROWTH_POLICY_H
+
+#include <concepts>
+#include <mstl/global.h>
+
+namespace mstl::collection::concepts {
+    /**
+     * 容器的增长策略
+     * # 成员函数要求
+     * - static initial_capacity(usize elem_size)
+     *      - 返回值要求
+     *
+     *          返回值类型为 usize.
+     *
+     *      - 功能描述
+     *
+     *          返回默认构造的容器预先分配的容量. 返回0时, 默认构造的容器不分配空间.
+     *
+     * - static next_capacity(usize cap, usize required, usize elem_size)
+     *      - 返回值要求
+     *
+     *          返回值类型为 usize, 且不小于required.
+     *
+     *      - 功能描述
+     *
+     *          容量为cap的容器需要容纳required个大小为elem_size字节的元素时, 返回新的容量.
+     */
+    template<typename G>
+    concept GrowthPolicy = requires(usize n) {
+        { G::initial_capacity(n) } -> std::same_as<usize>;
+        { G::next_capacity(n, n, n) } -> std::same_as<usize>;
+    };
+}
+
+namespace mstl::collection::growth {
+
+    /**
+     * @brief 从2开始, 每次把容量翻倍. 默认构造时预先分配2个元素的空间.
+     *
+     * 重新分配的次数最少, 但平均约有25%, 最多有50%的容量未被使用.
+     */
+    struct Doubling {
+        static constexpr usize initial_capacity(usize) noexcept {
+            return 2;
+        }
+
+        static constexpr usize next_capacity(usize cap, usize required, usize) noexcept {
+            usize n = cap == 0 ? 2 : 2 * cap;
+            return n < required ? required : n;
+        }
+    };
+
+    /**
+     * @brief 从2开始, 每次把容量扩展为原来的1.5倍. 默认构造时不分配空间.
+     *
+     * 与`Doubling`相比, 重新分配的次数约多70%, 但未使用的容量最多为1/3.
+     */
+    struct OneAndHalf {
+        static constexpr usize initial_capacity(usize) noexcept {
+            return 0;
+        }
+
+        static constexpr usize next_capacity(usize cap, usize required, usize) noexcept {
+            usize n = cap == 0 ? 2 : cap + (cap + 1) / 2;
+            return n < required ? required : n;
+        }
+    };
+
+    /**
+     * @brief 按Base增长, 并在空间不小于一页时, 把空间的大小向上取整至页大小的整数倍.
+     *
+     * 大块空间通常按页映射, 取整后的容量可使用整页的空间, 而不会增加实际占用的内存.
+     *
+     * @tparam Base 基础的增长策略
+     * @tparam PAGE 页大小(字节)
+     */
+    template<concepts::GrowthPolicy Base = Doubling, usize PAGE = 4096>
+    requires ((PAGE & (PAGE - 1)) == 0)
+    struct PageRounded {
+        static constexpr usize initial_capacity(usize elem_size) noexcept {
+            return Base::initial_capacity(elem_size);
+        }
+
+        static constexpr usize next_capacity(usize cap, usize required, usize elem_size) noexcept {
+            usize n = Base::next_capacity(cap, required, elem_size);
+            usize bytes = n * elem_size;
+            if (bytes < PAGE) {
+                return n;
+            }
+            return ((bytes + PAGE - 1) & ~(PAGE - 1)) / elem_size;
+        }
+    };
+
+    /**
+     * @brief 空间小于THRESHOLD字节时每次翻倍, 之后每次增加CHUNK字节.
+     *
+     * 适用于非常大的缓冲区: 容量的增长是线性的, 未使用的空间不超过CHUNK字节, 代价是更多次的重新分配.
+     * 配合能原地扩展空间的分配器(如`MmapAllocator`)时, 每次重新分配无需复制元素.
+     *
+     * @tparam THRESHOLD 切换为线性增长的空间大小(字节)
+     * @tparam CHUNK 线性增长时每次增加的空间大小(字节)
+     */
+    template<usize THRESHOLD = 64 * 1024 * 1024, usize CHUNK = 64 * 1024 * 1024>
+    requires (CHUNK > 0)
+    struct HugeBuffer {
+        static constexpr usize initial_capacity(usize) noexcept {
+            return 0;
+        }
+
+        static constexpr usize next_capacity(usize cap, usize required, usize elem_size) noexcept {
+            if (cap * elem_size < THRESHOLD) {
+                return Doubling::next_capacity(cap, required, elem_size);
+            }
+            usize want = cap * elem_size + CHUNK;
+            if (want < required * elem_size) {
+                want = required * elem_size;
+            }
+            usize bytes = (want + CHUNK - 1) / CHUNK * CHUNK;
+            return bytes / elem_size;
+        }
+    };
+
+    static_assert(concepts::GrowthPolicy<Doubling>);
+    static_assert(concepts::GrowthPolicy<OneAndHalf>);
+    static_assert(concepts::GrowthPolicy<PageRounded<>>);
+    static_assert(concepts::GrowthPolicy<HugeBuffer<>>);
+}
+
+#endif //MODERN_STL_GROWTH_POLICY_H
@@ -124,6 +124,37 @@ namespace mstl::collection {
                 return Option<T&>::none();
             }
         }
+
+        /// impl ChunkedIterator: 沿节点成批取得元素的引用, 不为每个元素构造Option
+        template<usize N>
+        constexpr iter::IterChunk<Item, N> next_chunk() {
+            iter::IterChunk<Item, N> chunk;
+            while (start != end && !chunk.is_full()) {
+                chunk.push(*start->data);
+                start = start->next;
+            }
+            return chunk;
+        }
+
+        /// impl InternalIterator
+        template<typename F>
+        constexpr void for_each_internal(F&& f) {
+            for (; start != end; start = start->next) {
+                f(*start->data);
+            }
+        }
+
+        template<typename Acc, typename F>
+        constexpr bool try_fold(Acc& acc, F&& f) {
+            while (start != end) {
+                T& item = *start->data;
+                start = start->next;
+                if (!f(acc, item)) {
+                    return false;
+                }
+            }
+            return true;
+        }
     };
 
     /**
@@ -300,35 +331,22 @@ namespace mstl::collection {
             return utility::make_pair(res, p);
         }
 
+        // 节点与其数据在同一次分配中的布局: [Node | padding | T]
         template<typename T, concepts::ForwardNode Node>
-        struct NodeAllocHelper {
-            Node* next;
-            T* data;
-            T _d;
-
-        public:
-            NodeAllocHelper() = delete;
-        };
-
-        template<typename T, concepts::Node Node>
-        struct NodeAllocHelper<T, Node> {
-            Node* prev;
-            Node* next;
-            T* data;
-            T _d;
-
-        public:
-            NodeAllocHelper() = delete;
-        };
+        static constexpr auto node_with_data_layout() {
+            return memory::Layout::from_type<Node>().extend(memory::Layout::from_type<T>()).unwrap();
+        }
 
         template<typename T, concepts::ForwardNode Node>
         static constexpr memory::Layout get_layout() {
-            return memory::Layout::from_type<NodeAllocHelper<T, Node>>();
+            constexpr memory::Layout layout = node_with_data_layout<T, Node>().first().pad_to_align();
+            return layout;
         }
 
         template<typename T, concepts::ForwardNode Node>
         static constexpr usize get_offset() {
-            return (usize)(&((NodeAllocHelper<T, Node>*)0)->_d);
+            constexpr usize offset = node_with_data_layout<T, Node>().second();
+            return offset;
         }
 
         /**
@@ -2012,6 +2030,15 @@ namespace mstl::collection {
                 return Option<T>::none();
             }
         }
+
+        /// impl ExactSizeIterator
+        constexpr usize len() const {
+            return list.size();
+        }
+
+        constexpr bool is_empty() const {
+            return list.empty();
+        }
     };
 
     static_assert(mstl::iter::Iterator<ListIntoIter<int, _private::ForwardListNode<int>, memory::allocator::Allocator>>);
@@ -0,0 +1,571 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef MODERN_STL_SMALL_VECTOR_H
+#define MODERN_STL_SMALL_VECTOR_H
+
+#include <initializer_list>
+#include <algorithm>
+#include <ostream>
+#include <iterator>
+#include <cstring>
+
+#include <mstl/global.h>
+#include <mstl/iter/iterator.h>
+#include <mstl/option/option.h>
+#include <mstl/memory/memory.h>
+#include <mstl/ops/cmp.h>
+#include "vector.h"
+
+namespace mstl::collection {
+
+    template<typename T, usize N, mstl::memory::concepts::Allocator A>
+    class SmallVectorIntoIter;
+
+    /**
+     * @brief 在对象内部储存至多N个元素的Vector.
+     *
+     * 元素数量不超过N时, 元素储存于SmallVector内部的缓冲区中, 不访问分配器; 超过N时, 所有元素被移至由分配器分配的空间,
+     * 此后与`Vector`相同, 按2倍增长. `clear`将释放分配的空间, 并重新使用内部的缓冲区.
+     *
+     * 与`Vector`不同, SmallVector的移动需要逐个移动内部缓冲区中的元素, 且移动后原有的迭代器与引用均失效.
+     *
+     * @tparam T 储存的元素类型
+     * @tparam N 内部缓冲区能容纳的元素数量
+     * @tparam A 分配器类型
+     *
+     * ## Example
+     * @code
+     *      SmallVector<int, 4> vec = {1, 2, 3};
+     *      assert(vec.is_inline());
+     *      vec.push_back(4);
+     *      vec.push_back(5);           // 超过4个元素, 移至堆上
+     *      assert(!vec.is_inline());
+     * @endcode
+     */
+    template<typename T, usize N, mstl::memory::concepts::Allocator A = mstl::memory::allocator::Allocator>
+    requires (!basic::RefType<T> && N > 0)
+    class SmallVector {
+    public:
+        using Item = T;
+        using IntoIter = SmallVectorIntoIter<T, N, A>;
+        using AllocatorType = A;
+        using Iter = VectorIter<T>;
+        using ConstIter = VectorIter<const T>;
+
+        static constexpr usize INLINE_CAPACITY = N;
+
+        SmallVector() : alloc{} {}
+
+        SmallVector(const A &allocator) : alloc(allocator) {}
+
+        SmallVector(std::initializer_list<T> list, const A &allocator = A{}) : alloc(allocator) {
+            reserve(list.size());
+            for (const auto &item: list) {
+                construct_at(len++, item);
+            }
+        }
+
+        explicit SmallVector(usize count, const A &allocator = {}) : alloc(allocator) {
+            resize(count);
+        }
+
+        SmallVector(usize count, const T &val, const A &allocator = {}) : alloc(allocator) {
+            resize(count, val);
+        }
+
+        template<iter::LegacyInputIterator InputIt>
+        SmallVector(InputIt first, InputIt last, const A &allocator = A{}) : alloc(allocator) {
+            reserve(std::abs(std::distance(first, last)));
+            for (; first != last; ++first) {
+                construct_at(len++, *first);
+            }
+        }
+
+        SmallVector(const SmallVector &r) : alloc(r.alloc) {
+            copy_impl(r);
+        }
+
+        SmallVector(SmallVector &&r) noexcept : alloc(r.alloc) {
+            move_impl(std::move(r));
+        }
+
+        ~SmallVector() {
+            clear();
+        }
+
+        SmallVector &operator=(const SmallVector &r) {
+            if (&r != this) {
+                clear();
+                alloc = r.alloc;
+                copy_impl(r);
+            }
+            return *this;
+        }
+
+        SmallVector &operator=(SmallVector &&r) noexcept {
+            if (&r != this) {
+                clear();
+                alloc = std::move(r.alloc);
+                move_impl(std::move(r));
+            }
+            return *this;
+        }
+
+        SmallVector &operator=(std::initializer_list<T> list) {
+            destroy_all();
+            reserve(list.size());
+            for (const auto &item: list) {
+                construct_at(len++, item);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief 获取位于pos的元素.
+         * @note 在DEBUG模式下, 该函数进行越界检查: 当下标越界, 则引发panic.
+         */
+        T &operator[](usize pos) {
+            MSTL_DEBUG_ASSERT(pos < len, "Out of range.");
+            return beginPtr[pos];
+        }
+
+        const T &operator[](usize pos) const {
+            MSTL_DEBUG_ASSERT(pos < len, "Out of range.");
+            return beginPtr[pos];
+        }
+
+        AllocatorType get_allocator() const noexcept {
+            return alloc;
+        }
+
+    public:
+        /**
+         * @brief 安全地取出SmallVector中储存的元素.
+         * @return 返回第pos个元素的引用的Option.
+         */
+        Option<T &> at(usize pos) {
+            if (pos < len) {
+                return Option<T &>::some(beginPtr[pos]);
+            } else {
+                return Option<T &>::none();
+            }
+        }
+
+        Option<const T &> at(usize pos) const {
+            if (pos < len) {
+                return Option<const T &>::some(beginPtr[pos]);
+            } else {
+                return Option<const T &>::none();
+            }
+        }
+
+        T &at_unchecked(usize pos) {
+            return beginPtr[pos];
+        }
+
+        const T &at_unchecked(usize pos) const {
+            return beginPtr[pos];
+        }
+
+        Option<T &> front() {
+            return at(0);
+        }
+
+        Option<const T &> front() const {
+            return at(0);
+        }
+
+        Option<T &> back() {
+            return len != 0 ? at(len - 1) : Option<T &>::none();
+        }
+
+        Option<const T &> back() const {
+            return len != 0 ? at(len - 1) : Option<const T &>::none();
+        }
+
+        T &back_unchecked() {
+            return beginPtr[len - 1];
+        }
+
+        const T &back_unchecked() const {
+            return beginPtr[len - 1];
+        }
+
+        T *data() noexcept {
+            return beginPtr;
+        }
+
+        const T *data() const noexcept {
+            return beginPtr;
+        }
+
+    public:
+        /**
+         * @brief 把SmallVector转换为迭代器.
+         *
+         * 该迭代器将接管SmallVector中的所有元素的所有权.
+         *
+         * @attention 调用该函数后, SmallVector将被消耗(或视为已被移动).
+         */
+        IntoIter into_iter() {
+            return IntoIter{std::move(*this)};
+        }
+
+        Iter iter() {
+            return Iter{beginPtr, beginPtr + len};
+        }
+
+        ConstIter citer() const {
+            return ConstIter{beginPtr, beginPtr + len};
+        }
+
+        Iter begin() {
+            return Iter{beginPtr, beginPtr + len, beginPtr};
+        }
+
+        Iter end() {
+            return Iter{beginPtr, beginPtr + len, beginPtr + len};
+        }
+
+        ConstIter cbegin() const {
+            return ConstIter{beginPtr, beginPtr + len, beginPtr};
+        }
+
+        ConstIter cend() const {
+            return ConstIter{beginPtr, beginPtr + len, beginPtr + len};
+        }
+
+        ConstIter begin() const {
+            return cbegin();
+        }
+
+        ConstIter end() const {
+            return cend();
+        }
+
+        /**
+         * @brief 从一个MSTL风格的迭代器构建一个SmallVector.
+         * 它一般由collect()函数调用. 按迭代器的size_hint预留空间.
+         * @attention 迭代左值引用的迭代器将生成其所迭代的元素的副本, 而迭代右值引用的迭代器将使得其迭代元素被移入新SmallVector.
+         */
+        template<iter::Iterator Iter>
+        static SmallVector from_iter(Iter iter) {
+            SmallVector v;
+            v.reserve(iter::size_hint(iter).lower);
+            iter::for_each_internal(iter, [&](typename Iter::Item item) {
+                v.emplace_back(std::forward<typename Iter::Item>(item));
+            });
+            return v;
+        }
+
+    public:
+        bool empty() const {
+            return len == 0;
+        }
+
+        usize size() const {
+            return len;
+        }
+
+        usize capacity() const {
+            return cap;
+        }
+
+        /**
+         * @brief 检查元素是否储存于内部的缓冲区中.
+         */
+        bool is_inline() const noexcept {
+            return beginPtr == inline_ptr();
+        }
+
+        /**
+         * @brief 预留空间. 若newCap不超过当前容量, 则什么也不做.
+         */
+        void reserve(usize newCap) {
+            if (newCap > cap) {
+                reallocate(newCap);
+            }
+        }
+
+        /**
+         * @brief 销毁所有元素, 释放分配的空间, 并重新使用内部的缓冲区.
+         */
+        void clear() {
+            destroy_all();
+            deallocate();
+        }
+
+    public:
+        void push_back(const T &v) {
+            emplace_back(v);
+        }
+
+        void push_back(T &&v) {
+            emplace_back(std::move(v));
+        }
+
+        template<typename ...Args>
+        T &emplace_back(Args &&... args) {
+            if (len == cap) [[unlikely]] {
+                reallocate(2 * cap);
+            }
+            construct_at(len, std::forward<Args>(args)...);
+            return beginPtr[len++];
+        }
+
+        void pop_back() noexcept {
+            destroy_at(--len);
+        }
+
+        /**
+         * @brief 在pos所指向的位置构造一个元素.
+         */
+        template<typename ...Args>
+        Iter emplace(ConstIter pos, Args &&... args) {
+            usize p = pos.pos();
+            // 参数可能引用本容器中的元素, 须在扩容和移动元素之前构造
+            T tmp(std::forward<Args>(args)...);
+            if (len == cap) {
+                reallocate(2 * cap);
+            }
+            if constexpr (RELOCATABLE) {
+                relocate(beginPtr + p + 1, beginPtr + p, len - p);
+            } else {
+                for (usize hi = len; hi > p; hi--) {
+                    construct_at(hi, std::move(beginPtr[hi - 1]));
+                    destroy_at(hi - 1);
+                }
+            }
+            construct_at(p, std::move(tmp));
+            len++;
+            return begin() + p;
+        }
+
+        Iter insert(ConstIter pos, const T &val) {
+            return emplace(pos, val);
+        }
+
+        Iter insert(ConstIter pos, T &&val) {
+            return emplace(pos, std::move(val));
+        }
+
+        /**
+         * @brief 擦除pos所指向的元素.
+         * @return 指向被擦除的元素的下一个元素的迭代器.
+         */
+        Iter erase(ConstIter pos) {
+            usize p = pos.pos();
+            if constexpr (RELOCATABLE) {
+                destroy_at(p);
+                relocate(beginPtr + p, beginPtr + p + 1, len - p - 1);
+                len--;
+            } else {
+                std::move(beginPtr + p + 1, beginPtr + len, beginPtr + p);
+                pop_back();
+            }
+            return begin() + p;
+        }
+
+        void resize(usize count) {
+            while (count < len) {
+                pop_back();
+            }
+            reserve(count);
+            while (len < count) {
+                construct_at(len++);
+            }
+        }
+
+        void resize(usize count, const T &r) {
+            while (count < len) {
+                pop_back();
+            }
+            reserve(count);
+            while (len < count) {
+                construct_at(len++, r);
+            }
+        }
+
+    private:
+        // 元素可平凡重定位时, 以memcpy/memmove移动元素
+        static constexpr bool RELOCATABLE = memory::concepts::TriviallyRelocatable<T>;
+
+        usize len = 0;
+        usize cap = N;
+        T *beginPtr = inline_ptr();
+        A alloc;
+        alignas(T) u8 buf[N * sizeof(T)];
+
+    private:
+        T *inline_ptr() noexcept {
+            return reinterpret_cast<T *>(buf);
+        }
+
+        const T *inline_ptr() const noexcept {
+            return reinterpret_cast<const T *>(buf);
+        }
+
+        template<typename ...Args>
+        void construct_at(usize pos, Args &&...args) {
+            std::construct_at(beginPtr + pos, std::forward<Args>(args)...);
+        }
+
+        void destroy_at(usize pos) {
+            std::destroy_at(beginPtr + pos);
+        }
+
+        void destroy_all() {
+            std::destroy(beginPtr, beginPtr + len);
+            len = 0;
+        }
+
+        // 释放分配的空间(不析构元素), 并重新使用内部的缓冲区
+        void deallocate() noexcept {
+            if (!is_inline()) {
+                alloc.deallocate(beginPtr, memory::Layout::from_type<T>(), cap);
+                beginPtr = inline_ptr();
+                cap = N;
+            }
+        }
+
+        // 把所有元素移至能容纳至少size个元素的堆空间
+        void reallocate(usize size) {
+            if constexpr (memory::concepts::Reallocator<A> && RELOCATABLE) {
+                if (!is_inline()) {
+                    auto block = memory::grow_at_least(alloc, beginPtr, memory::Layout::from_type<T>(), cap, size);
+                    if (block.ptr != nullptr) {
+                        beginPtr = (T *) block.ptr;
+                        cap = block.length;
+                        return;
+                    }
+                }
+            }
+
+            auto block = memory::allocate_at_least(alloc, memory::Layout::from_type<T>(), size);
+            auto nArr = (T *) block.ptr;
+            transfer(nArr, beginPtr, len);
+            usize oLen = len;
+            len = 0;
+            deallocate();
+            len = oLen;
+            beginPtr = nArr;
+            cap = block.length;
+        }
+
+        // 把n个元素从src移动到不重叠的dst, 并析构src中的元素
+        static void transfer(T *dst, T *src, usize n) {
+            if constexpr (RELOCATABLE) {
+                relocate(dst, src, n);
+            } else {
+                for (usize i = 0; i < n; i++) {
+                    std::construct_at(dst + i, std::move(src[i]));
+                    std::destroy_at(src + i);
+                }
+            }
+        }
+
+        // 把n个元素从src按字节移动到dst, 两者可以重叠. 要求T可平凡重定位, src中的元素之后不应被析构
+        static void relocate(T *dst, const T *src, usize n) noexcept {
+            if (n != 0) {
+                std::memmove(static_cast<void *>(dst), static_cast<const void *>(src), n * sizeof(T));
+            }
+        }
+
+        void copy_impl(const SmallVector &r) {
+            reserve(r.len);
+            for (usize i = 0; i < r.len; i++) {
+                construct_at(i, r.beginPtr[i]);
+            }
+            len = r.len;
+        }
+
+        // 要求this为空且使用内部的缓冲区
+        void move_impl(SmallVector &&r) noexcept {
+            if (r.is_inline()) {
+                transfer(beginPtr, r.beginPtr, r.len);
+            } else {
+                beginPtr = r.beginPtr;
+                cap = r.cap;
+                r.beginPtr = r.inline_ptr();
+                r.cap = N;
+            }
+            len = r.len;
+            r.len = 0;
+        }
+    };
+
+    template<typename T, usize N, mstl::memory::concepts::Allocator A>
+    class SmallVectorIntoIter {
+    public:
+        using Item = T;
+        using VecType = SmallVector<T, N, A>;
+
+        explicit SmallVectorIntoIter(VecType &&v) : vec{std::move(v)} {}
+        SmallVectorIntoIter(const SmallVectorIntoIter &) = delete;
+        SmallVectorIntoIter(SmallVectorIntoIter &&v) noexcept : vec{std::move(v.vec)}, pos(v.pos) {
+            v.pos = 0;
+        }
+
+    public:
+        Option<Item> next() {
+            if (pos < vec.size()) {
+                auto n = Option<Item>::some(Item{std::move(vec[pos])});
+                pos++;
+                if (pos == vec.size()) {
+                    vec.clear();
+                    pos = 0;
+                }
+                return n;
+            } else {
+                return Option<Item>::none();
+            }
+        }
+
+        /// impl ExactSizeIterator
+        usize len() const {
+            return vec.size() - pos;
+        }
+
+        bool is_empty() const {
+            return len() == 0;
+        }
+
+    private:
+        VecType vec;
+        usize pos = 0;
+    };
+
+    template<typename T, typename U, usize N, usize M, memory::concepts::Allocator A, memory::concepts::Allocator B>
+    requires ops::Eq<T, U>
+    bool operator==(const SmallVector<T, N, A> &lhs, const SmallVector<U, M, B> &rhs) {
+        if (lhs.size() != rhs.size()) {
+            return false;
+        }
+        for (usize i = 0; i < lhs.size(); i++) {
+            if (lhs[i] != rhs[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<mstl::basic::Printable T, usize N, memory::concepts::Allocator A>
+    std::ostream &operator<<(std::ostream &os, const SmallVector<T, N, A> &vector) {
+        os << "SmallVec [";
+        for (usize i = 0; i < vector.size(); i++) {
+            os << vector[i];
+            if (i != vector.size() - 1) {
+                os << ", ";
+            }
+        }
+        os << "]";
+        return os;
+    }
+
+    static_assert(iter::IntoIterator<SmallVector<int, 4>>);
+    static_assert(iter::FromIterator<SmallVector<int, 4>, VectorIter<int>>);
+}
+
+#endif //MODERN_STL_SMALL_VECTOR_H
@@ -10,34 +10,40 @@
 #include <ostream>
 #include <compare>
 #include <iterator>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <utility>
 
 #include <mstl/global.h>
+#include <mstl/slice.h>
 #include <mstl/iter/iterator.h>
 #include <mstl/option/option.h>
 #include <mstl/memory/memory.h>
 #include <mstl/ops/cmp.h>
+#include "growth_policy.h"
 
 namespace mstl::collection {
 
     template<typename T>
     class VectorIter;
 
-    template<typename T, mstl::memory::concepts::Allocator A, bool Reversed>
+    template<typename T, mstl::memory::concepts::Allocator A, bool Reversed, concepts::GrowthPolicy G = growth::Doubling>
     class VectorIntoIter;
 
-    template<typename T, mstl::memory::concepts::Allocator A>
+    template<typename T, mstl::memory::concepts::Allocator A, concepts::GrowthPolicy G>
     requires (!basic::RefType<T>)
     class Vector;
 
     namespace _private {
-        template<typename T, mstl::memory::concepts::Allocator A>
-        VectorIntoIter<T, A, false> vec_into_iter(Vector<T, A>&& v) {
-            return VectorIntoIter<T, A, false>{std::forward<Vector<T, A>&&>(v)};
+        template<typename T, mstl::memory::concepts::Allocator A, concepts::GrowthPolicy G>
+        VectorIntoIter<T, A, false, G> vec_into_iter(Vector<T, A, G>&& v) {
+            return VectorIntoIter<T, A, false, G>{std::forward<Vector<T, A, G>&&>(v)};
         }
 
-        template<typename T, mstl::memory::concepts::Allocator A>
-        VectorIntoIter<T, A, true> vec_into_iter_reversed(Vector<T, A>&& v) {
-            return VectorIntoIter<T, A, true>{std::forward<Vector<T, A>&&>(v)};
+        template<typename T, mstl::memory::concepts::Allocator A, concepts::GrowthPolicy G>
+        VectorIntoIter<T, A, true, G> vec_into_iter_reversed(Vector<T, A, G>&& v) {
+            return VectorIntoIter<T, A, true, G>{std::forward<Vector<T, A, G>&&>(v)};
         }
     }
 
@@ -46,6 +52,7 @@ namespace mstl::collection {
      *
      * @tparam T 储存的元素类型
      * @tparam A 分配器类型
+     * @tparam G 增长策略, 参见`growth`中预置的策略
      *
      * ## Example
      * @code
@@ -55,14 +62,17 @@ namespace mstl::collection {
      *      assert(vec[3] == 4);
      * @endcode
      */
-    template<typename T, mstl::memory::concepts::Allocator A = mstl::memory::allocator::Allocator>
+    template<typename T,
+             mstl::memory::concepts::Allocator A = mstl::memory::allocator::Allocator,
+             concepts::GrowthPolicy G = growth::Doubling>
     requires (!basic::RefType<T>)
     class Vector {
     public:
         using Item = T;
-        using IntoIter = VectorIntoIter<T, A, false>;
-        using IntoIterReversed = VectorIntoIter<T, A, true>;
+        using IntoIter = VectorIntoIter<T, A, false, G>;
+        using IntoIterReversed = VectorIntoIter<T, A, true, G>;
         using AllocatorType = A;
+        using GrowthPolicy = G;
         using Iter = VectorIter<T>;
         using ConstIter = VectorIter<const T>;
 
@@ -71,10 +81,12 @@ namespace mstl::collection {
         }
 
         constexpr Vector() : alloc{} {
-            allocate(2);
+            if (usize n = G::initial_capacity(sizeof(T)); n != 0) {
+                allocate(n);
+            }
         }
 
-        constexpr Vector(const A &allocator) : alloc(allocator), len(0), cap(0) {
+        constexpr Vector(const A &allocator) : len(0), cap(0), alloc(allocator) {
 
         }
 
@@ -199,6 +211,29 @@ namespace mstl::collection {
             return alloc;
         }
 
+        /**
+         * @brief 接管已分配的空间, 以构造Vector.
+         *
+         * ptr须为以allocator分配的, 能容纳capacity个元素的空间, 且其前length个元素已被构造.
+         * 之后, 该空间由Vector管理, 并以allocator解分配.
+         *
+         * ## Example
+         * @code
+         *      Allocator alloc;
+         *      int* ptr = alloc.allocate<int>(4);
+         *      ptr[0] = 1;
+         *      auto vec = Vector<int>::from_raw_parts(ptr, 1, 4, alloc);
+         *      assert(vec[0] == 1 && vec.capacity() == 4);
+         * @endcode
+         */
+        static constexpr Vector from_raw_parts(T* ptr, usize length, usize capacity, const A& allocator = A{}) noexcept {
+            Vector vec(allocator);
+            vec.beginPtr = ptr;
+            vec.len = length;
+            vec.cap = capacity;
+            return vec;
+        }
+
     public:
         /**
          * @brief 对Vector赋值, 以使其储存count个val.
@@ -379,6 +414,18 @@ namespace mstl::collection {
             return beginPtr;
         }
 
+        /**
+         * @brief 获取包含Vector中所有元素的Slice.
+         * @attention Vector的空间被重新分配后, Slice将失效.
+         */
+        constexpr Slice<const T> as_slice() const noexcept {
+            return Slice<const T>::from_raw(beginPtr, len);
+        }
+
+        constexpr Slice<T> as_mut_slice() noexcept {
+            return Slice<T>::from_raw(beginPtr, len);
+        }
+
     public:
         /**
          * @brief 把Vector转换为迭代器.
@@ -452,19 +499,15 @@ namespace mstl::collection {
 
         /**
          * @brief 从一个MSTL风格的迭代器构建一个Vector.
-         * 它一般由collect()函数调用.
+         * 它一般由collect()函数调用. 按迭代器的size_hint预留空间.
          * @param iter MSTL风格的迭代器.
          * @attention 由于Vector不能储存引用, 因此, 迭代左值引用的迭代器将生成其所迭代的元素的副本, 而迭代右值引用的迭代器将使得其迭代元素被移入新Vector.
          * @return 新构造的Vector.
          */
         template<iter::Iterator Iter>
         static decltype(auto) from_iter(Iter iter) {
-            Vector v;
-            auto val = iter.next();
-            while (val.is_some()) {
-                v.push_back(val.unwrap_unchecked());
-                val = iter.next();
-            }
+            Vector v(A{});      // 不预先分配空间, 由extend按迭代器的size_hint一次性预留
+            v.extend(std::move(iter));
             return v;
         }
 
@@ -568,8 +611,7 @@ namespace mstl::collection {
                 pop_back();
                 return end();
             } else if (p >= 0 && p < len - 1) {
-                std::move(beginPtr + p + 1, beginPtr + len, beginPtr + p);
-                pop_back();
+                remove_elements(p, 1);
                 return {beginPtr, beginPtr + len, beginPtr + p};
             } else {
                 return {nullptr, nullptr};
@@ -588,14 +630,7 @@ namespace mstl::collection {
                 return VectorIter<T>{nullptr, nullptr};
             } else {
                 auto lo = first.pos(), hi = last.pos();
-                std::move(beginPtr + hi, beginPtr + len, beginPtr + lo);
-                auto d = hi - lo;
-
-                while (d > 0) {
-                    pop_back();
-                    d--;
-                }
-
+                remove_elements(lo, hi - lo);
                 return begin() + lo;
             }
         }
@@ -651,9 +686,7 @@ namespace mstl::collection {
             auto p = pos.pos();
             usize distance = std::abs(std::distance(first, last));
 
-            if (len + distance > cap) {             // if no enougn space
-                allocate_reserve(len + distance);   // then extend the vector
-            }
+            grow_for(len + distance);               // extend the vector if no enough space
 
             move_elements_back(p, distance);        // move elements back
 
@@ -668,6 +701,143 @@ namespace mstl::collection {
             return insert(pos, ilist.begin(), ilist.end());
         }
 
+        /**
+         * @brief 在末尾以复制的方法插入slice中的所有元素.
+         *
+         * 仅预留一次空间. T可按字节复制时, 以memcpy复制所有元素. slice可以引用该Vector自身的元素.
+         *
+         * ## Example
+         * @code
+         *      Vector<int> vec = {1, 2};
+         *      vec.extend_from_slice(vec.as_slice());
+         *      assert(vec == Vector<int>{1, 2, 1, 2});
+         * @endcode
+         */
+        constexpr void extend_from_slice(Slice<const T> slice) {
+            const T* src = slice.as_ptr();
+            usize n = slice.len();
+            if (n > cap - len) {
+                if (!std::is_constant_evaluated() && std::less_equal<const T*>{}(beginPtr, src)
+                    && std::less<const T*>{}(src, beginPtr + len)) {
+                    usize offset = src - beginPtr;      // slice引用自身的元素, 重新分配后需更新其地址
+                    grow_for(len + n);
+                    src = beginPtr + offset;
+                } else {
+                    grow_for(len + n);
+                }
+            }
+
+            if (std::is_trivially_copyable_v<T> && !std::is_constant_evaluated()) {
+                if (n != 0) {
+                    std::memcpy(static_cast<void*>(beginPtr + len), static_cast<const void*>(src), n * sizeof(T));
+                }
+                len += n;
+            } else {
+                // 逐个更新长度, 复制构造抛出异常时已插入的元素由Vector析构
+                for (usize i = 0; i < n; i++) {
+                    std::construct_at(beginPtr + len, src[i]);
+                    len++;
+                }
+            }
+        }
+
+        /**
+         * @brief 在末尾插入迭代器中的所有元素.
+         *
+         * 迭代左值引用的迭代器将插入其元素的副本, 迭代右值的迭代器将使其元素被移入Vector.
+         * 若迭代器实现了ExactSizeIterator, 则仅预留一次空间, 否则按size_hint的下界预留空间; 若其还实现了ContinuousIterator, 且T可按字节复制, 则以memcpy复制所有元素.
+         */
+        template<iter::Iterator I>
+        requires std::constructible_from<T, typename I::Item>
+        constexpr void extend(I iter) {
+            if constexpr (iter::ExactSizeIterator<I>) {
+                usize n = iter.len();
+                if constexpr (iter::ContinuousIterator<I> && std::same_as<std::remove_cvref_t<typename I::Item>, T>) {
+                    if (std::is_trivially_copyable_v<T> && !std::is_constant_evaluated()) {
+                        extend_from_slice(Slice<const T>::from_raw(iter.start_addr(), n));
+                        return;
+                    }
+                }
+                grow_for(len + n);
+                iter::for_each_internal(iter, [&](typename I::Item item) {
+                    std::construct_at(beginPtr + len, std::forward<typename I::Item>(item));
+                    len++;
+                });
+            } else {
+                reserve(len + iter::size_hint(iter).lower);
+                iter::for_each_internal(iter, [&](typename I::Item item) {
+                    push_back(std::forward<typename I::Item>(item));
+                });
+            }
+        }
+
+        /**
+         * @brief 在末尾插入into转换而来的迭代器中的所有元素.
+         *
+         * 右值的into以`into_iter()`转换为迭代器, 其元素被移入Vector; 若into为同类型的Vector的右值, 则等同于`append`.
+         * 左值的into不被消耗: 能以`as_slice()`访问时等同于`extend_from_slice`, 否则以`citer()`或`iter()`复制其元素,
+         * 都不可用时复制into后再转换为迭代器.
+         */
+        template<typename Into>
+        requires iter::IntoIterator<std::remove_cvref_t<Into>> && (!iter::Iterator<std::remove_cvref_t<Into>>)
+        constexpr void extend(Into&& into) {
+            using Source = std::remove_cvref_t<Into>;
+            if constexpr (!std::is_lvalue_reference_v<Into>) {
+                if constexpr (std::same_as<Source, Vector>) {
+                    append(std::move(into));
+                } else {
+                    extend(std::move(into).into_iter());
+                }
+            } else if constexpr (requires { { std::as_const(into).as_slice() } -> std::same_as<Slice<const T>>; }) {
+                extend_from_slice(std::as_const(into).as_slice());
+            } else if constexpr (requires { std::as_const(into).citer(); }) {
+                extend(std::as_const(into).citer());
+            } else if constexpr (requires { std::as_const(into).iter(); }) {
+                extend(std::as_const(into).iter());
+            } else {
+                Source copy = into;
+                extend(copy.into_iter());
+            }
+        }
+
+        /**
+         * @brief 把other中的所有元素移动到末尾, other将被清空.
+         *
+         * 若该Vector为空且两者的分配器相等, 则直接接管other的空间; 否则, 仅预留一次空间.
+         * T可平凡重定位时, 以memcpy移动所有元素.
+         *
+         * ## Example
+         * @code
+         *      Vector<int> a = {1, 2}, b = {3, 4};
+         *      a.append(std::move(b));
+         *      assert(a == Vector<int>{1, 2, 3, 4});
+         *      assert(b.empty());
+         * @endcode
+         */
+        constexpr void append(Vector &&other) {
+            if (&other == this || other.len == 0) {
+                return;
+            }
+            if (len == 0 && alloc == other.alloc) {
+                clear();
+                move_impl(std::move(other));
+                return;
+            }
+
+            grow_for(len + other.len);
+            if (RELOCATABLE && !std::is_constant_evaluated()) {
+                relocate(beginPtr + len, other.beginPtr, other.len);    // 元素已被重定位, 无需析构
+                len += other.len;
+                other.len = 0;
+            } else {
+                for (usize i = 0; i < other.len; i++) {
+                    construct_at(len + i, std::move(other.beginPtr[i]));
+                }
+                len += other.len;
+                other.destroy_all();
+            }
+        }
+
         /**
          * @brief 在末尾以复制的方法插入一个元素.
          */
@@ -751,6 +921,94 @@ namespace mstl::collection {
             }
         }
 
+        /**
+         * @brief 改变Vector的大小, 新元素被默认初始化.
+         *
+         * 与`resize(count)`不同, 可平凡默认构造的元素(如整数)不会被置零, 其值不确定; 其它元素仍由默认构造函数构造.
+         * 适用于之后将被整体覆盖的缓冲区.
+         */
+        constexpr void resize_default_init(usize count) {
+            if (count <= len) {
+                truncate(count);
+                return;
+            }
+            reserve(count);
+            if (std::is_constant_evaluated()) {
+                for (usize i = len; i < count; i++) {
+                    construct_at(i);
+                }
+            } else {
+                std::uninitialized_default_construct(beginPtr + len, beginPtr + count);
+            }
+            len = count;
+        }
+
+        /**
+         * @brief 改变Vector的大小, 且不初始化新元素.
+         *
+         * 新元素的值不确定, 在被写入之前不应被读取. 仅适用于可平凡默认构造且可平凡析构的T.
+         *
+         * ## Example
+         * @code
+         *      Vector<u8> buf;
+         *      buf.resize_uninit(4096);
+         *      usize n = ::read(fd, buf.data(), buf.size());
+         *      buf.truncate(n);
+         * @endcode
+         */
+        constexpr void resize_uninit(usize count)
+        requires std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T> {
+            if (count > len) {
+                reserve(count);
+                if (std::is_constant_evaluated()) {
+                    for (usize i = len; i < count; i++) {
+                        construct_at(i);        // 常量求值时不允许读取未初始化的对象
+                    }
+                }
+            }
+            len = count;
+        }
+
+        /**
+         * @brief 把Vector缩短为count个元素, 并销毁多余的元素. 若count不小于`size()`, 则什么也不做.
+         */
+        constexpr void truncate(usize count) noexcept {
+            if (count < len) {
+                std::destroy(beginPtr + count, beginPtr + len);
+                len = count;
+            }
+        }
+
+        /**
+         * @brief 获取Vector末尾未被使用的空间, 即[size(), capacity())范围内的空间.
+         *
+         * 其中的元素均未被构造: 可平凡默认构造的元素可被直接写入, 其它元素须以`std::construct_at`构造.
+         * 写入后, 以`set_len`把这些元素纳入Vector.
+         *
+         * ## Example
+         * @code
+         *      Vector<u8> buf;
+         *      buf.reserve(4096);
+         *      auto spare = buf.spare_capacity();
+         *      usize n = ::read(fd, spare.as_ptr(), spare.len());
+         *      buf.set_len(buf.size() + n);
+         * @endcode
+         */
+        constexpr Slice<T> spare_capacity() noexcept {
+            return Slice<T>::from_raw(beginPtr + len, cap - len);
+        }
+
+        /**
+         * @brief 把Vector的长度设置为newLen, 不构造或销毁任何元素.
+         *
+         * newLen不应大于`capacity()`, 且前newLen个元素均应已被构造.
+         * 缩短长度时, 被移出的元素不会被析构.
+         */
+        constexpr void set_len(usize newLen) noexcept {
+            MSTL_DEBUG_ASSERT(newLen <= cap, "Length exceeds capacity.");
+            len = newLen;
+        }
+
         /**
          * @brief 从尾部删除一个元素.
          */
@@ -779,6 +1037,9 @@ namespace mstl::collection {
         }
 
     private:
+        // 元素可平凡重定位时, 增长, 插入与擦除以memcpy/memmove移动元素
+        static constexpr bool RELOCATABLE = memory::concepts::TriviallyRelocatable<T>;
+
         usize len{};
         usize cap{};
 
@@ -789,7 +1050,11 @@ namespace mstl::collection {
     private:
         // Deallocate memory without destroy any element.
         constexpr void deallocate() noexcept {
-            alloc.template deallocate(beginPtr, cap);
+            if (std::is_constant_evaluated()) {
+                alloc.template deallocate(beginPtr, cap);
+            } else {
+                alloc.deallocate(beginPtr, memory::Layout::from_type<T>(), cap);
+            }
             beginPtr = nullptr;
             len = cap = 0;
         }
@@ -797,21 +1062,48 @@ namespace mstl::collection {
         // Allocate raw space.
         constexpr void allocate(usize size) noexcept {
             len = 0;
-            cap = size;
+            beginPtr = allocate_at_least(size, cap);
+        }
 
-            beginPtr = alloc.template allocate<T>(size);
+        // Allocate raw space for at least size elements, and store the real capacity into newCap.
+        constexpr T* allocate_at_least(usize size, usize& newCap) noexcept {
+            if (std::is_constant_evaluated()) {
+                newCap = size;
+                return alloc.template allocate<T>(size);
+            }
+            auto block = memory::allocate_at_least(alloc, memory::Layout::from_type<T>(), size);
+            newCap = block.length;
+            return (T*) block.ptr;
         }
 
         constexpr void allocate_reserve(usize size) noexcept {
-            auto nArr = alloc.template allocate<T>(size);  // Alloc
-            for (usize i = 0; i < len; i++) {
-                std::construct_at(nArr + i, std::move(beginPtr[i]));
+            if constexpr (memory::concepts::Reallocator<A> && RELOCATABLE) {
+                // 元素可平凡重定位, 由分配器扩展空间, 以避免逐个移动元素
+                if (!std::is_constant_evaluated() && beginPtr != nullptr) {
+                    constexpr auto layout = memory::Layout::from_type<T>();
+                    auto block = memory::grow_at_least(alloc, beginPtr, layout, cap, size);
+                    if (block.ptr != nullptr) {
+                        beginPtr = (T*) block.ptr;
+                        cap = block.length;
+                        return;
+                    }
+                }
             }
-            usize oLen = len;
 
-            clear();
+            usize newCap;
+            auto nArr = allocate_at_least(size, newCap);  // Alloc
+            usize oLen = len;
+            if (RELOCATABLE && !std::is_constant_evaluated()) {
+                relocate(nArr, beginPtr, len);
+                deallocate();   // 元素已被重定位, 无需析构
+            } else {
+                for (usize i = 0; i < len; i++) {
+                    std::construct_at(nArr + i, std::move(beginPtr[i]));
+                }
+                clear();
+            }
             len = oLen;
-            cap = size;
+            cap = newCap;
             beginPtr = nArr;
         }
 
@@ -859,29 +1151,48 @@ namespace mstl::collection {
         // 把元素向后移动n个位置, 改变len
         // 这将导致[pos, pos + count)范围内的元素为无效元素(垂悬引用)
         constexpr void move_elements_back(usize pos, usize count) {
-            if (len == 0) {
-                return;
+            grow_for(len + count);
+            if (RELOCATABLE && !std::is_constant_evaluated()) {
+                relocate(beginPtr + pos + count, beginPtr + pos, len - pos);
+            } else {
+                for (usize hi = len; hi > pos; hi--) {
+                    construct_at(hi - 1 + count, std::move(beginPtr[hi - 1]));
+                    destroy_at(hi - 1);
+                }
             }
-            if (len + count > cap) {
-                reserve(len + count);
+            len += count;
+        }
+
+        // 销毁[pos, pos + count)范围内的元素, 并把其后的元素向前移动count个位置, 改变len
+        constexpr void remove_elements(usize pos, usize count) {
+            if (RELOCATABLE && !std::is_constant_evaluated()) {
+                std::destroy(beginPtr + pos, beginPtr + pos + count);
+                relocate(beginPtr + pos, beginPtr + pos + count, len - pos - count);
+                len -= count;
+            } else {
+                std::move(beginPtr + pos + count, beginPtr + len, beginPtr + pos);
+                for (usize d = count; d > 0; d--) {
+                    pop_back();
+                }
             }
-            auto hi = len - 1;
-            while (hi >= pos) {
-                construct_at(hi + count, std::move(beginPtr[hi]));
-                destroy_at(hi);
-                hi--;
+        }
+
+        // 把n个元素从src按字节移动到dst, 两者可以重叠. 要求T可平凡重定位, src中的元素之后不应被析构
+        static void relocate(T* dst, const T* src, usize n) noexcept {
+            if (n != 0) {
+                std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
             }
-            len += count;
         }
 
         constexpr void extend_space() {
-            usize newCap;
-            if (cap == 0) {
-                newCap = 2;
-            } else {
-                newCap = 2 * cap;
+            grow_for(len + 1);
+        }
+
+        // 按增长策略扩展空间, 使其至少能容纳required个元素
+        constexpr void grow_for(usize required) {
+            if (required > cap) {
+                allocate_reserve(G::next_capacity(cap, required, sizeof(T)));
             }
-            reserve(newCap);
         }
 
         constexpr void destroy_all() {
@@ -916,6 +1227,15 @@ namespace mstl::collection {
             }
         }
 
+        /// impl DoubleEndedIterator
+        constexpr Option<Item> prev() {
+            if (cur != end) {
+                return Option<Item>::some(*--end);
+            } else {
+                return Option<Item>::none();
+            }
+        }
+
         constexpr T &operator*() {
             return *cur;
         }
@@ -985,32 +1305,75 @@ namespace mstl::collection {
         constexpr usize pos() const {
             return cur - beg;
         }
+
+        /// impl ExactSizeIterator
+        constexpr usize len() const {
+            return end - cur;
+        }
+
+        constexpr bool is_empty() const {
+            return cur == end;
+        }
+
+        /// impl ContinuousIterator
+        constexpr const T* start_addr() const {
+            return cur;
+        }
+
+        /// impl ChunkedIterator
+        template<usize N>
+        constexpr iter::IterChunk<Item, N> next_chunk() {
+            iter::IterChunk<Item, N> chunk;
+            const usize n = len() < N ? len() : N;
+            for (usize i = 0; i < n; i++) {
+                chunk.push(*cur++);
+            }
+            return chunk;
+        }
+
+        /// impl InternalIterator
+        template<typename F>
+        constexpr void for_each_internal(F&& f) {
+            for (; cur != end; cur++) {
+                f(*cur);
+            }
+        }
+
+        template<typename Acc, typename F>
+        constexpr bool try_fold(Acc& acc, F&& f) {
+            while (cur != end) {
+                if (!f(acc, *cur++)) {
+                    return false;
+                }
+            }
+            return true;
+        }
     private:
         T *const beg = nullptr;
         T *cur = nullptr;
-        T *const end = nullptr;
+        T *end = nullptr;
     };
 
-    template<typename T, mstl::memory::concepts::Allocator A>
-    class VectorIntoIter<T, A, false> {
+    template<typename T, mstl::memory::concepts::Allocator A, concepts::GrowthPolicy G>
+    class VectorIntoIter<T, A, false, G> {
     public:
         using Item = T;
-        using VecType = Vector<Item, A>;
-        VectorIntoIter(VecType && v) : vec{std::forward<VecType&&>(v)}, len(vec.size()){}
+        using VecType = Vector<Item, A, G>;
+        VectorIntoIter(VecType && v) : vec{std::forward<VecType&&>(v)}, size(vec.size()){}
         VectorIntoIter(const VectorIntoIter& v) = delete;
         VectorIntoIter(VectorIntoIter&& v)  noexcept {
             vec = std::move(v.vec);
             pos = v.pos;
             v.pos = 0;
-            len = vec.size();
+            size = vec.size();
         }
 
     public:
         Option<Item> next() {
-            if (pos < len) {
+            if (pos < size) {
                 auto n = Option<Item>::some(Item{std::move(vec[pos])});
                 pos++;
-                if (pos == len) {
+                if (pos == size) {
                     vec.clear();
                 }
                 return n;
@@ -1019,17 +1382,26 @@ namespace mstl::collection {
             }
         }
 
+        /// impl ExactSizeIterator
+        usize len() const {
+            return pos < size ? size - pos : 0;
+        }
+
+        bool is_empty() const {
+            return len() == 0;
+        }
+
     private:
-        Vector<Item, A> vec;
+        VecType vec;
         usize pos = 0;
-        usize len;
+        usize size;
     };
 
-    template<typename T, mstl::memory::concepts::Allocator A>
-    class VectorIntoIter<T, A, true> {
+    template<typename T, mstl::memory::concepts::Allocator A, concepts::GrowthPolicy G>
+    class VectorIntoIter<T, A, true, G> {
     public:
         using Item = T;
-        using VecType = Vector<Item, A>;
+        using VecType = Vector<Item, A, G>;
 
         explicit VectorIntoIter(VecType && v) : vec{std::forward<VecType&&>(v)}{}
         VectorIntoIter(const VectorIntoIter& v) = delete;
@@ -1051,13 +1423,23 @@ namespace mstl::collection {
             }
         }
 
+        /// impl ExactSizeIterator
+        usize len() const {
+            return vec.size();
+        }
+
+        bool is_empty() const {
+            return vec.empty();
+        }
+
     private:
-        Vector<Item, A> vec;
+        VecType vec;
     };
 
-    template<typename T, typename U, memory::concepts::Allocator A, memory::concepts::Allocator B>
+    template<typename T, typename U, memory::concepts::Allocator A, memory::concepts::Allocator B,
+             concepts::GrowthPolicy G, concepts::GrowthPolicy H>
     requires ops::Eq<T, U>
-    bool operator==(const Vector<T, A> &lhs, const Vector<U, B> &rhs) {
+    bool operator==(const Vector<T, A, G> &lhs, const Vector<U, B, H> &rhs) {
         if (lhs.size() != rhs.size()) {
             return false;
         } else {
@@ -1070,8 +1452,8 @@ namespace mstl::collection {
         return true;
     }
 
-    template<mstl::basic::Printable T, memory::concepts::Allocator A>
-    std::ostream &operator<<(std::ostream &os, const Vector<T, A> &vector) {
+    template<mstl::basic::Printable T, memory::concepts::Allocator A, concepts::GrowthPolicy G>
+    std::ostream &operator<<(std::ostream &os, const Vector<T, A, G> &vector) {
         os << "Vec [";
         for (usize i = 0; i < vector.size(); i++) {
             os << vector[i];
@@ -1083,8 +1465,9 @@ namespace mstl::collection {
         return os;
     }
 
-    template<typename T, typename U, memory::concepts::Allocator A, memory::concepts::Allocator B>
-    auto operator<=>(const Vector<T, A>& lhs, const Vector<U, B>& rhs)
+    template<typename T, typename U, memory::concepts::Allocator A, memory::concepts::Allocator B,
+             concepts::GrowthPolicy G, concepts::GrowthPolicy H>
+    auto operator<=>(const Vector<T, A, G>& lhs, const Vector<U, B, H>& rhs)
     requires requires (T t, U u, usize len){
         requires std::three_way_comparable_with<T, U, std::partial_ordering>;
         { t <=> u } -> std::constructible_from<decltype(len <=> len)>;
@@ -1107,6 +1490,12 @@ namespace mstl::collection {
     }
 
 }
+namespace mstl::memory {
+    // Vector仅持有指向堆上空间的指针, 可与其分配器一同被平凡重定位
+    template<typename T, concepts::Allocator A, collection::concepts::GrowthPolicy G>
+    struct IsTriviallyRelocatable<collection::Vector<T, A, G>>: IsTriviallyRelocatable<A> {};
+}
+
 template<typename T>
 struct std::iterator_traits<mstl::collection::VectorIter<T>>
 {
@@ -9,5 +9,15 @@
 #include <mstl/iter/adapters/combinator_concepts.h>
 #include <mstl/iter/adapters/filter.h>
 #include <mstl/iter/adapters/map.h>
+#include <mstl/iter/adapters/chunks.h>
+#include <mstl/iter/adapters/windows.h>
+#include <mstl/iter/adapters/zip.h>
+#include <mstl/iter/adapters/chain.h>
+#include <mstl/iter/adapters/enumerate.h>
+#include <mstl/iter/adapters/take.h>
+#include <mstl/iter/adapters/skip.h>
+#include <mstl/iter/adapters/step_by.h>
+#include <mstl/iter/adapters/flat_map.h>
+#include <mstl/iter/adapters/rev.h>
 
 #endif //__MODERN_STL_ADAPTER_H__
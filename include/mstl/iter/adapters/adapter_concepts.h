@@ -12,7 +12,7 @@ namespace mstl::iter::_private {
     concept AdapterHolder = requires {
         requires Iterator<Iter>;
         requires requires(Holder holder, Iter iter) {
-            { holder.to_adapter(iter) } -> Iterator;
+            { holder.to_adapter(std::move(iter)) } -> Iterator;
         };
     };
 }
@@ -0,0 +1,140 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef __MODERN_STL_CHAIN_H__
+#define __MODERN_STL_CHAIN_H__
+
+#include <mstl/global.h>
+#include <mstl/intrinsics.h>
+#include <mstl/iter/iter_concepts.h>
+
+namespace mstl::iter {
+    namespace _private {
+        /// 先迭代a, a耗尽后再迭代b. 两者的元素类型须相同
+        template<Iterator A, Iterator B>
+        requires std::same_as<typename A::Item, typename B::Item>
+        class ChainIter {
+        public:
+            using Item = typename A::Item;
+
+            ChainIter(A a, B b): a(std::move(a)), b(std::move(b)), a_done(false) {}
+
+            MSTL_INLINE constexpr
+            Option<Item> next() noexcept {
+                if (!a_done) {
+                    auto x = a.next();
+                    if (x.is_some()) {
+                        return x;
+                    }
+                    a_done = true;
+                }
+                return b.next();
+            }
+
+            /// impl DoubleEndedIterator: 从尾部迭代时先耗尽b
+            MSTL_INLINE constexpr
+            Option<Item> prev() noexcept requires DoubleEndedIterator<A> && DoubleEndedIterator<B> {
+                auto y = b.prev();
+                if (y.is_some()) {
+                    return y;
+                }
+                return a_done ? Option<Item>::none() : a.prev();
+            }
+
+            MSTL_INLINE constexpr
+            SizeHint size_hint() noexcept {
+                SizeHint y = ::mstl::iter::size_hint(b);
+                if (a_done) {
+                    return y;
+                }
+                SizeHint x = ::mstl::iter::size_hint(a);
+                Option<usize> upper = x.upper.is_some() && y.upper.is_some()
+                    ? Option<usize>::some(x.upper.unwrap_unchecked() + y.upper.unwrap_unchecked())
+                    : Option<usize>::none();
+                return { x.lower + y.lower, upper };
+            }
+
+            /// impl ExactSizeIterator
+            MSTL_INLINE constexpr
+            usize len() noexcept requires ExactSizeIterator<A> && ExactSizeIterator<B> {
+                return (a_done ? 0 : a.len()) + b.len();
+            }
+
+            MSTL_INLINE constexpr
+            bool is_empty() noexcept requires ExactSizeIterator<A> && ExactSizeIterator<B> {
+                return (a_done || a.is_empty()) && b.is_empty();
+            }
+
+            /// impl InternalIterator: 依次在两者的内部循环中迭代
+            template<typename F>
+            MSTL_INLINE constexpr
+            void for_each_internal(F&& f) {
+                if (!a_done) {
+                    ::mstl::iter::for_each_internal(a, f);
+                    a_done = true;
+                }
+                ::mstl::iter::for_each_internal(b, f);
+            }
+
+            template<typename Acc, typename F>
+            MSTL_INLINE constexpr
+            bool try_fold(Acc& acc, F&& f) {
+                if (!a_done) {
+                    if (!::mstl::iter::try_fold(a, acc, f)) {
+                        return false;
+                    }
+                    a_done = true;
+                }
+                return ::mstl::iter::try_fold(b, acc, f);
+            }
+
+            MSTL_INLINE constexpr
+            ChainIter into_iter() noexcept { return *this; }
+
+        private:
+            A a;
+            B b;
+            bool a_done;
+        };
+
+        template<Iterator Other>
+        class ChainHolder {
+        public:
+            ChainHolder(Other other): other(std::move(other)) {}
+
+            template<Iterator Iter>
+            MSTL_INLINE constexpr
+            ChainIter<Iter, Other> to_adapter(Iter iter) {
+                return ChainIter<Iter, Other>{ std::move(iter), std::move(other) };
+            }
+        private:
+            Other other;
+        };
+    }
+
+    /**
+     * @brief 在源迭代器耗尽后继续迭代other, 两者的元素类型须相同.
+     *
+     * ## Example
+     * @code
+     *      Vector<i32> a = {1, 2}, b = {3};
+     *      auto v = a.iter() | chain(b.iter()) | map([](const i32& x) { return x; }) | collect<Vector<i32>>();
+     *      // [1, 2, 3]
+     * @endcode
+     */
+    template<Iterator Other>
+    MSTL_INLINE constexpr
+    _private::ChainHolder<Other> chain(Other other) {
+        return { std::move(other) };
+    }
+
+    /// @brief 先迭代a, 再迭代b, 与`a | chain(b)`相同.
+    template<Iterator A, Iterator B>
+    MSTL_INLINE constexpr
+    _private::ChainIter<A, B> chain(A a, B b) {
+        return { std::move(a), std::move(b) };
+    }
+}
+
+#endif //__MODERN_STL_CHAIN_H__
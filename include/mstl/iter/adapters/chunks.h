@@ -0,0 +1,439 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef __MODERN_STL_CHUNKS_H__
+#define __MODERN_STL_CHUNKS_H__
+
+#include <type_traits>
+#include <mstl/global.h>
+#include <mstl/intrinsics.h>
+#include <mstl/slice.h>
+#include <mstl/collection/array.h>
+#include <mstl/iter/iter_concepts.h>
+
+namespace mstl::iter {
+    namespace _private {
+        /**
+         * 连续迭代器中元素的类型. 源迭代器返回可变引用时, 视图也可以修改元素;
+         * 源迭代器按值返回元素(如ArrayIter)时, 视图只读.
+         */
+        template<ContinuousIterator Iter>
+        using ContinuousElem = std::conditional_t<
+            std::is_lvalue_reference_v<typename Iter::Item>,
+            std::remove_reference_t<typename Iter::Item>,
+            const typename Iter::Item
+        >;
+
+        /**
+         * 连续迭代器上的视图适配器的公共部分.
+         *
+         * 适配器不推进源迭代器, 而是记录相对于`start_addr()`的偏移.
+         * 源迭代器可能自身持有元素, 记录偏移而不是指针, 使得复制适配器后视图仍指向副本中的元素.
+         */
+        template<ContinuousIterator Iter>
+        class ContinuousCursor {
+        public:
+            using Elem = ContinuousElem<Iter>;
+
+            explicit ContinuousCursor(Iter iter): iter(std::move(iter)), pos(0) {
+                end = this->iter.len();
+            }
+
+        protected:
+            MSTL_INLINE constexpr
+            Elem* base() noexcept {
+                return const_cast<Elem*>(iter.start_addr());
+            }
+
+            MSTL_INLINE constexpr
+            usize remaining() const noexcept {
+                return end - pos;
+            }
+
+            Iter iter;
+            usize pos;
+            usize end;
+        };
+
+        /// 每次返回不多于size个元素的Slice, 最后一块可能较短
+        template<ContinuousIterator Iter>
+        class ChunksIter: ContinuousCursor<Iter> {
+            using Base = ContinuousCursor<Iter>;
+            using Base::base;
+            using Base::remaining;
+            using Base::pos;
+            using Base::end;
+        public:
+            using Elem = typename Base::Elem;
+            using Item = Slice<Elem>;
+
+            ChunksIter(Iter iter, usize size): Base(std::move(iter)), size(size) {
+                if (size == 0) {
+                    MSTL_PANIC("chunks: size must be greater than 0");
+                }
+            }
+
+            MSTL_INLINE constexpr
+            Option<Item> next() noexcept {
+                if (pos == end) {
+                    return Option<Item>::none();
+                }
+                const usize n = remaining() < size ? remaining() : size;
+                Item chunk = Item::from_raw(base() + pos, n);
+                pos += n;
+                return Option<Item>::some(chunk);
+            }
+
+            /// impl DoubleEndedIterator: 从尾部返回时, 第一块是较短的余下部分
+            MSTL_INLINE constexpr
+            Option<Item> prev() noexcept {
+                if (pos == end) {
+                    return Option<Item>::none();
+                }
+                const usize tail = remaining() % size;
+                const usize n = tail == 0 ? size : tail;
+                end -= n;
+                return Option<Item>::some(Item::from_raw(base() + end, n));
+            }
+
+            /// impl ExactSizeIterator
+            MSTL_INLINE constexpr
+            usize len() noexcept {
+                return remaining() / size + (remaining() % size != 0);
+            }
+
+            MSTL_INLINE constexpr
+            bool is_empty() noexcept {
+                return pos == end;
+            }
+
+            MSTL_INLINE constexpr
+            SizeHint size_hint() noexcept {
+                return { len(), Option<usize>::some(len()) };
+            }
+
+            /// impl InternalIterator
+            template<typename F>
+            MSTL_INLINE constexpr
+            void for_each_internal(F&& f) {
+                Elem* data = base();
+                for (; remaining() > size; pos += size) {
+                    f(Item::from_raw(data + pos, size));
+                }
+                if (pos != end) {
+                    f(Item::from_raw(data + pos, remaining()));
+                    pos = end;
+                }
+            }
+
+            template<typename Acc, typename F>
+            MSTL_INLINE constexpr
+            bool try_fold(Acc& acc, F&& f) {
+                while (pos != end) {
+                    const usize n = remaining() < size ? remaining() : size;
+                    Item chunk = Item::from_raw(base() + pos, n);
+                    pos += n;
+                    if (!f(acc, chunk)) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            MSTL_INLINE constexpr
+            ChunksIter into_iter() noexcept { return *this; }
+
+        private:
+            usize size;
+        };
+
+        /// 每次返回恰好size个元素的Slice, 不足size个的余下部分由remainder()取得
+        template<ContinuousIterator Iter>
+        class ChunksExactIter: ContinuousCursor<Iter> {
+            using Base = ContinuousCursor<Iter>;
+            using Base::base;
+            using Base::remaining;
+            using Base::pos;
+            using Base::end;
+        public:
+            using Elem = typename Base::Elem;
+            using Item = Slice<Elem>;
+
+            ChunksExactIter(Iter iter, usize size): Base(std::move(iter)), size(size) {
+                if (size == 0) {
+                    MSTL_PANIC("chunks_exact: size must be greater than 0");
+                }
+                tail = remaining() % size;
+                end -= tail;
+                tail_start = end;
+            }
+
+            MSTL_INLINE constexpr
+            Option<Item> next() noexcept {
+                if (pos == end) {
+                    return Option<Item>::none();
+                }
+                Item chunk = Item::from_raw(base() + pos, size);
+                pos += size;
+                return Option<Item>::some(chunk);
+            }
+
+            /// impl DoubleEndedIterator
+            MSTL_INLINE constexpr
+            Option<Item> prev() noexcept {
+                if (pos == end) {
+                    return Option<Item>::none();
+                }
+                end -= size;
+                return Option<Item>::some(Item::from_raw(base() + end, size));
+            }
+
+            /// 不足size个元素的余下部分, 不会被迭代
+            MSTL_INLINE constexpr
+            Item remainder() noexcept {
+                return Item::from_raw(base() + tail_start, tail);
+            }
+
+            /// impl ExactSizeIterator
+            MSTL_INLINE constexpr
+            usize len() noexcept {
+                return remaining() / size;
+            }
+
+            MSTL_INLINE constexpr
+            bool is_empty() noexcept {
+                return pos == end;
+            }
+
+            MSTL_INLINE constexpr
+            SizeHint size_hint() noexcept {
+                return { len(), Option<usize>::some(len()) };
+            }
+
+            /// impl InternalIterator
+            template<typename F>
+            MSTL_INLINE constexpr
+            void for_each_internal(F&& f) {
+                Elem* data = base();
+                for (; pos != end; pos += size) {
+                    f(Item::from_raw(data + pos, size));
+                }
+            }
+
+            template<typename Acc, typename F>
+            MSTL_INLINE constexpr
+            bool try_fold(Acc& acc, F&& f) {
+                Elem* data = base();
+                while (pos != end) {
+                    Item chunk = Item::from_raw(data + pos, size);
+                    pos += size;
+                    if (!f(acc, chunk)) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            MSTL_INLINE constexpr
+            ChunksExactIter into_iter() noexcept { return *this; }
+
+        private:
+            usize size;
+            usize tail;
+            usize tail_start;
+        };
+
+        /**
+         * 每次返回恰好N个元素, 以`Array<T, N>`的引用的形式访问. 由于N在编译期已知,
+         * 对每一块的循环可以被完全展开和向量化. 不足N个的余下部分由remainder()取得.
+         */
+        template<ContinuousIterator Iter, usize N>
+        class ArrayChunksIter: ContinuousCursor<Iter> {
+            using Base = ContinuousCursor<Iter>;
+            using Base::base;
+            using Base::remaining;
+            using Base::pos;
+            using Base::end;
+        public:
+            using Elem = typename Base::Elem;
+            using Chunk = std::conditional_t<
+                std::is_const_v<Elem>,
+                const collection::Array<std::remove_const_t<Elem>, N>,
+                collection::Array<Elem, N>
+            >;
+            using Item = Chunk&;
+
+            static_assert(sizeof(Chunk) == sizeof(Elem) * N && alignof(Chunk) == alignof(Elem),
+                          "Array<T, N> must have the same layout as T[N]");
+
+            explicit ArrayChunksIter(Iter iter): Base(std::move(iter)) {
+                tail = remaining() % N;
+                end -= tail;
+                tail_start = end;
+            }
+
+            MSTL_INLINE
+            Option<Item> next() noexcept {
+                if (pos == end) {
+                    return Option<Item>::none();
+                }
+                Chunk& chunk = at(pos);
+                pos += N;
+                return Option<Item>::some(chunk);
+            }
+
+            /// impl DoubleEndedIterator
+            MSTL_INLINE
+            Option<Item> prev() noexcept {
+                if (pos == end) {
+                    return Option<Item>::none();
+                }
+                end -= N;
+                return Option<Item>::some(at(end));
+            }
+
+            /// 不足N个元素的余下部分, 不会被迭代
+            MSTL_INLINE constexpr
+            Slice<Elem> remainder() noexcept {
+                return Slice<Elem>::from_raw(base() + tail_start, tail);
+            }
+
+            /// impl ExactSizeIterator
+            MSTL_INLINE constexpr
+            usize len() noexcept {
+                return remaining() / N;
+            }
+
+            MSTL_INLINE constexpr
+            bool is_empty() noexcept {
+                return pos == end;
+            }
+
+            MSTL_INLINE constexpr
+            SizeHint size_hint() noexcept {
+                return { len(), Option<usize>::some(len()) };
+            }
+
+            /// impl InternalIterator
+            template<typename F>
+            MSTL_INLINE
+            void for_each_internal(F&& f) {
+                for (; pos != end; pos += N) {
+                    f(at(pos));
+                }
+            }
+
+            template<typename Acc, typename F>
+            MSTL_INLINE
+            bool try_fold(Acc& acc, F&& f) {
+                while (pos != end) {
+                    Chunk& chunk = at(pos);
+                    pos += N;
+                    if (!f(acc, chunk)) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            MSTL_INLINE constexpr
+            ArrayChunksIter into_iter() noexcept { return *this; }
+
+        private:
+            MSTL_INLINE
+            Chunk& at(usize offset) noexcept {
+                return *reinterpret_cast<Chunk*>(base() + offset);
+            }
+
+            usize tail;
+            usize tail_start;
+        };
+
+        class ChunksHolder {
+        public:
+            ChunksHolder(usize size): size(size) {}
+
+            template<ContinuousIterator Iter>
+            MSTL_INLINE constexpr
+            ChunksIter<Iter> to_adapter(Iter iter) {
+                return ChunksIter<Iter>{ std::move(iter), size };
+            }
+        private:
+            usize size;
+        };
+
+        class ChunksExactHolder {
+        public:
+            ChunksExactHolder(usize size): size(size) {}
+
+            template<ContinuousIterator Iter>
+            MSTL_INLINE constexpr
+            ChunksExactIter<Iter> to_adapter(Iter iter) {
+                return ChunksExactIter<Iter>{ std::move(iter), size };
+            }
+        private:
+            usize size;
+        };
+
+        template<usize N>
+        struct ArrayChunksHolder {
+            template<ContinuousIterator Iter>
+            MSTL_INLINE constexpr
+            ArrayChunksIter<Iter, N> to_adapter(Iter iter) {
+                return ArrayChunksIter<Iter, N>{ std::move(iter) };
+            }
+        };
+    }
+
+    /**
+     * @brief 将连续迭代器按size个元素一块划分, 每块以`Slice`的形式返回, 不复制元素. 最后一块可能不足size个元素.
+     *
+     * ## Example
+     * @code
+     *      Vector<i32> v = {1, 2, 3, 4, 5};
+     *      auto it = v.iter() | chunks(2);
+     *      // [1, 2], [3, 4], [5]
+     * @endcode
+     */
+    MSTL_INLINE inline
+    _private::ChunksHolder chunks(usize size) {
+        return { size };
+    }
+
+    /**
+     * @brief 将连续迭代器按size个元素一块划分, 只返回恰好含有size个元素的块. 余下的元素以`remainder()`取得.
+     *
+     * ## Example
+     * @code
+     *      Vector<i32> v = {1, 2, 3, 4, 5};
+     *      auto it = v.iter() | chunks_exact(2);
+     *      // [1, 2], [3, 4]; it.remainder() == [5]
+     * @endcode
+     */
+    MSTL_INLINE inline
+    _private::ChunksExactHolder chunks_exact(usize size) {
+        return { size };
+    }
+
+    /**
+     * @brief 块的大小在编译期确定的`chunks_exact`, 每块以`Array<T, N>`的引用的形式返回.
+     *
+     * ## Example
+     * @code
+     *      Vector<float> samples = ...;
+     *      samples.iter() | chunks_exact<8>() | for_each([](const Array<float, 8>& block) {
+     *          float sum = 0;
+     *          for (float x: block) { sum += x; } // 循环次数在编译期已知
+     *      });
+     * @endcode
+     */
+    template<usize N>
+    requires (N > 0)
+    MSTL_INLINE constexpr
+    _private::ArrayChunksHolder<N> chunks_exact() {
+        return {};
+    }
+}
+
+#endif //__MODERN_STL_CHUNKS_H__
@@ -0,0 +1,111 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef __MODERN_STL_ENUMERATE_H__
+#define __MODERN_STL_ENUMERATE_H__
+
+#include <mstl/global.h>
+#include <mstl/intrinsics.h>
+#include <mstl/utility/tuple.h>
+#include <mstl/iter/iter_concepts.h>
+
+namespace mstl::iter {
+    namespace _private {
+        /// 返回由元素的序号与元素组成的二元组, 序号从0开始
+        template<Iterator Iter>
+        class EnumerateIter {
+        public:
+            using Item = utility::Tuple<usize, typename Iter::Item>;
+
+            EnumerateIter(Iter iter): iter(std::move(iter)), count(0) {}
+
+            MSTL_INLINE constexpr
+            Option<Item> next() noexcept {
+                auto x = iter.next();
+                if (x.is_none()) {
+                    return Option<Item>::none();
+                }
+                return Option<Item>::some(Item{ count++, x.unwrap_unchecked() });
+            }
+
+            /// impl DoubleEndedIterator: 尾部元素的序号由剩余元素的数量得出
+            MSTL_INLINE constexpr
+            Option<Item> prev() noexcept requires DoubleEndedIterator<Iter> && ExactSizeIterator<Iter> {
+                usize index = count + iter.len() - 1;
+                auto x = iter.prev();
+                if (x.is_none()) {
+                    return Option<Item>::none();
+                }
+                return Option<Item>::some(Item{ index, x.unwrap_unchecked() });
+            }
+
+            MSTL_INLINE constexpr
+            SizeHint size_hint() noexcept {
+                return ::mstl::iter::size_hint(iter);
+            }
+
+            /// impl ExactSizeIterator
+            MSTL_INLINE constexpr
+            usize len() noexcept requires ExactSizeIterator<Iter> {
+                return iter.len();
+            }
+
+            MSTL_INLINE constexpr
+            bool is_empty() noexcept requires ExactSizeIterator<Iter> {
+                return iter.is_empty();
+            }
+
+            /// impl InternalIterator: 在源迭代器的内部循环中计数
+            template<typename F>
+            MSTL_INLINE constexpr
+            void for_each_internal(F&& f) {
+                ::mstl::iter::for_each_internal(iter, [&](typename Iter::Item item) {
+                    f(Item{ count++, std::forward<typename Iter::Item>(item) });
+                });
+            }
+
+            template<typename Acc, typename F>
+            MSTL_INLINE constexpr
+            bool try_fold(Acc& acc, F&& f) {
+                return ::mstl::iter::try_fold(iter, acc, [&](Acc& a, typename Iter::Item item) {
+                    return f(a, Item{ count++, std::forward<typename Iter::Item>(item) });
+                });
+            }
+
+            MSTL_INLINE constexpr
+            EnumerateIter into_iter() noexcept { return *this; }
+
+        private:
+            Iter iter;
+            usize count;
+        };
+
+        class EnumerateHolder {
+        public:
+            template<Iterator Iter>
+            MSTL_INLINE constexpr
+            EnumerateIter<Iter> to_adapter(Iter iter) {
+                return EnumerateIter<Iter>{ std::move(iter) };
+            }
+        };
+    }
+
+    /**
+     * @brief 为每个元素附上从0开始的序号, 返回`Tuple<usize, Item>`.
+     *
+     * ## Example
+     * @code
+     *      Vector<char> v = {'a', 'b'};
+     *      v.iter() | enumerate() | for_each([](auto p) {
+     *          // (0, 'a'), (1, 'b')
+     *      });
+     * @endcode
+     */
+    MSTL_INLINE inline
+    _private::EnumerateHolder enumerate() {
+        return {};
+    }
+}
+
+#endif //__MODERN_STL_ENUMERATE_H__
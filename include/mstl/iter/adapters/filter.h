@@ -25,13 +25,57 @@ namespace mstl::iter {
         public:
             using Item = typename Iter::Item;
 
-            FilterIter(Iter it, P p) noexcept : iter(it), predicate(p) { }
+            FilterIter(Iter it, P p) noexcept : iter(std::move(it)), predicate(p) { }
 
             MSTL_INLINE constexpr
             Option<Item> next() noexcept {
                 return find(this->iter, predicate);
             }
 
+            /// 元素可能全部被过滤, 因此下界为0, 上界与源迭代器相同
+            MSTL_INLINE constexpr
+            SizeHint size_hint() noexcept {
+                return { 0, ::mstl::iter::size_hint(iter).upper };
+            }
+
+            /// impl ChunkedIterator: 成批取得源迭代器的元素后过滤, 直到至少有一个元素通过或源迭代器耗尽
+            template<usize N>
+            MSTL_INLINE constexpr
+            IterChunk<Item, N> next_chunk() {
+                IterChunk<Item, N> chunk;
+                while (chunk.is_empty()) {
+                    auto source = ::mstl::iter::next_chunk<N>(iter);
+                    if (source.is_empty()) {
+                        break;
+                    }
+                    for (usize i = 0; i < source.len(); i++) {
+                        if (predicate(source[i])) {
+                            chunk.push(source.take(i));
+                        }
+                    }
+                }
+                return chunk;
+            }
+
+            /// impl InternalIterator: 在源迭代器的内部循环中过滤元素
+            template<typename F>
+            MSTL_INLINE constexpr
+            void for_each_internal(F&& f) {
+                ::mstl::iter::for_each_internal(iter, [&](Item item) {
+                    if (predicate(item)) {
+                        f(std::forward<Item>(item));
+                    }
+                });
+            }
+
+            template<typename Acc, typename F>
+            MSTL_INLINE constexpr
+            bool try_fold(Acc& acc, F&& f) {
+                return ::mstl::iter::try_fold(iter, acc, [&](Acc& a, Item item) {
+                    return !predicate(item) || f(a, std::forward<Item>(item));
+                });
+            }
+
             MSTL_INLINE constexpr
             FilterIter<Iter, P>
             into_iter() noexcept { return *this; }
@@ -47,13 +91,78 @@ namespace mstl::iter {
         public:
             using Item = typename Iter::Item;
 
-            FilterIter(Iter it, P p) noexcept : iter(it), predicate(p) { }
+            FilterIter(Iter it, P p) noexcept : iter(std::move(it)), predicate(p) { }
 
             MSTL_INLINE constexpr
             Option<Item> next() noexcept {
                 return find<Iter, P, Predict>(this->iter, predicate);
             }
 
+            /// 元素可能全部被过滤, 因此下界为0, 上界与源迭代器相同
+            MSTL_INLINE constexpr
+            SizeHint size_hint() noexcept {
+                return { 0, ::mstl::iter::size_hint(iter).upper };
+            }
+
+            /// impl ChunkedIterator: 成批取得源迭代器的元素后过滤, 直到至少有一个元素通过或源迭代器耗尽
+            template<usize N>
+            MSTL_INLINE constexpr
+            IterChunk<Item, N> next_chunk() {
+                IterChunk<Item, N> chunk;
+                while (chunk.is_empty()) {
+                    auto source = ::mstl::iter::next_chunk<N>(iter);
+                    if (source.is_empty()) {
+                        break;
+                    }
+                    for (usize i = 0; i < source.len(); i++) {
+                        if constexpr (Predict) {
+                            if (predicate(source[i])) [[likely]] {
+                                chunk.push(source.take(i));
+                            }
+                        } else {
+                            if (predicate(source[i])) [[unlikely]] {
+                                chunk.push(source.take(i));
+                            }
+                        }
+                    }
+                }
+                return chunk;
+            }
+
+            /// impl InternalIterator: 在源迭代器的内部循环中过滤元素
+            template<typename F>
+            MSTL_INLINE constexpr
+            void for_each_internal(F&& f) {
+                ::mstl::iter::for_each_internal(iter, [&](Item item) {
+                    if constexpr (Predict) {
+                        if (predicate(item)) [[likely]] {
+                            f(std::forward<Item>(item));
+                        }
+                    } else {
+                        if (predicate(item)) [[unlikely]] {
+                            f(std::forward<Item>(item));
+                        }
+                    }
+                });
+            }
+
+            template<typename Acc, typename F>
+            MSTL_INLINE constexpr
+            bool try_fold(Acc& acc, F&& f) {
+                return ::mstl::iter::try_fold(iter, acc, [&](Acc& a, Item item) {
+                    if constexpr (Predict) {
+                        if (predicate(item)) [[likely]] {
+                            return f(a, std::forward<Item>(item));
+                        }
+                    } else {
+                        if (predicate(item)) [[unlikely]] {
+                            return f(a, std::forward<Item>(item));
+                        }
+                    }
+                    return true;
+                });
+            }
+
             MSTL_INLINE constexpr
             FilterIter<Iter, P, Predict>
             into_iter() noexcept { return *this; }
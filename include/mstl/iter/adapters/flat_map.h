@@ -0,0 +1,155 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef __MODERN_STL_FLAT_MAP_H__
+#define __MODERN_STL_FLAT_MAP_H__
+
+#include <type_traits>
+#include <mstl/global.h>
+#include <mstl/intrinsics.h>
+#include <mstl/iter/iter_concepts.h>
+
+namespace mstl::iter {
+    namespace _private {
+        /// flat_map的转化函数可以返回迭代器, 或以into_iter()转化为迭代器的类型. 后者须能在右值上调用into_iter(), 即迭代器持有元素
+        template<typename T>
+        concept FlatMapResult = Iterator<T> || (IntoIterator<T> && requires(T t) { std::move(t).into_iter(); });
+
+        template<typename T>
+        requires FlatMapResult<std::remove_cvref_t<T>>
+        MSTL_INLINE constexpr
+        auto to_inner_iter(T&& t) {
+            if constexpr (Iterator<std::remove_cvref_t<T>>) {
+                return std::forward<T>(t);
+            } else {
+                return std::forward<T>(t).into_iter();
+            }
+        }
+
+        /// 对每个元素调用func, 并依次迭代其返回的迭代器中的元素
+        template<Iterator Iter, typename Func>
+        requires std::invocable<Func, typename Iter::Item> &&
+                 FlatMapResult<std::invoke_result_t<Func, typename Iter::Item>>
+        class FlatMapIter {
+            using Inner = decltype(to_inner_iter(std::declval<std::invoke_result_t<Func, typename Iter::Item>>()));
+        public:
+            using Item = typename Inner::Item;
+
+            FlatMapIter(Iter iter, Func func): iter(std::move(iter)), func(func), front(Option<Inner>::none()) {}
+
+            MSTL_INLINE constexpr
+            Option<Item> next() noexcept {
+                while (true) {
+                    if (front.is_some()) {
+                        auto x = front.as_ref_uncheck().next();
+                        if (x.is_some()) {
+                            return x;
+                        }
+                        front = Option<Inner>::none();
+                    }
+                    auto y = iter.next();
+                    if (y.is_none()) {
+                        return Option<Item>::none();
+                    }
+                    front = Option<Inner>::some(to_inner_iter(func(y.unwrap_unchecked())));
+                }
+            }
+
+            /// 只有当前的内层迭代器的元素是已知的; 源迭代器耗尽之前上界未知
+            MSTL_INLINE constexpr
+            SizeHint size_hint() noexcept {
+                SizeHint hint = front.is_some()
+                    ? ::mstl::iter::size_hint(front.as_ref_uncheck())
+                    : SizeHint{ 0, Option<usize>::some(0) };
+                Option<usize> outer = ::mstl::iter::size_hint(iter).upper;
+                if (outer.is_some() && outer.unwrap_unchecked() == 0) {
+                    return hint;
+                }
+                return { hint.lower, Option<usize>::none() };
+            }
+
+            /// impl InternalIterator: 在源迭代器的内部循环中依次内部迭代每个内层迭代器
+            template<typename F>
+            MSTL_INLINE constexpr
+            void for_each_internal(F&& f) {
+                if (front.is_some()) {
+                    ::mstl::iter::for_each_internal(front.as_ref_uncheck(), f);
+                    front = Option<Inner>::none();
+                }
+                ::mstl::iter::for_each_internal(iter, [&](typename Iter::Item item) {
+                    Inner inner = to_inner_iter(func(std::forward<typename Iter::Item>(item)));
+                    ::mstl::iter::for_each_internal(inner, f);
+                });
+            }
+
+            /// 提前停止时, 未迭代完的内层迭代器被保存, 之后从停止处继续
+            template<typename Acc, typename F>
+            MSTL_INLINE constexpr
+            bool try_fold(Acc& acc, F&& f) {
+                if (front.is_some()) {
+                    if (!::mstl::iter::try_fold(front.as_ref_uncheck(), acc, f)) {
+                        return false;
+                    }
+                    front = Option<Inner>::none();
+                }
+                bool stopped = false;
+                ::mstl::iter::try_fold(iter, acc, [&](Acc& a, typename Iter::Item item) {
+                    Inner inner = to_inner_iter(func(std::forward<typename Iter::Item>(item)));
+                    if (!::mstl::iter::try_fold(inner, a, f)) {
+                        stopped = true;
+                        front = Option<Inner>::some(std::move(inner));
+                        return false;
+                    }
+                    return true;
+                });
+                return !stopped;
+            }
+
+            MSTL_INLINE constexpr
+            FlatMapIter into_iter() noexcept { return *this; }
+
+        private:
+            Iter iter;
+            Func func;
+            Option<Inner> front;
+        };
+
+        template<typename Lambda>
+        class FlatMapHolder {
+        public:
+            FlatMapHolder(Lambda lambda): lambda(lambda) {}
+
+            template<typename Iter>
+            MSTL_INLINE constexpr
+            FlatMapIter<Iter, Lambda>
+            to_adapter(Iter iter) {
+                return FlatMapIter<Iter, Lambda>{ std::move(iter), lambda };
+            }
+        private:
+            Lambda lambda;
+        };
+    }
+
+    /**
+     * @brief 将每个元素转化为一个迭代器, 并依次返回这些迭代器中的元素.
+     *
+     * 转化函数可以返回迭代器, 也可以返回以`into_iter()`转化为迭代器的容器(如`Vector`).
+     * 返回容器时, 其`into_iter()`须持有元素; `Array::into_iter()`借用数组的存储, 因此不能返回`Array`.
+     *
+     * ## Example
+     * @code
+     *      Vector<i32> v = {1, 2, 3};
+     *      auto it = v.iter() | flat_map([](const i32& x) { return ops::Range<i32>(0, x); });
+     *      // 0, 0, 1, 0, 1, 2
+     * @endcode
+     */
+    template<typename Lambda>
+    MSTL_INLINE constexpr
+    _private::FlatMapHolder<Lambda>
+    flat_map(Lambda&& lambda) {
+        return _private::FlatMapHolder<Lambda>{ std::forward<Lambda>(lambda) };
+    }
+}
+
+#endif //__MODERN_STL_FLAT_MAP_H__
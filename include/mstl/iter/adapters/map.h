@@ -24,7 +24,7 @@ namespace mstl::iter {
             /// 转化后的元素类型
             using Item = std::invoke_result_t<Func, typename Iter::Item>;
 
-            MapIter(Iter iter, Func func): iter(iter), func(func) {}
+            MapIter(Iter iter, Func func): iter(std::move(iter)), func(func) {}
 
             MSTL_INLINE constexpr
             Option<Item> next() noexcept {
@@ -37,6 +37,52 @@ namespace mstl::iter {
                 }
             }
 
+            /// 转化不改变元素的数量, 因此估计与源迭代器相同
+            MSTL_INLINE constexpr
+            SizeHint size_hint() noexcept {
+                return ::mstl::iter::size_hint(iter);
+            }
+
+            /// impl ExactSizeIterator
+            MSTL_INLINE constexpr
+            usize len() noexcept requires ExactSizeIterator<Iter> {
+                return iter.len();
+            }
+
+            MSTL_INLINE constexpr
+            bool is_empty() noexcept requires ExactSizeIterator<Iter> {
+                return iter.is_empty();
+            }
+
+            /// impl ChunkedIterator: 成批取得源迭代器的元素后逐个转化
+            template<usize N>
+            MSTL_INLINE constexpr
+            IterChunk<Item, N> next_chunk() {
+                IterChunk<Item, N> chunk;
+                auto source = ::mstl::iter::next_chunk<N>(iter);
+                source.for_each([&](typename Iter::Item item) {
+                    chunk.push(func(std::forward<typename Iter::Item>(item)));
+                });
+                return chunk;
+            }
+
+            /// impl InternalIterator: 在源迭代器的内部循环中转化元素
+            template<typename F>
+            MSTL_INLINE constexpr
+            void for_each_internal(F&& f) {
+                ::mstl::iter::for_each_internal(iter, [&](typename Iter::Item item) {
+                    f(func(std::forward<typename Iter::Item>(item)));
+                });
+            }
+
+            template<typename Acc, typename F>
+            MSTL_INLINE constexpr
+            bool try_fold(Acc& acc, F&& f) {
+                return ::mstl::iter::try_fold(iter, acc, [&](Acc& a, typename Iter::Item item) {
+                    return f(a, func(std::forward<typename Iter::Item>(item)));
+                });
+            }
+
             MSTL_INLINE constexpr
             MapIter<Iter, Func>
             into_iter() noexcept { return *this; }
@@ -49,7 +95,7 @@ namespace mstl::iter {
         template<Iterator Iter, typename F>
         MSTL_INLINE constexpr MapIter<Iter, F>
         map(Iter iter, F f) noexcept {
-            return { iter, f };
+            return { std::move(iter), f };
         }
 
         template<typename Lambda>
@@ -0,0 +1,50 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef __MODERN_STL_RANDOM_ACCESS_H__
+#define __MODERN_STL_RANDOM_ACCESS_H__
+
+#include <type_traits>
+#include <mstl/intrinsics.h>
+#include <mstl/iter/iter_concepts.h>
+
+namespace mstl::iter::_private {
+    /**
+     * 以左值引用返回元素的连续迭代器.
+     *
+     * 适配器可以直接以下标访问这类迭代器的剩余元素, 从而以计数循环代替逐个调用next(), 使编译器能够向量化.
+     * 元素按值返回的连续迭代器(如ArrayIter)在返回时移出元素, 不能以下标访问.
+     */
+    template<typename Iter>
+    concept RandomAccessIterator = ContinuousIterator<Iter> && std::is_lvalue_reference_v<typename Iter::Item>;
+
+    /// 迭代器剩余元素的起始地址. 源迭代器返回可变引用时, 返回的指针也可以修改元素
+    template<RandomAccessIterator Iter>
+    MSTL_INLINE constexpr
+    std::remove_reference_t<typename Iter::Item>* element_ptr(Iter& iter) noexcept {
+        return const_cast<std::remove_reference_t<typename Iter::Item>*>(iter.start_addr());
+    }
+
+    /// 以空的回调耗尽迭代器. 对连续迭代器, 编译器会将其优化为直接移动迭代器的位置
+    template<Iterator Iter>
+    MSTL_INLINE constexpr
+    void exhaust(Iter& iter) {
+        for_each_internal(iter, [](typename Iter::Item) {});
+    }
+
+    /// 取两个上界中较小者, 未知的上界不构成约束
+    MSTL_INLINE constexpr
+    Option<usize> min_upper(Option<usize> a, Option<usize> b) noexcept {
+        if (a.is_none()) {
+            return b;
+        }
+        if (b.is_none()) {
+            return a;
+        }
+        usize x = a.unwrap_unchecked(), y = b.unwrap_unchecked();
+        return Option<usize>::some(x < y ? x : y);
+    }
+}
+
+#endif //__MODERN_STL_RANDOM_ACCESS_H__
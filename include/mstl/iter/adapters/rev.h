@@ -0,0 +1,111 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef __MODERN_STL_REV_H__
+#define __MODERN_STL_REV_H__
+
+#include <mstl/global.h>
+#include <mstl/intrinsics.h>
+#include <mstl/iter/iter_concepts.h>
+#include <mstl/iter/adapters/random_access.h>
+
+namespace mstl::iter {
+    namespace _private {
+        /// 反向迭代双向迭代器: next()与prev()互换
+        template<DoubleEndedIterator Iter>
+        class RevIter {
+        public:
+            using Item = typename Iter::Item;
+
+            RevIter(Iter iter): iter(std::move(iter)) {}
+
+            MSTL_INLINE constexpr
+            Option<Item> next() noexcept {
+                return iter.prev();
+            }
+
+            /// impl DoubleEndedIterator
+            MSTL_INLINE constexpr
+            Option<Item> prev() noexcept {
+                return iter.next();
+            }
+
+            MSTL_INLINE constexpr
+            SizeHint size_hint() noexcept {
+                return ::mstl::iter::size_hint(iter);
+            }
+
+            /// impl ExactSizeIterator
+            MSTL_INLINE constexpr
+            usize len() noexcept requires ExactSizeIterator<Iter> {
+                return iter.len();
+            }
+
+            MSTL_INLINE constexpr
+            bool is_empty() noexcept requires ExactSizeIterator<Iter> {
+                return iter.is_empty();
+            }
+
+            /// impl InternalIterator: 可下标访问时以倒序的计数循环迭代, 之后耗尽源迭代器; 否则反复调用prev()
+            template<typename F>
+            MSTL_INLINE constexpr
+            void for_each_internal(F&& f) {
+                if constexpr (RandomAccessIterator<Iter>) {
+                    auto* data = element_ptr(iter);
+                    for (usize i = iter.len(); i > 0; i--) {
+                        f(data[i - 1]);
+                    }
+                    exhaust(iter);
+                } else {
+                    for (auto prev = iter.prev(); prev.is_some(); prev = iter.prev()) {
+                        f(prev.unwrap_unchecked());
+                    }
+                }
+            }
+
+            template<typename Acc, typename F>
+            MSTL_INLINE constexpr
+            bool try_fold(Acc& acc, F&& f) {
+                for (auto prev = iter.prev(); prev.is_some(); prev = iter.prev()) {
+                    if (!f(acc, prev.unwrap_unchecked())) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            MSTL_INLINE constexpr
+            RevIter into_iter() noexcept { return *this; }
+
+        private:
+            Iter iter;
+        };
+
+        class RevHolder {
+        public:
+            template<DoubleEndedIterator Iter>
+            MSTL_INLINE constexpr
+            RevIter<Iter> to_adapter(Iter iter) {
+                return RevIter<Iter>{ std::move(iter) };
+            }
+        };
+    }
+
+    /**
+     * @brief 反向迭代, 要求源迭代器实现DoubleEndedIterator. 保留源迭代器的ExactSizeIterator.
+     *
+     * ## Example
+     * @code
+     *      Vector<i32> v = {1, 2, 3};
+     *      auto it = v.iter() | rev();
+     *      // 3, 2, 1
+     * @endcode
+     */
+    MSTL_INLINE inline
+    _private::RevHolder rev() {
+        return {};
+    }
+}
+
+#endif //__MODERN_STL_REV_H__
@@ -0,0 +1,245 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef __MODERN_STL_SKIP_H__
+#define __MODERN_STL_SKIP_H__
+
+#include <mstl/global.h>
+#include <mstl/intrinsics.h>
+#include <mstl/ops/callable.h>
+#include <mstl/iter/iter_concepts.h>
+
+namespace mstl::iter {
+    namespace _private {
+        /// 跳过源迭代器的前n个元素. 元素在第一次取得元素时才被跳过; 源迭代器是连续迭代器时, skip后仍是连续迭代器
+        template<Iterator Iter>
+        class SkipIter {
+        public:
+            using Item = typename Iter::Item;
+
+            SkipIter(Iter iter, usize n): iter(std::move(iter)), n(n) {}
+
+            MSTL_INLINE constexpr
+            Option<Item> next() noexcept {
+                skip();
+                return iter.next();
+            }
+
+            /// impl DoubleEndedIterator: 尾部的元素在被跳过的元素之后时才返回
+            MSTL_INLINE constexpr
+            Option<Item> prev() noexcept requires DoubleEndedIterator<Iter> && ExactSizeIterator<Iter> {
+                if (len() == 0) {
+                    return Option<Item>::none();
+                }
+                return iter.prev();
+            }
+
+            MSTL_INLINE constexpr
+            SizeHint size_hint() noexcept {
+                SizeHint hint = ::mstl::iter::size_hint(iter);
+                Option<usize> upper = hint.upper.is_some()
+                    ? Option<usize>::some(saturating_sub(hint.upper.unwrap_unchecked()))
+                    : Option<usize>::none();
+                return { saturating_sub(hint.lower), upper };
+            }
+
+            /// impl ExactSizeIterator
+            MSTL_INLINE constexpr
+            usize len() noexcept requires ExactSizeIterator<Iter> {
+                return saturating_sub(iter.len());
+            }
+
+            MSTL_INLINE constexpr
+            bool is_empty() noexcept requires ExactSizeIterator<Iter> {
+                return len() == 0;
+            }
+
+            /// impl ContinuousIterator: 尚未跳过的元素不计入
+            MSTL_INLINE constexpr
+            const std::remove_reference_t<Item>* start_addr() noexcept requires ContinuousIterator<Iter> {
+                usize rest = iter.len();
+                return iter.start_addr() + (n < rest ? n : rest);
+            }
+
+            /// impl InternalIterator: 跳过前n个元素后使用源迭代器的内部迭代
+            template<typename F>
+            MSTL_INLINE constexpr
+            void for_each_internal(F&& f) {
+                skip();
+                ::mstl::iter::for_each_internal(iter, f);
+            }
+
+            template<typename Acc, typename F>
+            MSTL_INLINE constexpr
+            bool try_fold(Acc& acc, F&& f) {
+                skip();
+                return ::mstl::iter::try_fold(iter, acc, f);
+            }
+
+            MSTL_INLINE constexpr
+            SkipIter into_iter() noexcept { return *this; }
+
+        private:
+            MSTL_INLINE constexpr
+            void skip() {
+                for (; n > 0; n--) {
+                    if (iter.next().is_none()) {
+                        n = 0;
+                        return;
+                    }
+                }
+            }
+
+            MSTL_INLINE constexpr
+            usize saturating_sub(usize count) const noexcept {
+                return count > n ? count - n : 0;
+            }
+
+            Iter iter;
+            usize n;
+        };
+
+        /// 跳过源迭代器开头满足predicate的元素, 之后返回所有元素
+        template<Iterator Iter, typename P>
+        requires ops::Predicate<P, typename Iter::Item&>
+        class SkipWhileIter {
+        public:
+            using Item = typename Iter::Item;
+
+            SkipWhileIter(Iter iter, P predicate): iter(std::move(iter)), predicate(predicate), started(false) {}
+
+            MSTL_INLINE constexpr
+            Option<Item> next() noexcept {
+                if (started) {
+                    return iter.next();
+                }
+                started = true;
+                for (auto next = iter.next(); next.is_some(); next = iter.next()) {
+                    if (!predicate(next.as_ref_uncheck())) {
+                        return next;
+                    }
+                }
+                return Option<Item>::none();
+            }
+
+            /// 开头的元素可能全部被跳过, 因此在跳过之前下界为0
+            MSTL_INLINE constexpr
+            SizeHint size_hint() noexcept {
+                SizeHint hint = ::mstl::iter::size_hint(iter);
+                return { started ? hint.lower : 0, hint.upper };
+            }
+
+            /// impl InternalIterator: 找到第一个不满足predicate的元素后使用源迭代器的内部迭代
+            template<typename F>
+            MSTL_INLINE constexpr
+            void for_each_internal(F&& f) {
+                if (!started) {
+                    started = true;
+                    bool unused = true;
+                    ::mstl::iter::try_fold(iter, unused, [&](bool&, Item item) {
+                        if (predicate(item)) {
+                            return true;
+                        }
+                        f(std::forward<Item>(item));
+                        return false;
+                    });
+                }
+                ::mstl::iter::for_each_internal(iter, f);
+            }
+
+            template<typename Acc, typename F>
+            MSTL_INLINE constexpr
+            bool try_fold(Acc& acc, F&& f) {
+                if (!started) {
+                    started = true;
+                    bool stopped = false;
+                    bool exhausted = ::mstl::iter::try_fold(iter, acc, [&](Acc& a, Item item) {
+                        if (predicate(item)) {
+                            return true;
+                        }
+                        stopped = !f(a, std::forward<Item>(item));
+                        return false;
+                    });
+                    if (exhausted) {
+                        return true;
+                    }
+                    if (stopped) {
+                        return false;
+                    }
+                }
+                return ::mstl::iter::try_fold(iter, acc, f);
+            }
+
+            MSTL_INLINE constexpr
+            SkipWhileIter into_iter() noexcept { return *this; }
+
+        private:
+            Iter iter;
+            P predicate;
+            bool started;
+        };
+
+        class SkipHolder {
+        public:
+            SkipHolder(usize n): n(n) {}
+
+            template<Iterator Iter>
+            MSTL_INLINE constexpr
+            SkipIter<Iter> to_adapter(Iter iter) {
+                return SkipIter<Iter>{ std::move(iter), n };
+            }
+        private:
+            usize n;
+        };
+
+        template<typename P>
+        class SkipWhileHolder {
+        public:
+            SkipWhileHolder(P predicate): predicate(predicate) {}
+
+            template<Iterator Iter>
+            MSTL_INLINE constexpr
+            SkipWhileIter<Iter, P> to_adapter(Iter iter) {
+                return SkipWhileIter<Iter, P>{ std::move(iter), predicate };
+            }
+        private:
+            P predicate;
+        };
+    }
+
+    /**
+     * @brief 跳过前n个元素.
+     *
+     * 保留源迭代器的ExactSizeIterator, DoubleEndedIterator与ContinuousIterator.
+     *
+     * ## Example
+     * @code
+     *      Vector<i32> v = {1, 2, 3, 4};
+     *      i32 s = v.iter() | skip(1) | take(2) | sum();
+     *      // 5
+     * @endcode
+     */
+    MSTL_INLINE inline
+    _private::SkipHolder skip(usize n) {
+        return { n };
+    }
+
+    /**
+     * @brief 跳过开头满足predicate的元素, 之后返回所有元素.
+     *
+     * ## Example
+     * @code
+     *      Vector<i32> v = {0, 0, 3, 0};
+     *      auto it = v.iter() | skip_while([](const i32& x) { return x == 0; });
+     *      // 3, 0
+     * @endcode
+     */
+    template<typename P>
+    MSTL_INLINE constexpr
+    _private::SkipWhileHolder<P> skip_while(P&& predicate) {
+        return { std::forward<P>(predicate) };
+    }
+}
+
+#endif //__MODERN_STL_SKIP_H__
@@ -0,0 +1,175 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef __MODERN_STL_STEP_BY_H__
+#define __MODERN_STL_STEP_BY_H__
+
+#include <mstl/global.h>
+#include <mstl/intrinsics.h>
+#include <mstl/iter/iter_concepts.h>
+#include <mstl/iter/adapters/random_access.h>
+
+namespace mstl::iter {
+    namespace _private {
+        /// 返回源迭代器的第一个元素, 之后每step个元素返回一个
+        template<Iterator Iter>
+        class StepByIter {
+        public:
+            using Item = typename Iter::Item;
+
+            StepByIter(Iter iter, usize step): iter(std::move(iter)), step(step), first(true) {
+                if (step == 0) {
+                    MSTL_PANIC("step_by: step must be greater than 0");
+                }
+            }
+
+            MSTL_INLINE constexpr
+            Option<Item> next() noexcept {
+                if (first) {
+                    first = false;
+                    return iter.next();
+                }
+                for (usize i = 1; i < step; i++) {
+                    if (iter.next().is_none()) {
+                        return Option<Item>::none();
+                    }
+                }
+                return iter.next();
+            }
+
+            /// impl DoubleEndedIterator: 先从尾部丢弃最后一个被返回的元素之后的元素
+            MSTL_INLINE constexpr
+            Option<Item> prev() noexcept requires DoubleEndedIterator<Iter> && ExactSizeIterator<Iter> {
+                usize rest = iter.len();
+                if (count(rest) == 0) {
+                    return Option<Item>::none();
+                }
+                usize extra = first ? (rest - 1) % step : rest % step;
+                for (usize i = 0; i < extra; i++) {
+                    iter.prev();
+                }
+                return iter.prev();
+            }
+
+            MSTL_INLINE constexpr
+            SizeHint size_hint() noexcept {
+                SizeHint hint = ::mstl::iter::size_hint(iter);
+                Option<usize> upper = hint.upper.is_some()
+                    ? Option<usize>::some(count(hint.upper.unwrap_unchecked()))
+                    : Option<usize>::none();
+                return { count(hint.lower), upper };
+            }
+
+            /// impl ExactSizeIterator
+            MSTL_INLINE constexpr
+            usize len() noexcept requires ExactSizeIterator<Iter> {
+                return count(iter.len());
+            }
+
+            MSTL_INLINE constexpr
+            bool is_empty() noexcept requires ExactSizeIterator<Iter> {
+                return len() == 0;
+            }
+
+            /**
+             * impl InternalIterator
+             *
+             * 可下标访问时以步长为step的计数循环迭代, 之后耗尽源迭代器; 否则在源迭代器的内部循环中计数.
+             */
+            template<typename F>
+            MSTL_INLINE constexpr
+            void for_each_internal(F&& f) {
+                usize gap = first ? 0 : step - 1;
+                first = false;
+                if constexpr (RandomAccessIterator<Iter>) {
+                    auto* data = element_ptr(iter);
+                    const usize rest = iter.len();
+                    for (usize i = gap; i < rest; i += step) {
+                        f(data[i]);
+                    }
+                    exhaust(iter);
+                } else {
+                    ::mstl::iter::for_each_internal(iter, [&](Item item) {
+                        if (gap != 0) {
+                            gap--;
+                            return;
+                        }
+                        gap = step - 1;
+                        f(std::forward<Item>(item));
+                    });
+                }
+            }
+
+            template<typename Acc, typename F>
+            MSTL_INLINE constexpr
+            bool try_fold(Acc& acc, F&& f) {
+                usize gap = first ? 0 : step - 1;
+                first = false;
+                bool stopped = false;
+                ::mstl::iter::try_fold(iter, acc, [&](Acc& a, Item item) {
+                    if (gap != 0) {
+                        gap--;
+                        return true;
+                    }
+                    gap = step - 1;
+                    if (!f(a, std::forward<Item>(item))) {
+                        stopped = true;
+                        return false;
+                    }
+                    return true;
+                });
+                return !stopped;
+            }
+
+            MSTL_INLINE constexpr
+            StepByIter into_iter() noexcept { return *this; }
+
+        private:
+            /// 源迭代器剩余rest个元素时, 将被返回的元素数量
+            MSTL_INLINE constexpr
+            usize count(usize rest) const noexcept {
+                if (first) {
+                    return rest == 0 ? 0 : 1 + (rest - 1) / step;
+                }
+                return rest / step;
+            }
+
+            Iter iter;
+            usize step;
+            bool first;
+        };
+
+        class StepByHolder {
+        public:
+            StepByHolder(usize step): step(step) {}
+
+            template<Iterator Iter>
+            MSTL_INLINE constexpr
+            StepByIter<Iter> to_adapter(Iter iter) {
+                return StepByIter<Iter>{ std::move(iter), step };
+            }
+        private:
+            usize step;
+        };
+    }
+
+    /**
+     * @brief 返回第一个元素, 之后每step个元素返回一个. step不能为0.
+     *
+     * 源迭代器可以下标访问时, 内部迭代是步长为step的计数循环.
+     *
+     * ## Example
+     * @code
+     *      Vector<i32> v = {0, 1, 2, 3, 4};
+     *      auto it = v.iter() | step_by(2);
+     *      // 0, 2, 4
+     * @endcode
+     */
+    MSTL_INLINE inline
+    _private::StepByHolder step_by(usize step) {
+        return { step };
+    }
+}
+
+#endif //__MODERN_STL_STEP_BY_H__
@@ -0,0 +1,268 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef __MODERN_STL_TAKE_H__
+#define __MODERN_STL_TAKE_H__
+
+#include <mstl/global.h>
+#include <mstl/intrinsics.h>
+#include <mstl/ops/callable.h>
+#include <mstl/iter/iter_concepts.h>
+#include <mstl/iter/adapters/random_access.h>
+
+namespace mstl::iter {
+    namespace _private {
+        /// 至多返回源迭代器的前n个元素. 源迭代器是连续迭代器时, take后仍是连续迭代器
+        template<Iterator Iter>
+        class TakeIter {
+        public:
+            using Item = typename Iter::Item;
+
+            TakeIter(Iter iter, usize n): iter(std::move(iter)), n(n) {}
+
+            MSTL_INLINE constexpr
+            Option<Item> next() noexcept {
+                if (n == 0) {
+                    return Option<Item>::none();
+                }
+                n--;
+                return iter.next();
+            }
+
+            /// impl DoubleEndedIterator: 先从尾部丢弃第n个之后的元素
+            MSTL_INLINE constexpr
+            Option<Item> prev() noexcept requires DoubleEndedIterator<Iter> && ExactSizeIterator<Iter> {
+                if (n == 0) {
+                    return Option<Item>::none();
+                }
+                while (iter.len() > n) {
+                    iter.prev();
+                }
+                n--;
+                return iter.prev();
+            }
+
+            MSTL_INLINE constexpr
+            SizeHint size_hint() noexcept {
+                SizeHint hint = ::mstl::iter::size_hint(iter);
+                return {
+                    hint.lower < n ? hint.lower : n,
+                    min_upper(hint.upper, Option<usize>::some(n))
+                };
+            }
+
+            /// impl ExactSizeIterator
+            MSTL_INLINE constexpr
+            usize len() noexcept requires ExactSizeIterator<Iter> {
+                usize rest = iter.len();
+                return rest < n ? rest : n;
+            }
+
+            MSTL_INLINE constexpr
+            bool is_empty() noexcept requires ExactSizeIterator<Iter> {
+                return n == 0 || iter.is_empty();
+            }
+
+            /// impl ContinuousIterator
+            MSTL_INLINE constexpr
+            const std::remove_reference_t<Item>* start_addr() noexcept requires ContinuousIterator<Iter> {
+                return iter.start_addr();
+            }
+
+            /**
+             * impl InternalIterator
+             *
+             * 剩余元素不多于n个时直接使用源迭代器的内部迭代; 可下标访问时以计数循环迭代前n个;
+             * 否则以try_fold计数, 第n个元素之后停止.
+             */
+            template<typename F>
+            MSTL_INLINE constexpr
+            void for_each_internal(F&& f) {
+                if (n == 0) {
+                    return;
+                }
+                if constexpr (ExactSizeIterator<Iter>) {
+                    if (iter.len() <= n) {
+                        n = 0;
+                        ::mstl::iter::for_each_internal(iter, f);
+                        return;
+                    }
+                }
+                if constexpr (RandomAccessIterator<Iter>) {
+                    auto* data = element_ptr(iter);
+                    for (usize i = 0; i < n; i++) {
+                        f(data[i]);
+                    }
+                    n = 0;
+                } else {
+                    bool unused = true;
+                    try_fold(unused, [&](bool&, Item item) {
+                        f(std::forward<Item>(item));
+                        return true;
+                    });
+                }
+            }
+
+            template<typename Acc, typename F>
+            MSTL_INLINE constexpr
+            bool try_fold(Acc& acc, F&& f) {
+                if (n == 0) {
+                    return true;
+                }
+                bool stopped = false;
+                ::mstl::iter::try_fold(iter, acc, [&](Acc& a, Item item) {
+                    n--;
+                    if (!f(a, std::forward<Item>(item))) {
+                        stopped = true;
+                        return false;
+                    }
+                    return n != 0;
+                });
+                return !stopped;
+            }
+
+            MSTL_INLINE constexpr
+            TakeIter into_iter() noexcept { return *this; }
+
+        private:
+            Iter iter;
+            usize n;
+        };
+
+        /// 返回源迭代器的元素, 直到第一个不满足predicate的元素. 该元素被消耗但不被返回
+        template<Iterator Iter, typename P>
+        requires ops::Predicate<P, typename Iter::Item&>
+        class TakeWhileIter {
+        public:
+            using Item = typename Iter::Item;
+
+            TakeWhileIter(Iter iter, P predicate): iter(std::move(iter)), predicate(predicate), done(false) {}
+
+            MSTL_INLINE constexpr
+            Option<Item> next() noexcept {
+                if (done) {
+                    return Option<Item>::none();
+                }
+                auto x = iter.next();
+                if (x.is_some() && !predicate(x.as_ref_uncheck())) {
+                    done = true;
+                    return Option<Item>::none();
+                }
+                return x;
+            }
+
+            /// 元素可能在任何位置停止, 因此下界为0
+            MSTL_INLINE constexpr
+            SizeHint size_hint() noexcept {
+                if (done) {
+                    return { 0, Option<usize>::some(0) };
+                }
+                return { 0, ::mstl::iter::size_hint(iter).upper };
+            }
+
+            /// impl InternalIterator
+            template<typename F>
+            MSTL_INLINE constexpr
+            void for_each_internal(F&& f) {
+                bool unused = true;
+                try_fold(unused, [&](bool&, Item item) {
+                    f(std::forward<Item>(item));
+                    return true;
+                });
+            }
+
+            template<typename Acc, typename F>
+            MSTL_INLINE constexpr
+            bool try_fold(Acc& acc, F&& f) {
+                if (done) {
+                    return true;
+                }
+                bool stopped = false;
+                ::mstl::iter::try_fold(iter, acc, [&](Acc& a, Item item) {
+                    if (!predicate(item)) {
+                        done = true;
+                        return false;
+                    }
+                    if (!f(a, std::forward<Item>(item))) {
+                        stopped = true;
+                        return false;
+                    }
+                    return true;
+                });
+                return !stopped;
+            }
+
+            MSTL_INLINE constexpr
+            TakeWhileIter into_iter() noexcept { return *this; }
+
+        private:
+            Iter iter;
+            P predicate;
+            bool done;
+        };
+
+        class TakeHolder {
+        public:
+            TakeHolder(usize n): n(n) {}
+
+            template<Iterator Iter>
+            MSTL_INLINE constexpr
+            TakeIter<Iter> to_adapter(Iter iter) {
+                return TakeIter<Iter>{ std::move(iter), n };
+            }
+        private:
+            usize n;
+        };
+
+        template<typename P>
+        class TakeWhileHolder {
+        public:
+            TakeWhileHolder(P predicate): predicate(predicate) {}
+
+            template<Iterator Iter>
+            MSTL_INLINE constexpr
+            TakeWhileIter<Iter, P> to_adapter(Iter iter) {
+                return TakeWhileIter<Iter, P>{ std::move(iter), predicate };
+            }
+        private:
+            P predicate;
+        };
+    }
+
+    /**
+     * @brief 至多返回前n个元素.
+     *
+     * 保留源迭代器的ExactSizeIterator, DoubleEndedIterator与ContinuousIterator,
+     * 因此`v.iter() | take(n) | sum()`仍使用SIMD实现.
+     *
+     * ## Example
+     * @code
+     *      Vector<i32> v = {1, 2, 3, 4};
+     *      i32 s = v.iter() | take(2) | sum();
+     *      // 3
+     * @endcode
+     */
+    MSTL_INLINE inline
+    _private::TakeHolder take(usize n) {
+        return { n };
+    }
+
+    /**
+     * @brief 返回元素直到第一个不满足predicate的元素, 该元素被消耗但不被返回.
+     *
+     * ## Example
+     * @code
+     *      Vector<i32> v = {1, 2, 5, 1};
+     *      i32 s = v.iter() | take_while([](const i32& x) { return x < 3; }) | sum();
+     *      // 3
+     * @endcode
+     */
+    template<typename P>
+    MSTL_INLINE constexpr
+    _private::TakeWhileHolder<P> take_while(P&& predicate) {
+        return { std::forward<P>(predicate) };
+    }
+}
+
+#endif //__MODERN_STL_TAKE_H__
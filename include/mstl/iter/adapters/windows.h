@@ -0,0 +1,132 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef __MODERN_STL_WINDOWS_H__
+#define __MODERN_STL_WINDOWS_H__
+
+#include <mstl/global.h>
+#include <mstl/intrinsics.h>
+#include <mstl/slice.h>
+#include <mstl/iter/iter_concepts.h>
+#include <mstl/iter/adapters/chunks.h>
+
+namespace mstl::iter {
+    namespace _private {
+        /// 每次返回size个连续元素的Slice, 相邻的窗口重叠size - 1个元素
+        template<ContinuousIterator Iter>
+        class WindowsIter: ContinuousCursor<Iter> {
+            using Base = ContinuousCursor<Iter>;
+            using Base::base;
+            using Base::remaining;
+            using Base::pos;
+            using Base::end;
+        public:
+            using Elem = typename Base::Elem;
+            using Item = Slice<Elem>;
+
+            WindowsIter(Iter iter, usize size): Base(std::move(iter)), size(size) {
+                if (size == 0) {
+                    MSTL_PANIC("windows: size must be greater than 0");
+                }
+            }
+
+            MSTL_INLINE constexpr
+            Option<Item> next() noexcept {
+                if (remaining() < size) {
+                    return Option<Item>::none();
+                }
+                Item window = Item::from_raw(base() + pos, size);
+                pos++;
+                return Option<Item>::some(window);
+            }
+
+            /// impl DoubleEndedIterator
+            MSTL_INLINE constexpr
+            Option<Item> prev() noexcept {
+                if (remaining() < size) {
+                    return Option<Item>::none();
+                }
+                end--;
+                return Option<Item>::some(Item::from_raw(base() + end + 1 - size, size));
+            }
+
+            /// impl ExactSizeIterator
+            MSTL_INLINE constexpr
+            usize len() noexcept {
+                return remaining() < size ? 0 : remaining() - size + 1;
+            }
+
+            MSTL_INLINE constexpr
+            bool is_empty() noexcept {
+                return remaining() < size;
+            }
+
+            MSTL_INLINE constexpr
+            SizeHint size_hint() noexcept {
+                return { len(), Option<usize>::some(len()) };
+            }
+
+            /// impl InternalIterator
+            template<typename F>
+            MSTL_INLINE constexpr
+            void for_each_internal(F&& f) {
+                Elem* data = base();
+                for (; remaining() >= size; pos++) {
+                    f(Item::from_raw(data + pos, size));
+                }
+            }
+
+            template<typename Acc, typename F>
+            MSTL_INLINE constexpr
+            bool try_fold(Acc& acc, F&& f) {
+                Elem* data = base();
+                while (remaining() >= size) {
+                    Item window = Item::from_raw(data + pos, size);
+                    pos++;
+                    if (!f(acc, window)) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            MSTL_INLINE constexpr
+            WindowsIter into_iter() noexcept { return *this; }
+
+        private:
+            usize size;
+        };
+
+        class WindowsHolder {
+        public:
+            WindowsHolder(usize size): size(size) {}
+
+            template<ContinuousIterator Iter>
+            MSTL_INLINE constexpr
+            WindowsIter<Iter> to_adapter(Iter iter) {
+                return WindowsIter<Iter>{ std::move(iter), size };
+            }
+        private:
+            usize size;
+        };
+    }
+
+    /**
+     * @brief 返回连续迭代器上所有长度为size的滑动窗口, 每个窗口以`Slice`的形式返回, 不复制元素.
+     * 元素少于size个时不返回任何窗口.
+     *
+     * ## Example
+     * @code
+     *      Vector<i32> v = {1, 2, 3, 4};
+     *      auto it = v.iter() | windows(3);
+     *      // [1, 2, 3], [2, 3, 4]
+     * @endcode
+     */
+    MSTL_INLINE inline
+    _private::WindowsHolder windows(usize size) {
+        return { size };
+    }
+}
+
+#endif //__MODERN_STL_WINDOWS_H__
@@ -0,0 +1,255 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef __MODERN_STL_ZIP_H__
+#define __MODERN_STL_ZIP_H__
+
+#include <mstl/global.h>
+#include <mstl/intrinsics.h>
+#include <mstl/utility/tuple.h>
+#include <mstl/iter/iter_concepts.h>
+#include <mstl/iter/adapters/random_access.h>
+
+namespace mstl::iter {
+    namespace _private {
+        /**
+         * 同时迭代两个迭代器, 返回由两者的元素组成的二元组, 其中任一耗尽时停止.
+         *
+         * 两者都是以引用返回元素的连续迭代器时, 使用下面的特化, 以下标同时访问两者.
+         */
+        template<Iterator A, Iterator B, bool = RandomAccessIterator<A> && RandomAccessIterator<B>>
+        class ZipIter {
+        public:
+            using Item = utility::Tuple<typename A::Item, typename B::Item>;
+
+            ZipIter(A a, B b): a(std::move(a)), b(std::move(b)) {}
+
+            MSTL_INLINE constexpr
+            Option<Item> next() noexcept {
+                auto x = a.next();
+                if (x.is_none()) {
+                    return Option<Item>::none();
+                }
+                auto y = b.next();
+                if (y.is_none()) {
+                    return Option<Item>::none();
+                }
+                return Option<Item>::some(Item{ x.unwrap_unchecked(), y.unwrap_unchecked() });
+            }
+
+            /// impl DoubleEndedIterator: 先从较长者的尾部丢弃多出的元素, 使两者对齐
+            MSTL_INLINE constexpr
+            Option<Item> prev() noexcept
+            requires DoubleEndedIterator<A> && DoubleEndedIterator<B> &&
+                     ExactSizeIterator<A> && ExactSizeIterator<B> {
+                while (a.len() > b.len()) {
+                    a.prev();
+                }
+                while (b.len() > a.len()) {
+                    b.prev();
+                }
+                auto x = a.prev();
+                auto y = b.prev();
+                if (x.is_none() || y.is_none()) {
+                    return Option<Item>::none();
+                }
+                return Option<Item>::some(Item{ x.unwrap_unchecked(), y.unwrap_unchecked() });
+            }
+
+            MSTL_INLINE constexpr
+            SizeHint size_hint() noexcept {
+                SizeHint x = ::mstl::iter::size_hint(a), y = ::mstl::iter::size_hint(b);
+                return { x.lower < y.lower ? x.lower : y.lower, min_upper(x.upper, y.upper) };
+            }
+
+            /// impl ExactSizeIterator
+            MSTL_INLINE constexpr
+            usize len() noexcept requires ExactSizeIterator<A> && ExactSizeIterator<B> {
+                usize x = a.len(), y = b.len();
+                return x < y ? x : y;
+            }
+
+            MSTL_INLINE constexpr
+            bool is_empty() noexcept requires ExactSizeIterator<A> && ExactSizeIterator<B> {
+                return a.is_empty() || b.is_empty();
+            }
+
+            /// impl InternalIterator: 在a的内部循环中逐个取得b的元素, b耗尽时停止
+            template<typename F>
+            MSTL_INLINE constexpr
+            void for_each_internal(F&& f) {
+                bool unused = true;
+                ::mstl::iter::try_fold(a, unused, [&](bool&, typename A::Item x) {
+                    auto y = b.next();
+                    if (y.is_none()) {
+                        return false;
+                    }
+                    f(Item{ std::forward<typename A::Item>(x), y.unwrap_unchecked() });
+                    return true;
+                });
+            }
+
+            template<typename Acc, typename F>
+            MSTL_INLINE constexpr
+            bool try_fold(Acc& acc, F&& f) {
+                bool stopped = false;
+                ::mstl::iter::try_fold(a, acc, [&](Acc& inner, typename A::Item x) {
+                    auto y = b.next();
+                    if (y.is_none()) {
+                        return false;
+                    }
+                    if (!f(inner, Item{ std::forward<typename A::Item>(x), y.unwrap_unchecked() })) {
+                        stopped = true;
+                        return false;
+                    }
+                    return true;
+                });
+                return !stopped;
+            }
+
+            MSTL_INLINE constexpr
+            ZipIter into_iter() noexcept { return *this; }
+
+        private:
+            A a;
+            B b;
+        };
+
+        /**
+         * 两者都可以下标访问时, 只记录共同的位置[pos, end), 不推进源迭代器.
+         * 内部迭代是一个计数循环, 在`zip | map | sum`等管道中可以被向量化.
+         */
+        template<Iterator A, Iterator B>
+        class ZipIter<A, B, true> {
+        public:
+            using Item = utility::Tuple<typename A::Item, typename B::Item>;
+
+            ZipIter(A a, B b): a(std::move(a)), b(std::move(b)), pos(0) {
+                usize x = this->a.len(), y = this->b.len();
+                end = x < y ? x : y;
+            }
+
+            MSTL_INLINE constexpr
+            Option<Item> next() noexcept {
+                if (pos == end) {
+                    return Option<Item>::none();
+                }
+                usize i = pos++;
+                return Option<Item>::some(Item{ element_ptr(a)[i], element_ptr(b)[i] });
+            }
+
+            /// impl DoubleEndedIterator
+            MSTL_INLINE constexpr
+            Option<Item> prev() noexcept {
+                if (pos == end) {
+                    return Option<Item>::none();
+                }
+                end--;
+                return Option<Item>::some(Item{ element_ptr(a)[end], element_ptr(b)[end] });
+            }
+
+            /// impl ExactSizeIterator
+            MSTL_INLINE constexpr
+            usize len() noexcept {
+                return end - pos;
+            }
+
+            MSTL_INLINE constexpr
+            bool is_empty() noexcept {
+                return pos == end;
+            }
+
+            MSTL_INLINE constexpr
+            SizeHint size_hint() noexcept {
+                return { len(), Option<usize>::some(len()) };
+            }
+
+            /// impl InternalIterator
+            template<typename F>
+            MSTL_INLINE constexpr
+            void for_each_internal(F&& f) {
+                auto* x = element_ptr(a);
+                auto* y = element_ptr(b);
+                const usize first = pos, last = end;
+                pos = end;
+                for (usize i = first; i < last; i++) {
+                    f(Item{ x[i], y[i] });
+                }
+            }
+
+            template<typename Acc, typename F>
+            MSTL_INLINE constexpr
+            bool try_fold(Acc& acc, F&& f) {
+                auto* x = element_ptr(a);
+                auto* y = element_ptr(b);
+                while (pos < end) {
+                    usize i = pos++;
+                    if (!f(acc, Item{ x[i], y[i] })) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            MSTL_INLINE constexpr
+            ZipIter into_iter() noexcept { return *this; }
+
+        private:
+            A a;
+            B b;
+            usize pos;
+            usize end;
+        };
+
+        template<Iterator Other>
+        class ZipHolder {
+        public:
+            ZipHolder(Other other): other(std::move(other)) {}
+
+            template<Iterator Iter>
+            MSTL_INLINE constexpr
+            ZipIter<Iter, Other> to_adapter(Iter iter) {
+                return ZipIter<Iter, Other>{ std::move(iter), std::move(other) };
+            }
+        private:
+            Other other;
+        };
+    }
+
+    /**
+     * @brief 同时迭代a与b, 每次返回由两者的元素组成的`Tuple`, 其中任一耗尽时停止.
+     *
+     * 两者都是以引用返回元素的连续迭代器(如`Vector::iter()`)时, 以下标同时访问两者, 其内部迭代可以被向量化.
+     *
+     * ## Example
+     * @code
+     *      Vector<f32> x = {1, 2, 3}, y = {4, 5, 6};
+     *      f32 dot = zip(x.iter(), y.iter())
+     *          | map([](auto p) { return get<0>(p) * get<1>(p); })
+     *          | sum();
+     *      // 32
+     * @endcode
+     */
+    template<Iterator A, Iterator B>
+    MSTL_INLINE constexpr
+    _private::ZipIter<A, B> zip(A a, B b) {
+        return { std::move(a), std::move(b) };
+    }
+
+    /**
+     * @brief 以适配器的形式同时迭代源迭代器与other, 与`zip(iter, other)`相同.
+     *
+     * ## Example
+     * @code
+     *      auto pairs = x.iter() | zip(y.iter());
+     * @endcode
+     */
+    template<Iterator Other>
+    MSTL_INLINE constexpr
+    _private::ZipHolder<Other> zip(Other other) {
+        return { std::move(other) };
+    }
+}
+
+#endif //__MODERN_STL_ZIP_H__
@@ -0,0 +1,122 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef __MODERN_STL_ITER_CHUNK_H__
+#define __MODERN_STL_ITER_CHUNK_H__
+
+#include <memory>
+#include <type_traits>
+#include <mstl/global.h>
+#include <mstl/intrinsics.h>
+
+namespace mstl::iter {
+    /**
+     * @brief 由`next_chunk<N>()`返回的, 位于栈上的至多N个元素.
+     *
+     * Item为引用时只保存指针; 否则在未初始化的空间中构造元素, 并在析构时销毁尚未被取走的元素.
+     *
+     * ## Example
+     * @code
+     *      auto chunk = list.iter().next_chunk<16>();
+     *      for (usize i = 0; i < chunk.len(); i++) {
+     *          use(chunk[i]);
+     *      }
+     * @endcode
+     */
+    template<typename Item, usize N>
+    class IterChunk {
+        static_assert(N > 0, "IterChunk must hold at least one element");
+
+        static constexpr bool IS_REF = std::is_reference_v<Item>;
+        using Elem = std::remove_reference_t<Item>;
+        using Slot = std::conditional_t<IS_REF, Elem*, Item>;
+
+    public:
+        /// 由take()返回的类型: 引用保持不变, 值以右值引用的形式移出
+        using Ref = std::conditional_t<IS_REF, Item, Item&&>;
+
+        constexpr IterChunk() noexcept {}
+
+        constexpr IterChunk(IterChunk&& other) noexcept(std::is_nothrow_move_constructible_v<Slot>): size(other.size) {
+            for (usize i = 0; i < size; i++) {
+                std::construct_at(slots + i, std::move(other.slots[i]));
+            }
+        }
+
+        IterChunk(const IterChunk&) = delete;
+        IterChunk& operator=(const IterChunk&) = delete;
+        IterChunk& operator=(IterChunk&&) = delete;
+
+        constexpr ~IterChunk() {
+            if constexpr (!std::is_trivially_destructible_v<Slot>) {
+                std::destroy(slots, slots + size);
+            }
+        }
+
+        MSTL_INLINE constexpr
+        usize len() const noexcept {
+            return size;
+        }
+
+        MSTL_INLINE constexpr
+        bool is_empty() const noexcept {
+            return size == 0;
+        }
+
+        MSTL_INLINE constexpr
+        bool is_full() const noexcept {
+            return size == N;
+        }
+
+        MSTL_INLINE constexpr
+        static usize capacity() noexcept {
+            return N;
+        }
+
+        /// 追加一个元素, 调用者须保证未满
+        MSTL_INLINE constexpr
+        void push(Item item) noexcept(IS_REF || std::is_nothrow_move_constructible_v<Item>) {
+            MSTL_DEBUG_ASSERT(size < N, "IterChunk: push into a full chunk");
+            if constexpr (IS_REF) {
+                slots[size] = std::addressof(item);
+            } else {
+                std::construct_at(slots + size, std::move(item));
+            }
+            size++;
+        }
+
+        MSTL_INLINE constexpr
+        Elem& operator[](usize pos) noexcept {
+            MSTL_DEBUG_ASSERT(pos < size, "IterChunk: index out of boundary");
+            if constexpr (IS_REF) {
+                return *slots[pos];
+            } else {
+                return slots[pos];
+            }
+        }
+
+        /// 取得第pos个元素以传递给消费者. 元素为值时被移出, 之后不应再次访问
+        MSTL_INLINE constexpr
+        Ref take(usize pos) noexcept {
+            return static_cast<Ref>((*this)[pos]);
+        }
+
+        /// 依次以take(i)调用f
+        template<typename F>
+        MSTL_INLINE constexpr
+        void for_each(F&& f) {
+            for (usize i = 0; i < size; i++) {
+                f(take(i));
+            }
+        }
+
+    private:
+        union {
+            Slot slots[N];
+        };
+        usize size = 0;
+    };
+}
+
+#endif //__MODERN_STL_ITER_CHUNK_H__
@@ -6,7 +6,9 @@
 #define __MODERN_STL_ITER_CONCEPTS_H__
 
 #include <concepts>
+#include <mstl/intrinsics.h>
 #include <mstl/option/option.h>
+#include <mstl/iter/iter_chunk.h>
 
 namespace mstl::iter {
     /**
@@ -164,6 +166,194 @@ namespace mstl::iter {
         };
     };
 
+    /**
+     * 迭代器剩余元素数量的估计, 由 size_hint() 返回
+     *
+     * - lower: 剩余元素数量的下界
+     * - upper: 剩余元素数量的上界, None 表示上界未知
+     *
+     * 容器可按 lower 预留空间. 当 lower 与 upper 相等时, 估计是精确的.
+     */
+    struct SizeHint {
+        usize lower = 0;
+        Option<usize> upper = Option<usize>::none();
+    };
+
+    /**
+     * SizeHintIterator 要求:
+     * - 类型 Iter 实现了 Iterator
+     *
+     * # 成员函数要求
+     * - size_hint()
+     *      - 返回值要求
+     *
+     *          返回值类型为 SizeHint
+     *
+     *      - 功能描述
+     *
+     *          返回迭代器剩余元素数量的下界与上界. 返回的估计必须正确, 但可以不精确.
+     *          size_hint() 是可选的, 未实现时应通过 mstl::iter::size_hint 获取估计.
+     */
+    template<typename Iter>
+    concept SizeHintIterator = requires {
+        requires Iterator<Iter>;
+        requires requires(Iter iter) {
+            { iter.size_hint() } -> std::same_as<SizeHint>;
+        };
+    };
+
+    /**
+     * 获取迭代器剩余元素数量的估计
+     *
+     * 优先使用迭代器的 size_hint(); 否则, ExactSizeIterator 返回精确的 len(), 其余迭代器返回 [0, 未知].
+     */
+    template<typename Iter>
+    requires Iterator<std::remove_cvref_t<Iter>>
+    MSTL_INLINE constexpr
+    SizeHint size_hint(Iter&& iter) {
+        if constexpr (SizeHintIterator<std::remove_cvref_t<Iter>>) {
+            return iter.size_hint();
+        } else if constexpr (ExactSizeIterator<std::remove_cvref_t<Iter>>) {
+            usize n = iter.len();
+            return { n, Option<usize>::some(n) };
+        } else {
+            return {};
+        }
+    }
+
+    /**
+     * InternalIterator 描述了可以内部迭代的迭代器
+     *
+     * 外部迭代(反复调用 next())对每个元素都要构造和析构一个 Option<Item>, 并在每层适配器中重复检查.
+     * 内部迭代由迭代器自己驱动循环, 以计数循环的形式把元素逐个交给回调函数, 编译器因而能够像手写的下标循环一样优化它.
+     *
+     * # 成员函数要求
+     * - for_each_internal(F f)
+     *      - 功能描述
+     *
+     *          对剩余的每个元素调用 f(item), 之后迭代器被耗尽
+     *
+     * - try_fold(Acc& acc, F f)
+     *      - 返回值要求
+     *
+     *          返回值类型为 bool
+     *
+     *      - 功能描述
+     *
+     *          对剩余的元素依次调用 f(acc, item), 直到 f 返回 false. 使 f 返回 false 的元素也被消耗.
+     *          若所有元素均被消耗, 则返回 true; 否则返回 false.
+     *
+     * 两者都是可选的. 迭代器与适配器应通过 mstl::iter::for_each_internal 与 mstl::iter::try_fold 使用它们,
+     * 未实现时, 这两个函数退化为反复调用 next().
+     */
+    template<typename Iter, typename F>
+    concept ForEachInternalIterator = requires {
+        requires Iterator<Iter>;
+        requires requires(Iter iter, F f) {
+            iter.for_each_internal(f);
+        };
+    };
+
+    template<typename Iter, typename Acc, typename F>
+    concept TryFoldIterator = requires {
+        requires Iterator<Iter>;
+        requires requires(Iter iter, Acc& acc, F f) {
+            { iter.try_fold(acc, f) } -> std::same_as<bool>;
+        };
+    };
+
+    /**
+     * ChunkedIterator 描述了可以成批取得元素的迭代器
+     *
+     * # 成员函数要求
+     * - next_chunk<N>()
+     *      - 返回值要求
+     *
+     *          返回值类型为 IterChunk<Item, N>
+     *
+     *      - 功能描述
+     *
+     *          取得至多N个元素. 返回的块可能少于N个元素, 仅当迭代器耗尽时返回空块.
+     *          对链表等不能内部迭代的迭代器, 成批取得元素避免了为每个元素构造和析构 Option<Item>.
+     *
+     * 迭代器与适配器应通过 mstl::iter::next_chunk 使用它, 未实现时退化为反复调用 next().
+     */
+    template<typename Iter>
+    concept ChunkedIterator = requires {
+        requires Iterator<Iter>;
+        requires requires(Iter iter) {
+            { iter.template next_chunk<1>() } -> std::same_as<IterChunk<typename Iter::Item, 1>>;
+        };
+    };
+
+    /// 终结操作以next_chunk成批消耗元素时, 每批元素的数量
+    constexpr usize ITER_CHUNK_SIZE = 32;
+
+    /**
+     * 取得 iter 的至多N个元素. 优先使用迭代器的 next_chunk<N>()
+     */
+    template<usize N, Iterator Iter>
+    MSTL_INLINE constexpr
+    IterChunk<typename Iter::Item, N> next_chunk(Iter& iter) {
+        if constexpr (ChunkedIterator<Iter>) {
+            return iter.template next_chunk<N>();
+        } else {
+            IterChunk<typename Iter::Item, N> chunk;
+            while (!chunk.is_full()) {
+                auto next = iter.next();
+                if (next.is_none()) {
+                    break;
+                }
+                chunk.push(next.unwrap_unchecked());
+            }
+            return chunk;
+        }
+    }
+
+    /**
+     * 对 iter 剩余的每个元素调用 f(item). 优先使用迭代器的 for_each_internal(), 其次以 next_chunk() 成批取得元素
+     */
+    template<Iterator Iter, typename F>
+    MSTL_INLINE constexpr
+    void for_each_internal(Iter& iter, F&& f) {
+        if constexpr (ForEachInternalIterator<Iter, F&>) {
+            iter.for_each_internal(f);
+        } else if constexpr (ChunkedIterator<Iter>) {
+            while (true) {
+                auto chunk = iter.template next_chunk<ITER_CHUNK_SIZE>();
+                if (chunk.is_empty()) {
+                    break;
+                }
+                chunk.for_each(f);
+            }
+        } else {
+            for (auto next = iter.next(); next.is_some(); next = iter.next()) {
+                f(next.unwrap_unchecked());
+            }
+        }
+    }
+
+    /**
+     * 对 iter 剩余的元素依次调用 f(acc, item), 直到 f 返回 false. 优先使用迭代器的 try_fold()
+     *
+     * 不使用 next_chunk(): 提前停止时, 同一批中其后的元素将丢失.
+     * @return 若所有元素均被消耗, 则返回 true
+     */
+    template<Iterator Iter, typename Acc, typename F>
+    MSTL_INLINE constexpr
+    bool try_fold(Iter& iter, Acc& acc, F&& f) {
+        if constexpr (TryFoldIterator<Iter, Acc, F&>) {
+            return iter.try_fold(acc, f);
+        } else {
+            for (auto next = iter.next(); next.is_some(); next = iter.next()) {
+                if (!f(acc, next.unwrap_unchecked())) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
     /**
      * IntoIterator 描述了:
      * - 一个类型(T)如何转换为迭代器
@@ -0,0 +1,44 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef __MODERN_STL_PAR_FWD_H__
+#define __MODERN_STL_PAR_FWD_H__
+
+#include <concepts>
+#include <utility>
+#include <mstl/iter/iter_concepts.h>
+
+namespace mstl::iter::par {
+    /**
+     * 可被递归地划分的数据源, 是并行迭代器的基础
+     *
+     * # 成员要求
+     * - IntoIter: 在单个分块上顺序迭代时使用的迭代器
+     * - len(): 剩余元素的数量
+     * - split_at(mid): 划分为[0, mid)与[mid, len())两部分
+     * - into_iter(): 转换为顺序迭代器
+     */
+    template<typename P>
+    concept Producer = requires(const P& producer, usize mid) {
+        typename P::IntoIter;
+        requires Iterator<typename P::IntoIter>;
+        { producer.len() } -> std::same_as<usize>;
+        { producer.split_at(mid) } -> std::same_as<std::pair<P, P>>;
+        { producer.into_iter() } -> std::same_as<typename P::IntoIter>;
+    };
+
+    struct Identity;
+
+    // 此处不约束P: 声明时数据源的定义可能尚不完整
+    template<typename P, typename Adapt = Identity>
+    class ParIter;
+
+    template<typename T>
+    class SliceProducer;
+
+    template<typename Idx>
+    class RangeProducer;
+}
+
+#endif //__MODERN_STL_PAR_FWD_H__
@@ -0,0 +1,58 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef __MODERN_STL_PAR_H__
+#define __MODERN_STL_PAR_H__
+
+#include <concepts>
+#include <mstl/slice.h>
+#include <mstl/ops/range.h>
+#include <mstl/collection/array.h>
+#include <mstl/collection/vector.h>
+#include "par_iter.h"
+#include "slice_producer.h"
+#include "range_producer.h"
+
+/**
+ * 并行迭代器的入口. 并行迭代依赖线程池(`<thread>`, `<mutex>`), 因此不由`mstl.h`包含,
+ * 使用时须包含此头文件, 并链接`mstl_par`(或`Threads::Threads`).
+ */
+namespace mstl::iter::par {
+    /**
+     * @brief 在线程池中并行地迭代Vector中各元素的常量引用, 见ParIter.
+     *
+     * ## Example
+     * @code
+     *      Vector<u32> v = ...;
+     *      u64 total = par::par_iter(v)
+     *                | map([](const u32& x) { return u64(x) * x; })
+     *                | par::fold(u64(0), [](u64 acc, u64 x) { return acc + x; });
+     * @endcode
+     */
+    template<typename T, memory::concepts::Allocator A, collection::concepts::GrowthPolicy G>
+    constexpr ParIter<SliceProducer<T>> par_iter(const collection::Vector<T, A, G>& v) {
+        return ParIter<SliceProducer<T>>{ SliceProducer<T>{ v.data(), v.size() } };
+    }
+
+    /// 在线程池中并行地迭代Array中各元素的常量引用
+    template<typename T, usize N>
+    constexpr ParIter<SliceProducer<T>> par_iter(const collection::Array<T, N>& arr) {
+        return ParIter<SliceProducer<T>>{ SliceProducer<T>{ arr.begin(), N } };
+    }
+
+    /// 在线程池中并行地迭代Slice中各元素的常量引用
+    template<typename T>
+    constexpr ParIter<SliceProducer<std::remove_const_t<T>>> par_iter(const Slice<T>& slice) {
+        using Producer = SliceProducer<std::remove_const_t<T>>;
+        return ParIter<Producer>{ Producer{ slice.as_ptr(), slice.len() } };
+    }
+
+    /// 在线程池中并行地迭代区间中的整数
+    template<std::integral Idx>
+    constexpr ParIter<RangeProducer<Idx>> par_iter(const ops::Range<Idx>& range) {
+        return ParIter<RangeProducer<Idx>>{ RangeProducer<Idx>{ range.low, range.high } };
+    }
+}
+
+#endif //__MODERN_STL_PAR_H__
@@ -0,0 +1,419 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef __MODERN_STL_PAR_ITER_H__
+#define __MODERN_STL_PAR_ITER_H__
+
+#include <memory>
+#include <type_traits>
+#include <mstl/global.h>
+#include <mstl/option/option.h>
+#include <mstl/ops/callable.h>
+#include <mstl/iter/iter_concepts.h>
+#include <mstl/iter/termnals/fold.h>
+#include <mstl/iter/termnals/for_each.h>
+#include <mstl/iter/adapters/adapter_concepts.h>
+#include <mstl/iter/adapters/map.h>
+#include <mstl/iter/adapters/filter.h>
+#include <mstl/thread/thread_pool.h>
+#include "fwd.h"
+
+namespace mstl::iter::par {
+    /// 不对顺序迭代器做任何变换
+    struct Identity {
+        template<Iterator Iter>
+        MSTL_INLINE constexpr
+        Iter operator()(Iter iter) const noexcept {
+            return iter;
+        }
+    };
+
+    /// 在Prev的结果上应用一个适配器, 如map或filter
+    template<typename Prev, typename Holder>
+    class Adapted {
+    public:
+        Adapted(Prev prev, Holder holder): prev(std::move(prev)), holder(std::move(holder)) {}
+
+        template<Iterator Iter>
+        MSTL_INLINE constexpr
+        auto operator()(Iter iter) const {
+            // 适配器可能移走其中的闭包, 因此每个分块使用一份副本
+            Holder copy = holder;
+            return copy.to_adapter(prev(std::move(iter)));
+        }
+
+    private:
+        Prev prev;
+        Holder holder;
+    };
+
+    namespace _private {
+        struct Unit {};
+
+        template<typename C, typename T>
+        concept Appendable = requires(C lhs, C rhs) {
+            lhs.append(std::move(rhs));
+        };
+
+        /// 可以预留空间, 再直接在未初始化的空间中构造元素的容器, 如Vector
+        template<typename C, typename T>
+        concept SpareCapacity = requires(C c, usize n) {
+            c.reserve(n);
+            { c.spare_capacity().as_ptr() } -> std::same_as<T*>;
+            c.set_len(n);
+        };
+
+        /// 每个分块产生的元素与数据源一一对应的适配器链: 只含有map
+        template<typename Adapt>
+        struct ElementWise: std::false_type {};
+
+        template<>
+        struct ElementWise<Identity>: std::true_type {};
+
+        template<typename Prev, typename Lambda>
+        struct ElementWise<Adapted<Prev, iter::_private::MapHolder<Lambda>>>: ElementWise<Prev> {};
+
+        /**
+         * 可以独立地作用于每个分块的适配器: 每个元素的结果只取决于该元素本身, 如map与filter.
+         * enumerate, skip, take与zip等依赖元素的位置, 作用于分块时结果与分块的方式有关, 因此不被接受.
+         */
+        template<typename Holder>
+        struct PerElement: std::false_type {};
+
+        template<typename Lambda>
+        struct PerElement<iter::_private::MapHolder<Lambda>>: std::true_type {};
+
+        template<typename Lambda, bool... Predict>
+        struct PerElement<iter::_private::FilterHolder<Lambda, Predict...>>: std::true_type {};
+
+        /// 在预留的空间中构造的元素[begin, begin + len). 未被提交时析构这些元素, 以便在异常时回滚
+        template<typename T>
+        class Constructed {
+        public:
+            explicit Constructed(T* begin): begin(begin), len(0) {}
+
+            Constructed(Constructed&& other) noexcept: begin(other.begin), len(other.len) {
+                other.len = 0;
+            }
+
+            Constructed& operator=(Constructed&&) = delete;
+
+            ~Constructed() {
+                std::destroy_n(begin, len);
+            }
+
+            template<typename... Args>
+            void emplace_back(Args&&... args) {
+                std::construct_at(begin + len, std::forward<Args>(args)...);
+                len++;
+            }
+
+            /// 合并紧随其后的另一段
+            Constructed merge(Constructed rhs) && {
+                MSTL_DEBUG_ASSERT(begin + len == rhs.begin, "par::collect: chunks must be adjacent");
+                Constructed res{ std::move(*this) };
+                res.len += rhs.len;
+                rhs.len = 0;
+                return res;
+            }
+
+            /// 提交已构造的元素, 之后由容器负责析构
+            usize commit() noexcept {
+                usize n = len;
+                len = 0;
+                return n;
+            }
+
+        private:
+            T* begin;
+            usize len;
+        };
+    }
+
+    /**
+     * @brief 并行迭代器.
+     *
+     * 并行迭代器将数据源(Producer)递归地对半划分, 直到每个分块的元素不多于粒度,
+     * 然后以工作窃取线程池在各个分块上顺序地执行迭代器链, 最后按分块的顺序合并结果.
+     *
+     * map与filter通过`operator|`作用于每个分块, 传入的闭包必须可被多个线程同时调用.
+     * 由于每个分块独立地执行适配器, 只接受逐元素的适配器, 见_private::PerElement.
+     *
+     * 若当前线程是某个线程池的工作线程, 则在该线程池中执行, 否则在全局线程池中执行.
+     * 可以`ThreadPool::install`指定线程池.
+     *
+     * ## Example
+     * @code
+     *      Vector<u32> v = ...;
+     *      u64 total = par::par_iter(v)
+     *                | map([](const u32& x) { return u64(x) * x; })
+     *                | par::fold(u64(0), [](u64 acc, u64 x) { return acc + x; });
+     * @endcode
+     */
+    template<typename P, typename Adapt>
+    class ParIter {
+        static_assert(Producer<P>, "P must satisfy par::Producer");
+
+    public:
+        using SeqIter = std::invoke_result_t<const Adapt&, typename P::IntoIter>;
+        using Item = typename SeqIter::Item;
+        using Value = std::remove_cvref_t<Item>;
+
+        explicit ParIter(P producer, Adapt adapt = {}, usize min_len = 1):
+            producer(std::move(producer)), adapt(std::move(adapt)), min_len(min_len) {}
+
+        /// 数据源中元素的数量
+        usize len() const noexcept {
+            return producer.len();
+        }
+
+        /// 设置每个分块至少含有的元素数量. 对每个元素的处理开销很小时, 较大的分块可减少划分的开销
+        ParIter with_min_len(usize n) const {
+            return ParIter{ producer, adapt, n == 0 ? 1 : n };
+        }
+
+        template<typename Holder>
+        requires iter::_private::AdapterHolder<Holder, SeqIter> && _private::PerElement<Holder>::value
+        ParIter<P, Adapted<Adapt, Holder>> adapt_with(Holder holder) const {
+            return ParIter<P, Adapted<Adapt, Holder>>{ producer, Adapted<Adapt, Holder>{ adapt, std::move(holder) }, min_len };
+        }
+
+        /**
+         * 每个分块以init的副本为初值, 以op累积元素, 再以combine按顺序合并各分块的结果.
+         * 结果与顺序地fold相同, 当且仅当init是combine的单位元, 且combine满足结合律.
+         */
+        template<typename T, typename F, typename C>
+        requires ops::Callable<F, T, T, Item> && ops::Callable<C, T, T, T>
+        T fold(T init, F op, C combine) const {
+            auto leaf = [&](const P& part, usize) {
+                return ::mstl::iter::fold(adapt(part.into_iter()), init, op);
+            };
+            return run<T>(leaf, combine);
+        }
+
+        /// 以op同时作为累积与合并的函数
+        template<typename T, typename F>
+        requires ops::Callable<F, T, T, Item> && ops::Callable<F, T, T, T>
+        T fold(T init, F op) const {
+            return fold(std::move(init), op, op);
+        }
+
+        /// 以op两两合并所有元素, 没有元素时返回none. op必须满足结合律
+        template<typename F>
+        requires ops::Callable<F, Value, Value, Item> && ops::Callable<F, Value, Value, Value>
+        Option<Value> reduce(F op) const {
+            auto leaf = [&](const P& part, usize) {
+                auto seq = adapt(part.into_iter());
+                auto first = seq.next();
+                if (first.is_none()) {
+                    return Option<Value>::none();
+                }
+                Value acc = first.unwrap_unchecked();
+                ::mstl::iter::for_each_internal(seq, [&](Item item) {
+                    acc = op(std::move(acc), std::forward<Item>(item));
+                });
+                return Option<Value>::some(std::move(acc));
+            };
+            auto combine = [&](Option<Value> lhs, Option<Value> rhs) {
+                if (lhs.is_none()) {
+                    return rhs;
+                }
+                if (rhs.is_none()) {
+                    return lhs;
+                }
+                return Option<Value>::some(op(lhs.unwrap_unchecked(), rhs.unwrap_unchecked()));
+            };
+            return run<Option<Value>>(leaf, combine);
+        }
+
+        /// 对每个元素调用f, 调用的顺序是不确定的
+        template<typename F>
+        requires ops::Callable<F, void, Item>
+        void for_each(F f) const {
+            auto leaf = [&](const P& part, usize) {
+                ::mstl::iter::for_each(adapt(part.into_iter()), f);
+                return _private::Unit{};
+            };
+            auto combine = [](_private::Unit, _private::Unit) { return _private::Unit{}; };
+            run<_private::Unit>(leaf, combine);
+        }
+
+        /**
+         * 按元素的顺序收集到容器C中.
+         *
+         * 若只使用了map, 且C可以在预留的空间中直接构造元素(如Vector), 则各分块直接把元素写入最终的位置;
+         * 否则(如含有filter)各分块分别收集, 再按顺序以append合并.
+         * 若某个元素的构造抛出异常, 已构造的元素均被析构, 异常传播给调用者.
+         */
+        template<typename C>
+        requires FromIterator<C, SeqIter> && _private::Appendable<C, Value>
+        C collect() const {
+            if constexpr (_private::ElementWise<Adapt>::value && _private::SpareCapacity<C, Value>) {
+                const usize n = producer.len();
+                C out;
+                out.reserve(n);
+                Value* base = out.spare_capacity().as_ptr();
+                using Built = _private::Constructed<Value>;
+                auto leaf = [&](const P& part, usize offset) {
+                    Built built{ base + offset };
+                    auto seq = adapt(part.into_iter());
+                    ::mstl::iter::for_each_internal(seq, [&](Item item) {
+                        built.emplace_back(std::forward<Item>(item));
+                    });
+                    return built;
+                };
+                auto combine = [](Built lhs, Built rhs) {
+                    return std::move(lhs).merge(std::move(rhs));
+                };
+                Built built = run<Built>(leaf, combine);
+                usize len = built.commit();
+                MSTL_DEBUG_ASSERT(len == n, "par::collect: every element must be constructed");
+                out.set_len(len);
+                return out;
+            } else {
+                auto leaf = [&](const P& part, usize) {
+                    return C::from_iter(adapt(part.into_iter()));
+                };
+                auto combine = [](C lhs, C rhs) {
+                    lhs.append(std::move(rhs));
+                    return lhs;
+                };
+                return run<C>(leaf, combine);
+            }
+        }
+
+    private:
+        template<typename R, typename Leaf, typename Combine>
+        R run(Leaf& leaf, Combine& combine) const {
+            thread::ThreadPool& pool = thread::ThreadPool::current();
+            // 每个线程约分得4个分块, 以便负载不均时窃取
+            const usize chunks = pool.num_threads() * 4;
+            usize grain = producer.len() / chunks;
+            grain = grain < min_len ? min_len : grain;
+            return pool.install([&] {
+                return bridge<R>(producer, 0, grain, leaf, combine);
+            });
+        }
+
+        template<typename R, typename Leaf, typename Combine>
+        static R bridge(const P& part, usize offset, usize grain, Leaf& leaf, Combine& combine) {
+            const usize n = part.len();
+            if (n <= grain) {
+                return leaf(part, offset);
+            }
+
+            const usize mid = n / 2;
+            std::pair<P, P> halves = part.split_at(mid);
+            auto lhs = Option<R>::none();
+            auto rhs = Option<R>::none();
+            thread::join(
+                [&] { lhs = Option<R>::some(bridge<R>(halves.first, offset, grain, leaf, combine)); },
+                [&] { rhs = Option<R>::some(bridge<R>(halves.second, offset + mid, grain, leaf, combine)); }
+            );
+            return combine(lhs.unwrap_unchecked(), rhs.unwrap_unchecked());
+        }
+
+        P producer;
+        Adapt adapt;
+        usize min_len;
+    };
+
+    /// 在每个分块上应用逐元素的适配器, 如`par_iter(v) | map(f) | filter(p)`
+    template<Producer P, typename Adapt, typename Holder>
+    requires iter::_private::AdapterHolder<Holder, typename ParIter<P, Adapt>::SeqIter>
+          && _private::PerElement<Holder>::value
+    MSTL_INLINE
+    auto operator|(ParIter<P, Adapt> par, Holder holder) {
+        return par.adapt_with(std::move(holder));
+    }
+
+    /// 以并行的终结操作结束, 如`par_iter(v) | par::fold(init, op)`
+    template<Producer P, typename Adapt, typename Holder>
+    requires requires(Holder holder, const ParIter<P, Adapt>& par) { holder.call(par); }
+    MSTL_INLINE
+    decltype(auto) operator|(ParIter<P, Adapt> par, Holder holder) {
+        return holder.call(par);
+    }
+
+    template<typename T, typename F, typename C>
+    class FoldHolder {
+    public:
+        FoldHolder(T init, F op, C combine): init(std::move(init)), op(std::move(op)), combine(std::move(combine)) {}
+
+        template<Producer P, typename Adapt>
+        T call(const ParIter<P, Adapt>& par) {
+            return par.fold(std::move(init), op, combine);
+        }
+    private:
+        T init;
+        F op;
+        C combine;
+    };
+
+    template<typename T, typename F, typename C>
+    MSTL_INLINE
+    FoldHolder<T, F, C> fold(T init, F op, C combine) {
+        return { std::move(init), std::move(op), std::move(combine) };
+    }
+
+    template<typename T, typename F>
+    MSTL_INLINE
+    FoldHolder<T, F, F> fold(T init, F op) {
+        return { std::move(init), op, op };
+    }
+
+    template<typename F>
+    class ReduceHolder {
+    public:
+        ReduceHolder(F op): op(std::move(op)) {}
+
+        template<Producer P, typename Adapt>
+        auto call(const ParIter<P, Adapt>& par) {
+            return par.reduce(op);
+        }
+    private:
+        F op;
+    };
+
+    template<typename F>
+    MSTL_INLINE
+    ReduceHolder<F> reduce(F op) {
+        return { std::move(op) };
+    }
+
+    template<typename F>
+    class ForEachHolder {
+    public:
+        ForEachHolder(F f): f(std::move(f)) {}
+
+        template<Producer P, typename Adapt>
+        void call(const ParIter<P, Adapt>& par) {
+            par.for_each(f);
+        }
+    private:
+        F f;
+    };
+
+    template<typename F>
+    MSTL_INLINE
+    ForEachHolder<F> for_each(F f) {
+        return { std::move(f) };
+    }
+
+    template<typename C>
+    struct CollectHolder {
+        template<Producer P, typename Adapt>
+        C call(const ParIter<P, Adapt>& par) {
+            return par.template collect<C>();
+        }
+    };
+
+    template<typename C>
+    MSTL_INLINE
+    CollectHolder<C> collect() {
+        return {};
+    }
+}
+
+#endif //__MODERN_STL_PAR_ITER_H__
@@ -0,0 +1,40 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef __MODERN_STL_PAR_RANGE_PRODUCER_H__
+#define __MODERN_STL_PAR_RANGE_PRODUCER_H__
+
+#include <concepts>
+#include <mstl/ops/range.h>
+#include "par_iter.h"
+
+namespace mstl::iter::par {
+    /// 整数区间[low, high)上的数据源, 由ops::Range的par_iter使用
+    template<typename Idx>
+    class RangeProducer {
+    public:
+        using IntoIter = ops::Range<Idx>;
+
+        constexpr RangeProducer(Idx low, Idx high): low(low), high(high < low ? low : high) {}
+
+        constexpr usize len() const noexcept {
+            return usize(high - low);
+        }
+
+        constexpr std::pair<RangeProducer, RangeProducer> split_at(usize mid) const noexcept {
+            const Idx split = Idx(low + Idx(mid));
+            return { RangeProducer{ low, split }, RangeProducer{ split, high } };
+        }
+
+        constexpr IntoIter into_iter() const noexcept {
+            return IntoIter{ low, high };
+        }
+
+    private:
+        Idx low;
+        Idx high;
+    };
+}
+
+#endif //__MODERN_STL_PAR_RANGE_PRODUCER_H__
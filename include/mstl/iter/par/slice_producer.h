@@ -0,0 +1,38 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef __MODERN_STL_PAR_SLICE_PRODUCER_H__
+#define __MODERN_STL_PAR_SLICE_PRODUCER_H__
+
+#include <mstl/slice.h>
+#include "par_iter.h"
+
+namespace mstl::iter::par {
+    /// 连续内存上的数据源, 由Vector, Array与Slice的par_iter使用. 元素以const T&的形式访问
+    template<typename T>
+    class SliceProducer {
+    public:
+        using IntoIter = SliceRefIter<T, const T&>;
+
+        constexpr SliceProducer(const T* ptr, usize size): ptr(ptr), size(size) {}
+
+        constexpr usize len() const noexcept {
+            return size;
+        }
+
+        constexpr std::pair<SliceProducer, SliceProducer> split_at(usize mid) const noexcept {
+            return { SliceProducer{ ptr, mid }, SliceProducer{ ptr + mid, size - mid } };
+        }
+
+        constexpr IntoIter into_iter() const noexcept {
+            return IntoIter{ const_cast<T*>(ptr), size };
+        }
+
+    private:
+        const T* ptr;
+        usize size;
+    };
+}
+
+#endif //__MODERN_STL_PAR_SLICE_PRODUCER_H__
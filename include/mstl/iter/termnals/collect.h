@@ -25,7 +25,7 @@ namespace mstl::iter {
         requires Iterator<std::remove_cvref_t<Iter>>
         MSTL_INLINE constexpr
         FromIter call(Iter&& iter) {
-            return collect<FromIter, std::remove_cvref_t<Iter>>(iter);
+            return collect<FromIter, std::remove_cvref_t<Iter>>(std::forward<Iter>(iter));
         }
     };
 
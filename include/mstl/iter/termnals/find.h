@@ -15,15 +15,15 @@ namespace mstl::iter {
     Option<typename Iter::Item>
     find(Iter& iter, P predicate) noexcept {
         using Item = typename Iter::Item;
-        Option<Item> next_value = iter.next();
-        while (next_value.is_some()) {
-            auto&& item = next_value.as_ref_uncheck();
+        auto found = Option<Item>::none();
+        try_fold(iter, found, [&](Option<Item>& res, Item item) {
             if (predicate(item)) {
-                break;
+                res = Option<Item>::some(std::forward<Item>(item));
+                return false;
             }
-            next_value = iter.next();
-        }
-        return next_value;
+            return true;
+        });
+        return found;
     }
 
     template<Iterator Iter, typename P, bool Predict>
@@ -32,21 +32,22 @@ namespace mstl::iter {
     Option<typename Iter::Item>
     find(Iter& iter, P predicate) noexcept {
         using Item = typename Iter::Item;
-        Option<Item> next_value = iter.next();
-        while (next_value.is_some()) {
-            auto&& item = next_value.as_ref_uncheck();
+        auto found = Option<Item>::none();
+        try_fold(iter, found, [&](Option<Item>& res, Item item) {
             if constexpr (Predict) {
                 if (predicate(item)) [[likely]] {
-                    break;
+                    res = Option<Item>::some(std::forward<Item>(item));
+                    return false;
                 }
             } else {
                 if (predicate(item)) [[unlikely]] {
-                    break;
+                    res = Option<Item>::some(std::forward<Item>(item));
+                    return false;
                 }
             }
-            next_value = iter.next();
-        }
-        return next_value;
+            return true;
+        });
+        return found;
     }
 
     template<typename Lambda>
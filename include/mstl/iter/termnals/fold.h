@@ -14,14 +14,10 @@ namespace mstl::iter {
     requires ops::Callable<Lambda, T, T, typename Iter::Item>
     constexpr
     T fold(Iter iter, T init, Lambda lambda) {
-        auto next = iter.next();
-        while (next.is_some()) {
-            init = std::move(lambda(
-                    std::move(init),
-                    next.unwrap_unchecked()
-            ));
-            next = iter.next();
-        }
+        using Item = typename Iter::Item;
+        for_each_internal(iter, [&](Item item) {
+            init = lambda(std::move(init), std::forward<Item>(item));
+        });
 
         return init;
     }
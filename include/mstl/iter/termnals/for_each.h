@@ -13,11 +13,7 @@ namespace mstl::iter {
     requires ops::Callable<F, void, typename Iter::Item>
     MSTL_INLINE constexpr
     void for_each(Iter iter, F lambda) noexcept {
-        Option<typename Iter::Item> next = iter.next();
-        while (next.is_some()) {
-            lambda(next.unwrap_unchecked());
-            next = iter.next();
-        }
+        for_each_internal(iter, lambda);
     }
 
     template<typename Lambda>
@@ -0,0 +1,360 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef __MODERN_STL_NUMERIC_H__
+#define __MODERN_STL_NUMERIC_H__
+
+#include <concepts>
+#include <type_traits>
+#include <mstl/iter/termnals/terminal_concepts.h>
+#include <mstl/iter/termnals/simd/simd.h>
+
+namespace mstl::iter {
+    template<Iterator Iter>
+    using NumericItem = std::remove_cvref_t<typename Iter::Item>;
+
+    /**
+     * 元素为数值(除bool外的整数或浮点数)的迭代器
+     *
+     * 若迭代器同时实现了 ContinuousIterator, 则 sum, product, min, max, count 与 position
+     * 直接在 start_addr() 起始的连续内存上以向量指令计算, 否则逐个处理元素.
+     */
+    template<typename Iter>
+    concept NumericIterator = requires {
+        requires Iterator<Iter>;
+        requires std::is_arithmetic_v<NumericItem<Iter>>;
+        requires !std::same_as<NumericItem<Iter>, bool>;
+    };
+
+    namespace _private {
+        template<typename Iter>
+        concept SimdIterator = ContinuousIterator<Iter> && simd::SimdScalar<NumericItem<Iter>>;
+    }
+
+    /**
+     * 求所有元素的和, 迭代器为空时返回0
+     *
+     * 整数溢出时回绕. 对连续内存中的浮点数, 累加的顺序与逐个累加不同, 结果可能有舍入误差上的差异.
+     *
+     * # Example
+     * ```cpp
+     * Vector<u32> v = { 1, 2, 3 };
+     * u32 total = v.iter() | sum();
+     * ```
+     */
+    template<NumericIterator Iter>
+    constexpr
+    NumericItem<Iter> sum(Iter iter) noexcept {
+        using T = NumericItem<Iter>;
+        using Item = typename Iter::Item;
+        if constexpr (_private::SimdIterator<Iter>) {
+            if (!std::is_constant_evaluated()) {
+                return simd::sum(iter.start_addr(), iter.len());
+            }
+        }
+
+        simd::Wrapping<T> res = 0;
+        for_each_internal(iter, [&](Item item) {
+            res = simd::wrapping_add(res, simd::Wrapping<T>(item));
+        });
+        return T(res);
+    }
+
+    /**
+     * 求所有元素的积, 迭代器为空时返回1. 整数溢出时回绕
+     */
+    template<NumericIterator Iter>
+    constexpr
+    NumericItem<Iter> product(Iter iter) noexcept {
+        using T = NumericItem<Iter>;
+        using Item = typename Iter::Item;
+        if constexpr (_private::SimdIterator<Iter>) {
+            if (!std::is_constant_evaluated()) {
+                return simd::product(iter.start_addr(), iter.len());
+            }
+        }
+
+        simd::Wrapping<T> res = 1;
+        for_each_internal(iter, [&](Item item) {
+            res = simd::wrapping_mul(res, simd::Wrapping<T>(item));
+        });
+        return T(res);
+    }
+
+    /**
+     * 求最小的元素, 迭代器为空时返回none. 存在NaN时, 结果是未指定的
+     */
+    template<NumericIterator Iter>
+    constexpr
+    Option<NumericItem<Iter>> min(Iter iter) noexcept {
+        using T = NumericItem<Iter>;
+        using Item = typename Iter::Item;
+        if constexpr (_private::SimdIterator<Iter>) {
+            if (!std::is_constant_evaluated()) {
+                const usize n = iter.len();
+                if (n == 0) {
+                    return Option<T>::none();
+                }
+                return Option<T>::some(simd::min(iter.start_addr(), n));
+            }
+        }
+
+        auto first = iter.next();
+        if (first.is_none()) {
+            return Option<T>::none();
+        }
+        T res = first.unwrap_unchecked();
+        for_each_internal(iter, [&](Item item) {
+            res = item < res ? T(item) : res;
+        });
+        return Option<T>::some(res);
+    }
+
+    /**
+     * 求最大的元素, 迭代器为空时返回none. 存在NaN时, 结果是未指定的
+     */
+    template<NumericIterator Iter>
+    constexpr
+    Option<NumericItem<Iter>> max(Iter iter) noexcept {
+        using T = NumericItem<Iter>;
+        using Item = typename Iter::Item;
+        if constexpr (_private::SimdIterator<Iter>) {
+            if (!std::is_constant_evaluated()) {
+                const usize n = iter.len();
+                if (n == 0) {
+                    return Option<T>::none();
+                }
+                return Option<T>::some(simd::max(iter.start_addr(), n));
+            }
+        }
+
+        auto first = iter.next();
+        if (first.is_none()) {
+            return Option<T>::none();
+        }
+        T res = first.unwrap_unchecked();
+        for_each_internal(iter, [&](Item item) {
+            res = item > res ? T(item) : res;
+        });
+        return Option<T>::some(res);
+    }
+
+    /**
+     * 统计等于value的元素的数量
+     */
+    template<NumericIterator Iter, typename V>
+    requires std::convertible_to<V, NumericItem<Iter>>
+    constexpr
+    usize count(Iter iter, V value) noexcept {
+        using T = NumericItem<Iter>;
+        using Item = typename Iter::Item;
+        const T target = static_cast<T>(value);
+        if constexpr (_private::SimdIterator<Iter>) {
+            if (!std::is_constant_evaluated()) {
+                return simd::count(iter.start_addr(), iter.len(), target);
+            }
+        }
+
+        usize res = 0;
+        for_each_internal(iter, [&](Item item) {
+            res += item == target;
+        });
+        return res;
+    }
+
+    /**
+     * 返回首个等于value的元素相对于迭代器当前位置的下标, 不存在时返回none
+     */
+    template<NumericIterator Iter, typename V>
+    requires std::convertible_to<V, NumericItem<Iter>>
+    constexpr
+    Option<usize> position(Iter iter, V value) noexcept {
+        using T = NumericItem<Iter>;
+        using Item = typename Iter::Item;
+        const T target = static_cast<T>(value);
+        if constexpr (_private::SimdIterator<Iter>) {
+            if (!std::is_constant_evaluated()) {
+                const usize n = iter.len();
+                const usize pos = simd::position(iter.start_addr(), n, target);
+                return pos == n ? Option<usize>::none() : Option<usize>::some(pos);
+            }
+        }
+
+        usize pos = 0;
+        const bool exhausted = try_fold(iter, pos, [&](usize& idx, Item item) {
+            if (item == target) {
+                return false;
+            }
+            idx++;
+            return true;
+        });
+        return exhausted ? Option<usize>::none() : Option<usize>::some(pos);
+    }
+
+    struct SumHolder {
+        constexpr SumHolder() { }
+
+        template<typename Iter>
+        requires NumericIterator<std::remove_cvref_t<Iter>>
+        constexpr NumericItem<std::remove_cvref_t<Iter>>
+        call(Iter&& iter) {
+            return sum(std::forward<Iter>(iter));
+        }
+    };
+
+    MSTL_INLINE constexpr
+    SumHolder sum() {
+        return SumHolder{};
+    }
+
+    struct ProductHolder {
+        constexpr ProductHolder() { }
+
+        template<typename Iter>
+        requires NumericIterator<std::remove_cvref_t<Iter>>
+        constexpr NumericItem<std::remove_cvref_t<Iter>>
+        call(Iter&& iter) {
+            return product(std::forward<Iter>(iter));
+        }
+    };
+
+    MSTL_INLINE constexpr
+    ProductHolder product() {
+        return ProductHolder{};
+    }
+
+    struct MinHolder {
+        constexpr MinHolder() { }
+
+        template<typename Iter>
+        requires NumericIterator<std::remove_cvref_t<Iter>>
+        constexpr Option<NumericItem<std::remove_cvref_t<Iter>>>
+        call(Iter&& iter) {
+            return min(std::forward<Iter>(iter));
+        }
+    };
+
+    MSTL_INLINE constexpr
+    MinHolder min() {
+        return MinHolder{};
+    }
+
+    struct MaxHolder {
+        constexpr MaxHolder() { }
+
+        template<typename Iter>
+        requires NumericIterator<std::remove_cvref_t<Iter>>
+        constexpr Option<NumericItem<std::remove_cvref_t<Iter>>>
+        call(Iter&& iter) {
+            return max(std::forward<Iter>(iter));
+        }
+    };
+
+    MSTL_INLINE constexpr
+    MaxHolder max() {
+        return MaxHolder{};
+    }
+
+    template<typename V>
+    class CountHolder {
+    public:
+        CountHolder(V value): value(value) {}
+
+        template<typename Iter>
+        requires NumericIterator<std::remove_cvref_t<Iter>>
+        constexpr usize call(Iter&& iter) {
+            return count(std::forward<Iter>(iter), value);
+        }
+    private:
+        V value;
+    };
+
+    template<typename V>
+    MSTL_INLINE constexpr
+    CountHolder<V> count(V value) {
+        return CountHolder<V>{ value };
+    }
+
+    template<typename V>
+    class PositionHolder {
+    public:
+        PositionHolder(V value): value(value) {}
+
+        template<typename Iter>
+        requires NumericIterator<std::remove_cvref_t<Iter>>
+        constexpr Option<usize> call(Iter&& iter) {
+            return position(std::forward<Iter>(iter), value);
+        }
+    private:
+        V value;
+    };
+
+    template<typename V>
+    MSTL_INLINE constexpr
+    PositionHolder<V> position(V value) {
+        return PositionHolder<V>{ value };
+    }
+
+    template<NumericIterator Iter>
+    using NumericFuncType = NumericItem<Iter>(*)(Iter);
+
+    template<NumericIterator Iter>
+    using ExtremumFuncType = Option<NumericItem<Iter>>(*)(Iter);
+
+    template<NumericIterator Iter, typename V>
+    using CountFuncType = usize(*)(Iter, V);
+
+    template<NumericIterator Iter, typename V>
+    using PositionFuncType = Option<usize>(*)(Iter, V);
+
+    struct Sum {
+        template<NumericIterator Iter>
+        static consteval NumericFuncType<Iter>
+        get_terminal_func() {
+            return sum<Iter>;
+        }
+    };
+
+    struct Product {
+        template<NumericIterator Iter>
+        static consteval NumericFuncType<Iter>
+        get_terminal_func() {
+            return product<Iter>;
+        }
+    };
+
+    struct Min {
+        template<NumericIterator Iter>
+        static consteval ExtremumFuncType<Iter>
+        get_terminal_func() {
+            return min<Iter>;
+        }
+    };
+
+    struct Max {
+        template<NumericIterator Iter>
+        static consteval ExtremumFuncType<Iter>
+        get_terminal_func() {
+            return max<Iter>;
+        }
+    };
+
+    struct Count {
+        template<NumericIterator Iter, typename V>
+        static consteval CountFuncType<Iter, V>
+        get_terminal_func() {
+            return count<Iter, V>;
+        }
+    };
+
+    struct Position {
+        template<NumericIterator Iter, typename V>
+        static consteval PositionFuncType<Iter, V>
+        get_terminal_func() {
+            return position<Iter, V>;
+        }
+    };
+}
+
+#endif //__MODERN_STL_NUMERIC_H__
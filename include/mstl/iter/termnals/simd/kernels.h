@@ -0,0 +1,197 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+// 本文件没有include guard: simd.h 在不同的目标指令集下多次包含本文件, 以生成各指令集的实现.
+// 包含前须定义 MSTL_SIMD_NS 作为命名空间名, 并在该命名空间中提供:
+// - WIDTH: 向量的字节数
+// - first_byte(mask): 比较结果中首个非零字节的下标, 不存在时返回WIDTH
+//
+// 向量以GCC的向量扩展表示, 由编译器按所在的目标指令集选择指令.
+
+namespace mstl::iter::simd::MSTL_SIMD_NS {
+    template<typename T>
+    struct Lanes {
+        using Bits = std::conditional_t<sizeof(T) == 1, u8,
+                     std::conditional_t<sizeof(T) == 2, u16,
+                     std::conditional_t<sizeof(T) == 4, u32, u64>>>;
+
+        typedef T           Vec  __attribute__((vector_size(WIDTH)));
+        typedef Wrapping<T> Acc  __attribute__((vector_size(WIDTH)));
+        typedef Bits        Mask __attribute__((vector_size(WIDTH)));
+
+        static constexpr usize N = WIDTH / sizeof(T);
+    };
+
+    template<typename V, typename T>
+    MSTL_INLINE inline
+    V load(const T* ptr) noexcept {
+        V v;
+        __builtin_memcpy(&v, ptr, sizeof(V));
+        return v;
+    }
+
+    template<typename T>
+    inline T sum(const T* ptr, usize n) noexcept {
+        using A = Wrapping<T>;
+        using V = typename Lanes<T>::Acc;
+        constexpr usize N = Lanes<T>::N;
+
+        // 以四个累加器打破加法之间的依赖
+        V acc0 = {}, acc1 = {}, acc2 = {}, acc3 = {};
+        usize i = 0;
+        for (; i + 4 * N <= n; i += 4 * N) {
+            acc0 += load<V>(ptr + i);
+            acc1 += load<V>(ptr + i + N);
+            acc2 += load<V>(ptr + i + 2 * N);
+            acc3 += load<V>(ptr + i + 3 * N);
+        }
+        for (; i + N <= n; i += N) {
+            acc0 += load<V>(ptr + i);
+        }
+        acc0 = (acc0 + acc1) + (acc2 + acc3);
+
+        A res = 0;
+        for (usize k = 0; k < N; k++) {
+            res = wrapping_add(res, A(acc0[k]));
+        }
+        return T(wrapping_add(res, A(scalar::sum(ptr + i, n - i))));
+    }
+
+    template<typename T>
+    inline T product(const T* ptr, usize n) noexcept {
+        using A = Wrapping<T>;
+        using V = typename Lanes<T>::Acc;
+        constexpr usize N = Lanes<T>::N;
+
+        V acc0 = V{} + A(1), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+        usize i = 0;
+        for (; i + 4 * N <= n; i += 4 * N) {
+            acc0 *= load<V>(ptr + i);
+            acc1 *= load<V>(ptr + i + N);
+            acc2 *= load<V>(ptr + i + 2 * N);
+            acc3 *= load<V>(ptr + i + 3 * N);
+        }
+        for (; i + N <= n; i += N) {
+            acc0 *= load<V>(ptr + i);
+        }
+        acc0 = (acc0 * acc1) * (acc2 * acc3);
+
+        A res = 1;
+        for (usize k = 0; k < N; k++) {
+            res = wrapping_mul(res, A(acc0[k]));
+        }
+        return T(wrapping_mul(res, A(scalar::product(ptr + i, n - i))));
+    }
+
+    /// 要求n > 0
+    template<typename T>
+    inline T min(const T* ptr, usize n) noexcept {
+        using V = typename Lanes<T>::Vec;
+        constexpr usize N = Lanes<T>::N;
+        if (n < 2 * N) {
+            return scalar::min(ptr, n);
+        }
+
+        V m0 = load<V>(ptr), m1 = load<V>(ptr + N);
+        usize i = 2 * N;
+        for (; i + 2 * N <= n; i += 2 * N) {
+            V a = load<V>(ptr + i), b = load<V>(ptr + i + N);
+            m0 = a < m0 ? a : m0;
+            m1 = b < m1 ? b : m1;
+        }
+        if (i < n) {
+            // 最小值不受重复元素影响, 剩余的元素以末尾的两个向量覆盖
+            V a = load<V>(ptr + n - 2 * N), b = load<V>(ptr + n - N);
+            m0 = a < m0 ? a : m0;
+            m1 = b < m1 ? b : m1;
+        }
+        m0 = m1 < m0 ? m1 : m0;
+
+        T res = m0[0];
+        for (usize k = 1; k < N; k++) {
+            res = m0[k] < res ? T(m0[k]) : res;
+        }
+        return res;
+    }
+
+    /// 要求n > 0
+    template<typename T>
+    inline T max(const T* ptr, usize n) noexcept {
+        using V = typename Lanes<T>::Vec;
+        constexpr usize N = Lanes<T>::N;
+        if (n < 2 * N) {
+            return scalar::max(ptr, n);
+        }
+
+        V m0 = load<V>(ptr), m1 = load<V>(ptr + N);
+        usize i = 2 * N;
+        for (; i + 2 * N <= n; i += 2 * N) {
+            V a = load<V>(ptr + i), b = load<V>(ptr + i + N);
+            m0 = a > m0 ? a : m0;
+            m1 = b > m1 ? b : m1;
+        }
+        if (i < n) {
+            V a = load<V>(ptr + n - 2 * N), b = load<V>(ptr + n - N);
+            m0 = a > m0 ? a : m0;
+            m1 = b > m1 ? b : m1;
+        }
+        m0 = m1 > m0 ? m1 : m0;
+
+        T res = m0[0];
+        for (usize k = 1; k < N; k++) {
+            res = m0[k] > res ? T(m0[k]) : res;
+        }
+        return res;
+    }
+
+    template<typename T>
+    inline usize count(const T* ptr, usize n, T value) noexcept {
+        using V = typename Lanes<T>::Vec;
+        using M = typename Lanes<T>::Mask;
+        constexpr usize N = Lanes<T>::N;
+        // 每个通道的计数器在BLOCK次比较后可能溢出, 因此按块汇总
+        constexpr usize BLOCK = sizeof(T) >= sizeof(usize) ? usize(-1) : (usize(1) << (8 * sizeof(T))) - 1;
+
+        const V target = V{} + value;
+        usize res = 0, i = 0;
+        while (i + N <= n) {
+            usize vectors = (n - i) / N;
+            vectors = vectors < BLOCK ? vectors : BLOCK;
+
+            M cnt = {};
+            for (const usize end = i + vectors * N; i < end; i += N) {
+                cnt -= (M)(load<V>(ptr + i) == target);    // 相等的通道为全1, 即-1
+            }
+            for (usize k = 0; k < N; k++) {
+                res += cnt[k];
+            }
+        }
+        return res + scalar::count(ptr + i, n - i, value);
+    }
+
+    /// 返回首个等于value的元素的下标, 不存在时返回n
+    template<typename T>
+    inline usize position(const T* ptr, usize n, T value) noexcept {
+        using V = typename Lanes<T>::Vec;
+        constexpr usize N = Lanes<T>::N;
+
+        const V target = V{} + value;
+        usize i = 0;
+        for (; i + 2 * N <= n; i += 2 * N) {
+            auto a = load<V>(ptr + i) == target;
+            auto b = load<V>(ptr + i + N) == target;
+            if (first_byte(a | b) != WIDTH) [[unlikely]] {
+                const usize byte = first_byte(a);
+                return byte != WIDTH ? i + byte / sizeof(T) : i + N + first_byte(b) / sizeof(T);
+            }
+        }
+        for (; i + N <= n; i += N) {
+            const usize byte = first_byte(load<V>(ptr + i) == target);
+            if (byte != WIDTH) {
+                return i + byte / sizeof(T);
+            }
+        }
+        return i + scalar::position(ptr + i, n - i, value);
+    }
+}
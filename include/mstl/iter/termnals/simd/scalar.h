@@ -0,0 +1,100 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef __MODERN_STL_SIMD_SCALAR_H__
+#define __MODERN_STL_SIMD_SCALAR_H__
+
+#include <concepts>
+#include <type_traits>
+#include <mstl/global.h>
+
+namespace mstl::iter::simd {
+    /**
+     * 可由向量指令处理的元素类型: 除bool外, 长度为1, 2, 4或8字节的整数与浮点数
+     */
+    template<typename T>
+    concept SimdScalar = std::is_arithmetic_v<T> && !std::same_as<std::remove_cv_t<T>, bool> &&
+                         (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+    /// 求和与求积时使用的类型: 整数以对应的无符号类型计算, 溢出时回绕; 浮点数不变
+    template<typename T>
+    using Wrapping = typename std::conditional_t<std::is_integral_v<T>, std::make_unsigned<T>, std::type_identity<T>>::type;
+
+    template<typename A>
+    MSTL_INLINE constexpr
+    A wrapping_add(A lhs, A rhs) noexcept {
+        return A(lhs + rhs);
+    }
+
+    template<typename A>
+    MSTL_INLINE constexpr
+    A wrapping_mul(A lhs, A rhs) noexcept {
+        // 短于unsigned的类型会被提升为int, 相乘可能溢出
+        using W = std::conditional_t<std::is_integral_v<A> && (sizeof(A) < sizeof(unsigned)), unsigned, A>;
+        return A(W(lhs) * W(rhs));
+    }
+}
+
+/// 逐个元素处理的实现, 用于不支持向量指令的平台, 以及向量无法覆盖的剩余元素
+namespace mstl::iter::simd::scalar {
+    template<typename T>
+    constexpr T sum(const T* ptr, usize n) noexcept {
+        Wrapping<T> res = 0;
+        for (usize i = 0; i < n; i++) {
+            res = wrapping_add(res, Wrapping<T>(ptr[i]));
+        }
+        return T(res);
+    }
+
+    template<typename T>
+    constexpr T product(const T* ptr, usize n) noexcept {
+        Wrapping<T> res = 1;
+        for (usize i = 0; i < n; i++) {
+            res = wrapping_mul(res, Wrapping<T>(ptr[i]));
+        }
+        return T(res);
+    }
+
+    /// 要求n > 0
+    template<typename T>
+    constexpr T min(const T* ptr, usize n) noexcept {
+        T res = ptr[0];
+        for (usize i = 1; i < n; i++) {
+            res = ptr[i] < res ? ptr[i] : res;
+        }
+        return res;
+    }
+
+    /// 要求n > 0
+    template<typename T>
+    constexpr T max(const T* ptr, usize n) noexcept {
+        T res = ptr[0];
+        for (usize i = 1; i < n; i++) {
+            res = ptr[i] > res ? ptr[i] : res;
+        }
+        return res;
+    }
+
+    template<typename T>
+    constexpr usize count(const T* ptr, usize n, T value) noexcept {
+        usize res = 0;
+        for (usize i = 0; i < n; i++) {
+            res += ptr[i] == value;
+        }
+        return res;
+    }
+
+    /// 返回首个等于value的元素的下标, 不存在时返回n
+    template<typename T>
+    constexpr usize position(const T* ptr, usize n, T value) noexcept {
+        for (usize i = 0; i < n; i++) {
+            if (ptr[i] == value) {
+                return i;
+            }
+        }
+        return n;
+    }
+}
+
+#endif //__MODERN_STL_SIMD_SCALAR_H__
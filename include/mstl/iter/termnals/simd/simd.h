@@ -0,0 +1,198 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef __MODERN_STL_SIMD_H__
+#define __MODERN_STL_SIMD_H__
+
+#include <type_traits>
+#include <mstl/global.h>
+#include "scalar.h"
+
+/**
+ * 连续内存上的数值计算, 供sum, product, min, max, count与position等终结操作使用.
+ *
+ * x86平台上提供AVX2与SSE4.2两套实现, 在运行时按CPU支持的指令集选择; AArch64平台上使用NEON.
+ * 其他平台, 非GCC/Clang编译器, 或定义了MSTL_DISABLE_SIMD时, 使用逐个元素处理的实现.
+ */
+
+#if !defined(MSTL_DISABLE_SIMD) && defined(__GNUC__)
+    #if defined(__x86_64__) || defined(__i386__)
+        #define MSTL_SIMD_X86
+        #include <immintrin.h>
+    #elif defined(__aarch64__) && defined(__ARM_NEON)
+        #define MSTL_SIMD_NEON
+        #include <arm_neon.h>
+    #endif
+#endif
+
+namespace mstl::iter::simd {
+    enum class Isa: u8 {
+        Scalar,
+        SSE42,
+        AVX2,
+        NEON,
+    };
+
+    inline Isa detect_isa() noexcept {
+#if defined(MSTL_SIMD_X86)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            return Isa::AVX2;
+        }
+        if (__builtin_cpu_supports("sse4.2")) {
+            return Isa::SSE42;
+        }
+        return Isa::Scalar;
+#elif defined(MSTL_SIMD_NEON)
+        return Isa::NEON;
+#else
+        return Isa::Scalar;
+#endif
+    }
+
+    /// 当前CPU所使用的指令集. 若编译时已启用AVX2, 则无需在运行时检测.
+    MSTL_INLINE inline
+    Isa current_isa() noexcept {
+#if defined(MSTL_SIMD_X86) && defined(__AVX2__)
+        return Isa::AVX2;
+#else
+        static const Isa isa = detect_isa();
+        return isa;
+#endif
+    }
+}
+
+#if defined(MSTL_SIMD_X86)
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx2"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#endif
+
+namespace mstl::iter::simd::avx2 {
+    constexpr usize WIDTH = 32;
+
+    template<typename M>
+    MSTL_INLINE inline
+    usize first_byte(const M& mask) noexcept {
+        __m256i v;
+        __builtin_memcpy(&v, &mask, sizeof(v));
+        const u32 bits = _mm256_movemask_epi8(v);
+        return bits == 0 ? WIDTH : __builtin_ctz(bits);
+    }
+}
+
+#define MSTL_SIMD_NS avx2
+#include "kernels.h"
+#undef MSTL_SIMD_NS
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#pragma clang attribute push(__attribute__((target("sse4.2"))), apply_to = function)
+#else
+#pragma GCC pop_options
+#pragma GCC push_options
+#pragma GCC target("sse4.2")
+#endif
+
+namespace mstl::iter::simd::sse42 {
+    constexpr usize WIDTH = 16;
+
+    template<typename M>
+    MSTL_INLINE inline
+    usize first_byte(const M& mask) noexcept {
+        __m128i v;
+        __builtin_memcpy(&v, &mask, sizeof(v));
+        const u32 bits = _mm_movemask_epi8(v);
+        return bits == 0 ? WIDTH : __builtin_ctz(bits);
+    }
+}
+
+#define MSTL_SIMD_NS sse42
+#include "kernels.h"
+#undef MSTL_SIMD_NS
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+#elif defined(MSTL_SIMD_NEON)
+
+namespace mstl::iter::simd::neon {
+    constexpr usize WIDTH = 16;
+
+    template<typename M>
+    MSTL_INLINE inline
+    usize first_byte(const M& mask) noexcept {
+        uint8x16_t v;
+        __builtin_memcpy(&v, &mask, sizeof(v));
+        // 每个字节收窄为4位, 得到64位的掩码
+        const u64 bits = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(v), 4)), 0);
+        return bits == 0 ? WIDTH : __builtin_ctzll(bits) / 4;
+    }
+}
+
+#define MSTL_SIMD_NS neon
+#include "kernels.h"
+#undef MSTL_SIMD_NS
+
+#endif
+
+#if defined(MSTL_SIMD_X86)
+    #define MSTL_SIMD_DISPATCH(func, ...)                       \
+        switch (current_isa()) {                                \
+            case Isa::AVX2:  return avx2::func(__VA_ARGS__);    \
+            case Isa::SSE42: return sse42::func(__VA_ARGS__);   \
+            default:         return scalar::func(__VA_ARGS__);  \
+        }
+#elif defined(MSTL_SIMD_NEON)
+    #define MSTL_SIMD_DISPATCH(func, ...) return neon::func(__VA_ARGS__)
+#else
+    #define MSTL_SIMD_DISPATCH(func, ...) return scalar::func(__VA_ARGS__)
+#endif
+
+namespace mstl::iter::simd {
+    /// 整数溢出时回绕; 浮点数的累加顺序与逐个累加不同, 结果可能有舍入误差上的差异
+    template<SimdScalar T>
+    inline T sum(const T* ptr, usize n) noexcept {
+        MSTL_SIMD_DISPATCH(sum, ptr, n);
+    }
+
+    /// 整数溢出时回绕
+    template<SimdScalar T>
+    inline T product(const T* ptr, usize n) noexcept {
+        MSTL_SIMD_DISPATCH(product, ptr, n);
+    }
+
+    /// 要求n > 0. 存在NaN时, 结果是未指定的
+    template<SimdScalar T>
+    inline T min(const T* ptr, usize n) noexcept {
+        MSTL_SIMD_DISPATCH(min, ptr, n);
+    }
+
+    /// 要求n > 0. 存在NaN时, 结果是未指定的
+    template<SimdScalar T>
+    inline T max(const T* ptr, usize n) noexcept {
+        MSTL_SIMD_DISPATCH(max, ptr, n);
+    }
+
+    template<SimdScalar T>
+    inline usize count(const T* ptr, usize n, T value) noexcept {
+        MSTL_SIMD_DISPATCH(count, ptr, n, value);
+    }
+
+    /// 返回首个等于value的元素的下标, 不存在时返回n
+    template<SimdScalar T>
+    inline usize position(const T* ptr, usize n, T value) noexcept {
+        MSTL_SIMD_DISPATCH(position, ptr, n, value);
+    }
+}
+
+#undef MSTL_SIMD_DISPATCH
+
+#endif //__MODERN_STL_SIMD_H__
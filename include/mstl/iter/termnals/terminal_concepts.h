@@ -14,7 +14,7 @@ namespace mstl::iter::terminal {
         concept TerminalHolder = requires {
             requires Iterator<Iter>;
             requires requires (TerHolder holder, Iter iter) {
-                { holder.call(iter) };
+                { holder.call(std::move(iter)) };
             };
         };
     }
@@ -9,6 +9,7 @@
 #include "fold.h"
 #include "last.h"
 #include "reduce.h"
+#include "numeric.h"
 #include "collect.h"
 #include "for_each.h"
 #include "terminal_concepts.h"
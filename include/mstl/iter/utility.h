@@ -23,7 +23,7 @@ namespace mstl::iter {
         constexpr auto combinatorFunc = Com::template get_combine_func<Iter, Lambda>();
 
         // 不再递归调用 combine
-        return combinatorFunc(iter, lambda);
+        return combinatorFunc(std::move(iter), lambda);
     }
 
     /**
@@ -35,8 +35,12 @@ namespace mstl::iter {
     decltype(auto) combine(Iter iter, Ter, Args... args) noexcept {
         constexpr auto terminalFunc = Ter::template get_terminal_func<Iter, Args...>();
 
-        // 不再递归调用 combine
-        return terminalFunc(iter, args...);
+        // 不再递归调用 combine; 以引用接收迭代器的终结操作(如find)直接操作iter, 其余则移入
+        if constexpr (std::is_invocable_v<decltype(terminalFunc), Iter&, Args...>) {
+            return terminalFunc(iter, args...);
+        } else {
+            return terminalFunc(std::move(iter), args...);
+        }
     }
 
     ///
@@ -89,7 +93,7 @@ namespace mstl::iter {
         constexpr auto combinatorFunc = Com::template get_combine_func<Iter, Lambda>();
 
         // 递归调用 combine 模拟链式调用
-        return combine(combinatorFunc(iter, lambda), args...);
+        return combine(combinatorFunc(std::move(iter), lambda), args...);
     }
 
     /// 提供 `|` 运算符, 是迭代器处理方式的抽象, 用于对 filter, map 等操作的组合
@@ -5,8 +5,22 @@
 #ifndef MODERN_STL_ALLOCATOR_H
 #define MODERN_STL_ALLOCATOR_H
 
+#include <cstdlib>
+#include <cstring>
 #include "../layout.h"
 
+namespace mstl::memory {
+    /**
+     * @brief `allocate_at_least`的返回值.
+     *
+     * ptr指向所分配的空间, 该空间实际能容纳length个layout所描述的对象. 若分配失败, 则ptr为nullptr.
+     */
+    struct Allocation {
+        void* ptr;
+        usize length;
+    };
+}
+
 namespace mstl::memory::allocator {
 
     /// 预置的分配器类.
@@ -15,19 +29,51 @@ namespace mstl::memory::allocator {
         /**
          * @brief 分配空间.
          *
-         * 使用 [`::operator new(usize, std::nothrow_t{})`](https://en.cppreference.com/w/cpp/memory/new/operator_new)
-         * 或 [`::operator new(usize, std::align_val_t, std::nothrow_t{})`](https://en.cppreference.com/w/cpp/memory/new/operator_new) 分配空间.
+         * 使用 [`std::malloc`](https://en.cppreference.com/w/cpp/memory/c/malloc)
+         * 或 [`std::aligned_alloc`](https://en.cppreference.com/w/cpp/memory/c/aligned_alloc) 分配空间.
          * @param layout 描述所分配的内存空间的Layout.
          * @param length 需要容纳的layout所描述的类型的对象的数量.
          * @return 若分配成功, 则返回指向新分配的空间的首地址的指针; 否则, 返回nullptr.
          */
         void* allocate(const Layout& layout, usize length) noexcept { // NOLINT(readability-convert-member-functions-to-static)
+            usize size = layout.size * length;
             if (layout.align > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
             {
-                auto al = std::align_val_t(layout.align);
-                return ::operator new(layout.size * length, al, std::nothrow_t{});
+                // aligned_alloc要求size是align的整数倍
+                usize rounded = (size + layout.align - 1) & ~(layout.align - 1);
+                return std::aligned_alloc(layout.align, rounded == 0 ? layout.align : rounded);
+            }
+            return std::malloc(size == 0 ? 1 : size);
+        }
+
+        /**
+         * @brief 分配至少能容纳length个对象的空间, 并返回实际能容纳的对象数量.
+         *
+         * malloc返回的空间往往大于请求的大小, 但超出请求的部分不可使用(`_FORTIFY_SOURCE`会检查对其的写入).
+         * 因此把请求的大小向上取整至malloc的尺寸等级(16字节, 不小于128KiB时为4096字节)后再分配, 并返回取整后的大小.
+         */
+        Allocation allocate_at_least(const Layout& layout, usize length) noexcept { // NOLINT(readability-convert-member-functions-to-static)
+            if (layout.size == 0) {
+                return {allocate(layout, length), length};
+            }
+
+            usize size = layout.size * length;
+            void* ptr;
+            if (layout.align > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+                size = (size + layout.align - 1) & ~(layout.align - 1);
+                if (size == 0) {
+                    size = layout.align;
+                }
+                ptr = std::aligned_alloc(layout.align, size);
+            } else {
+                size = good_size(size);
+                ptr = std::malloc(size);
             }
-            return ::operator new(layout.size * length, std::nothrow_t{});
+
+            if (ptr == nullptr) {
+                return {nullptr, 0};
+            }
+            return {ptr, size / layout.size};
         }
 
         template <typename T>
@@ -44,16 +90,49 @@ namespace mstl::memory::allocator {
         /**
          * @brief 解分配空间.
          *
-         * 使用 [`::operator delete(void*, usize, std::nothrow_t{})`](https://en.cppreference.com/w/cpp/memory/new/operator_delete)
-         * 或 [`::operator delete(void*, usize, std::align_val_t, std::nothrow_t{})`](https://en.cppreference.com/w/cpp/memory/new/operator_delete) 解分配空间.
+         * 使用 [`std::free`](https://en.cppreference.com/w/cpp/memory/c/free) 解分配空间.
          */
-        void deallocate(void* ptr, const Layout& layout, usize len) noexcept{ // NOLINT(readability-convert-member-functions-to-static)
-            if (layout.align > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
-            {
-                ::operator delete(ptr, len * layout.size, std::align_val_t{layout.align});
-                return;
+        void deallocate(void* ptr, const Layout&, usize) noexcept{ // NOLINT(readability-convert-member-functions-to-static)
+            std::free(ptr);
+        }
+
+        /**
+         * @brief 扩展空间.
+         *
+         * 把ptr所指向的, 能容纳old_len个对象的空间扩展为能容纳new_len个对象的空间, 并保留原有的内容.
+         * 对齐要求不超过`__STDCPP_DEFAULT_NEW_ALIGNMENT__`时, 使用 [`std::realloc`](https://en.cppreference.com/w/cpp/memory/c/realloc),
+         * 它可能原地扩展空间, 或以`mremap`移动大块空间而无需复制.
+         *
+         * @return 若成功, 则返回扩展后的空间, ptr不再有效; 否则, 返回nullptr, ptr保持有效.
+         */
+        void* grow(void* ptr, const Layout& layout, usize old_len, usize new_len) noexcept { // NOLINT(readability-convert-member-functions-to-static)
+            return reallocate(ptr, layout, old_len, new_len);
+        }
+
+        /**
+         * @brief 扩展空间, 并返回实际能容纳的对象数量.
+         *
+         * 与`allocate_at_least`相同, 把请求的大小向上取整至malloc的尺寸等级后再扩展, 并返回取整后的大小.
+         */
+        Allocation grow_at_least(void* ptr, const Layout& layout, usize old_len, usize new_len) noexcept { // NOLINT(readability-convert-member-functions-to-static)
+            if (layout.size != 0 && layout.align <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+                usize size = good_size(layout.size * new_len);
+                void* p = std::realloc(ptr, size);
+                return {p, p == nullptr ? 0 : size / layout.size};
             }
-            ::operator delete(ptr, len * layout.size);
+            void* p = reallocate(ptr, layout, old_len, new_len);
+            return {p, p == nullptr ? 0 : new_len};
+        }
+
+        /**
+         * @brief 收缩空间.
+         *
+         * 把ptr所指向的, 能容纳old_len个对象的空间收缩为能容纳new_len个对象的空间, 并保留前new_len个对象的内容.
+         *
+         * @return 若成功, 则返回收缩后的空间, ptr不再有效; 否则, 返回nullptr, ptr保持有效.
+         */
+        void* shrink(void* ptr, const Layout& layout, usize old_len, usize new_len) noexcept { // NOLINT(readability-convert-member-functions-to-static)
+            return reallocate(ptr, layout, old_len, new_len);
         }
 
         template<typename T>
@@ -70,6 +149,28 @@ namespace mstl::memory::allocator {
         constexpr bool operator==(const Allocator&) const {
             return true;
         }
+
+    private:
+        static constexpr usize good_size(usize size) noexcept {
+            if (size < 128 * 1024) {
+                return size <= 16 ? 16 : (size + 15) & ~usize(15);
+            }
+            return (size + 4095) & ~usize(4095);
+        }
+
+        void* reallocate(void* ptr, const Layout& layout, usize old_len, usize new_len) noexcept {
+            usize size = layout.size * new_len;
+            if (layout.align <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+                return std::realloc(ptr, size == 0 ? 1 : size);
+            }
+            // realloc不保证对齐, 只能重新分配并复制
+            void* p = allocate(layout, new_len);
+            if (p != nullptr) {
+                std::memcpy(p, ptr, layout.size * (old_len < new_len ? old_len : new_len));
+                std::free(ptr);
+            }
+            return p;
+        }
     };
 }
 
@@ -6,6 +6,7 @@
 #define MODERN_STL_ALLOCATOR_CONCEPT_H
 
 #include <concepts>
+#include <mstl/ops/cmp.h>
 #include "allocator.h"
 
 namespace mstl::memory::concepts {
@@ -39,7 +40,111 @@ namespace mstl::memory::concepts {
         { a.template deallocate(ptr_, length) } -> std::same_as<void>;
     };
 
+    /**
+     * 可重新分配的分配器
+     *
+     * 在Allocator的基础上, 提供改变已分配的空间的大小的能力. 容器在增长或收缩可按字节复制的元素的缓冲区时,
+     * 若分配器满足该concept, 则使用grow/shrink, 以避免"分配-复制-解分配".
+     *
+     * # 成员函数要求
+     * - grow(void* ptr, Layout layout, usize old_len, usize new_len)
+     *      - 返回值要求
+     *
+     *          返回值类型为 void*.
+     *
+     *      - 功能描述
+     *
+     *          ptr为以layout和old_len分配的空间, new_len >= old_len. 返回一片至少能容纳new_len个对象的空间, 其前old_len个对象的内容与ptr相同.
+     *          若成功, ptr不再有效; 若失败, 返回nullptr, ptr保持有效.
+     *
+     * - shrink(void* ptr, Layout layout, usize old_len, usize new_len)
+     *      - 返回值要求
+     *
+     *          返回值类型为 void*.
+     *
+     *      - 功能描述
+     *
+     *          与grow相同, 但new_len <= old_len, 保留前new_len个对象的内容.
+     */
+    template<typename T>
+    concept Reallocator = Allocator<T> && requires(T a, Layout layout, usize length, void *ptr) {
+        { a.grow(ptr, layout, length, length) } -> std::same_as<void *>;
+        { a.shrink(ptr, layout, length, length) } -> std::same_as<void *>;
+    };
+
+    /**
+     * 能返回实际分配大小的分配器
+     *
+     * # 成员函数要求
+     * - allocate_at_least(Layout layout, usize len)
+     *      - 返回值要求
+     *
+     *          返回值类型为 Allocation.
+     *
+     *      - 功能描述
+     *
+     *          分配一片至少能容纳len个layout所描述的类型的对象的空间. 返回所分配的空间, 及其实际能容纳的对象数量.
+     *          解分配时, 可使用介于len与实际数量之间的任意数量.
+     */
+    template<typename T>
+    concept AllocateAtLeast = Allocator<T> && requires(T a, Layout layout, usize length) {
+        { a.allocate_at_least(layout, length) } -> std::same_as<Allocation>;
+    };
+
+    /**
+     * 扩展空间时能返回实际大小的分配器
+     *
+     * # 成员函数要求
+     * - grow_at_least(void* ptr, Layout layout, usize old_len, usize new_len)
+     *      - 返回值要求
+     *
+     *          返回值类型为 Allocation.
+     *
+     *      - 功能描述
+     *
+     *          与grow相同, 但返回扩展后的空间, 及其实际能容纳的对象数量. 失败时返回的空间为nullptr, ptr保持有效.
+     */
+    template<typename T>
+    concept GrowAtLeast = Reallocator<T> && requires(T a, Layout layout, usize length, void *ptr) {
+        { a.grow_at_least(ptr, layout, length, length) } -> std::same_as<Allocation>;
+    };
+
     static_assert(Allocator<mstl::memory::allocator::Allocator>);
+    static_assert(Reallocator<mstl::memory::allocator::Allocator>);
+    static_assert(AllocateAtLeast<mstl::memory::allocator::Allocator>);
+    static_assert(GrowAtLeast<mstl::memory::allocator::Allocator>);
+}
+
+namespace mstl::memory {
+    /**
+     * @brief 使用分配器a分配至少能容纳length个对象的空间.
+     *
+     * 若a满足`concepts::AllocateAtLeast`, 则返回实际能容纳的对象数量; 否则, 返回length.
+     */
+    template<concepts::Allocator A>
+    Allocation allocate_at_least(A& a, const Layout& layout, usize length) noexcept {
+        if constexpr (concepts::AllocateAtLeast<A>) {
+            return a.allocate_at_least(layout, length);
+        } else {
+            void* ptr = a.allocate(layout, length);
+            return {ptr, ptr == nullptr ? 0 : length};
+        }
+    }
+
+    /**
+     * @brief 使用分配器a把ptr所指向的空间扩展为至少能容纳new_len个对象的空间.
+     *
+     * 若a满足`concepts::GrowAtLeast`, 则返回实际能容纳的对象数量; 否则, 返回new_len.
+     */
+    template<concepts::Reallocator A>
+    Allocation grow_at_least(A& a, void* ptr, const Layout& layout, usize old_len, usize new_len) noexcept {
+        if constexpr (concepts::GrowAtLeast<A>) {
+            return a.grow_at_least(ptr, layout, old_len, new_len);
+        } else {
+            void* p = a.grow(ptr, layout, old_len, new_len);
+            return {p, p == nullptr ? 0 : new_len};
+        }
+    }
 }
 
 
@@ -0,0 +1,432 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef MODERN_STL_ARENA_ALLOCATOR_H
+#define MODERN_STL_ARENA_ALLOCATOR_H
+
+#include <memory>
+#include <cstddef>
+#include <cstring>
+#include "../layout.h"
+#include "allocator.h"
+#include "allocator_concept.h"
+
+namespace mstl::memory::allocator {
+
+    /**
+     * @brief 单调增长的内存区域(Arena).
+     *
+     * 从上游分配器申请大块(chunk)的内存, 并以指针碰撞(bump pointer)的方式从中分配空间.
+     * 单次分配仅需对齐并移动指针, 不会访问上游分配器. 解分配为空操作, 所有空间由`reset()`一次性回收.
+     *
+     * `reset()`不会把chunk归还给上游分配器, 而是保留它们以供之后的分配复用.
+     * 因此, 在每次请求结束时调用`reset()`, 稳定状态下的请求处理将不再访问上游分配器.
+     *
+     * MonotonicArena不可复制, 也不可移动. 容器通过`ArenaAllocator`引用它.
+     *
+     * @tparam Upstream 提供chunk的上游分配器.
+     */
+    template<concepts::Allocator Upstream = Allocator>
+    class MonotonicArena {
+        struct Chunk {
+            Chunk* next;
+            usize size;     /// <chunk的总大小, 包括Chunk头部
+
+            u8* begin() noexcept { return reinterpret_cast<u8*>(this) + sizeof(Chunk); }
+            u8* end() noexcept { return reinterpret_cast<u8*>(this) + size; }
+        };
+
+        static constexpr Layout chunk_layout(usize size) noexcept {
+            return Layout::from_size_align_unchecked(size, alignof(std::max_align_t));
+        }
+
+    public:
+        static constexpr usize DEFAULT_CHUNK_SIZE = 64 * 1024;
+
+        /**
+         * @brief 由`mark()`记录的分配位置.
+         */
+        class Checkpoint {
+            friend class MonotonicArena;
+
+            Chunk* chunk;
+            u8* ptr;
+
+            Checkpoint(Chunk* chunk, u8* ptr) noexcept : chunk(chunk), ptr(ptr) {}
+        };
+
+        explicit MonotonicArena(usize chunk_size = DEFAULT_CHUNK_SIZE, const Upstream& upstream = Upstream{}) noexcept
+        : upstream(upstream), chunk_size(chunk_size < 2 * sizeof(Chunk) ? 2 * sizeof(Chunk) : chunk_size) {}
+
+        MonotonicArena(const MonotonicArena&) = delete;
+        MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+        ~MonotonicArena() {
+            release();
+        }
+
+        /**
+         * @brief 分配空间.
+         *
+         * 以layout.align对齐, 分配能容纳length个layout所描述的对象的空间.
+         * 若当前chunk的剩余空间不足, 则复用之后已缓存的chunk, 或向上游分配器申请新的chunk.
+         *
+         * @return 若分配成功, 则返回指向新分配的空间的首地址的指针; 否则, 返回nullptr.
+         */
+        void* allocate(const Layout& layout, usize length) noexcept {
+            usize bytes = layout.size * length;
+            u8* p = align_up(ptr, layout.align);
+            if (p != nullptr && p <= end && bytes <= usize(end - p)) [[likely]] {
+                ptr = p + bytes;
+                return p;
+            }
+            return allocate_slow(bytes, layout.align);
+        }
+
+        /**
+         * @brief 扩展空间.
+         *
+         * 若p是最近一次分配的空间, 且当前chunk的剩余空间足够, 则原地扩展; 否则, 分配新的空间并复制原有的内容.
+         *
+         * @return 若成功, 则返回扩展后的空间; 否则, 返回nullptr.
+         */
+        void* grow(void* p, const Layout& layout, usize old_len, usize new_len) noexcept {
+            usize old_bytes = layout.size * old_len;
+            usize new_bytes = layout.size * new_len;
+            if (is_last(p, old_bytes) && new_bytes - old_bytes <= usize(end - ptr)) {
+                ptr = static_cast<u8*>(p) + new_bytes;
+                return p;
+            }
+
+            void* n = allocate(layout, new_len);
+            if (n != nullptr) {
+                std::memcpy(n, p, old_bytes);
+            }
+            return n;
+        }
+
+        /**
+         * @brief 收缩空间.
+         *
+         * 总是原地收缩. 若p是最近一次分配的空间, 则回收多余的部分.
+         */
+        void* shrink(void* p, const Layout& layout, usize old_len, usize new_len) noexcept {
+            if (is_last(p, layout.size * old_len)) {
+                ptr = static_cast<u8*>(p) + layout.size * new_len;
+            }
+            return p;
+        }
+
+        /**
+         * @brief 释放所有已分配的空间.
+         *
+         * 所有通过该Arena分配的空间都将失效. chunk将被保留, 用于之后的分配.
+         */
+        void reset() noexcept {
+            cur = head;
+            if (cur != nullptr) {
+                ptr = cur->begin();
+                end = cur->end();
+            }
+        }
+
+        /**
+         * @brief 记录当前的分配位置.
+         *
+         * 之后可用`rewind`释放在此之后分配的所有空间.
+         */
+        Checkpoint mark() const noexcept {
+            return {cur, ptr};
+        }
+
+        /**
+         * @brief 释放在checkpoint之后分配的所有空间.
+         *
+         * 仅恢复当前chunk与指针, 时间复杂度为O(1). 之后使用的chunk被保留, 用于之后的分配.
+         * checkpoint须由该Arena的`mark()`返回, 且在其之前记录的checkpoint未被rewind.
+         * `reset()`与`release()`将使之前记录的所有checkpoint失效.
+         */
+        void rewind(const Checkpoint& checkpoint) noexcept {
+            if (checkpoint.chunk == nullptr) {
+                reset();    // 记录时尚未分配任何chunk
+                return;
+            }
+            cur = checkpoint.chunk;
+            ptr = checkpoint.ptr;
+            end = cur->end();
+        }
+
+        /**
+         * @brief 释放所有已分配的空间, 并把所有chunk归还给上游分配器.
+         */
+        void release() noexcept {
+            while (head != nullptr) {
+                Chunk* next = head->next;
+                upstream.deallocate(head, chunk_layout(head->size), 1);
+                head = next;
+            }
+            cur = nullptr;
+            ptr = end = nullptr;
+        }
+
+        /**
+         * @brief 检查该Arena从上游分配器持有的空间大小.
+         * @return 所有chunk的大小之和(字节).
+         */
+        usize reserved() const noexcept {
+            usize total = 0;
+            for (Chunk* c = head; c != nullptr; c = c->next) {
+                total += c->size;
+            }
+            return total;
+        }
+
+        /**
+         * @brief 获取当前线程正在使用的Arena.
+         *
+         * 默认构造的`ArenaAllocator`会从该Arena分配空间. 它由`ArenaScope`设置; 若未设置, 则为nullptr.
+         */
+        static MonotonicArena*& current() noexcept {
+            thread_local MonotonicArena* arena = nullptr;
+            return arena;
+        }
+
+    private:
+        Upstream upstream;
+        usize chunk_size;
+
+        Chunk* head = nullptr;  // 第一个chunk
+        Chunk* cur = nullptr;   // 当前正在分配的chunk
+        u8* ptr = nullptr;      // 当前chunk中的下一个空闲字节
+        u8* end = nullptr;      // 当前chunk的末尾
+
+        bool is_last(void* p, usize bytes) const noexcept {
+            return p != nullptr && static_cast<u8*>(p) + bytes == ptr;
+        }
+
+        static u8* align_up(u8* p, usize align) noexcept {
+            return reinterpret_cast<u8*>((reinterpret_cast<usize>(p) + align - 1) & ~(align - 1));
+        }
+
+        void* allocate_slow(usize bytes, usize align) noexcept {
+            // 优先复用reset()之前留下的chunk
+            while (cur != nullptr && cur->next != nullptr) {
+                Chunk* next = cur->next;
+                u8* p = align_up(next->begin(), align);
+                if (p <= next->end() && bytes <= usize(next->end() - p)) {
+                    cur = next;
+                    ptr = p + bytes;
+                    end = cur->end();
+                    return p;
+                }
+                if (next->size > chunk_size) {
+                    break;  // 为大块分配准备的chunk, 不再向后查找
+                }
+                cur = next;
+            }
+
+            usize need = sizeof(Chunk) + bytes + align;
+            usize size = need > chunk_size ? need : chunk_size;
+            auto* chunk = static_cast<Chunk*>(upstream.allocate(chunk_layout(size), 1));
+            if (chunk == nullptr) {
+                return nullptr;
+            }
+            chunk->size = size;
+
+            // 把新chunk插入到当前chunk之后, 以使其余缓存的chunk仍可在之后被复用
+            if (cur == nullptr) {
+                chunk->next = head;
+                head = chunk;
+            } else {
+                chunk->next = cur->next;
+                cur->next = chunk;
+            }
+            cur = chunk;
+
+            u8* p = align_up(chunk->begin(), align);
+            ptr = p + bytes;
+            end = chunk->end();
+            return p;
+        }
+    };
+
+    /**
+     * @brief 从`MonotonicArena`中分配空间的分配器.
+     *
+     * ArenaAllocator储存Arena的指针, 可被复制. 两个ArenaAllocator当且仅当引用同一个Arena时相等; 都不引用Arena时, 比较其上游分配器.
+     * 解分配为空操作, 空间在Arena被`reset()`时回收.
+     *
+     * 默认构造的ArenaAllocator引用当前线程的`MonotonicArena::current()`. 若当前线程未设置Arena,
+     * 则它直接使用上游分配器分配和解分配空间.
+     *
+     * ## Example
+     * @code
+     *      MonotonicArena<> arena;
+     *      {
+     *          ArenaScope scope{arena};
+     *          Vector<int, ArenaAllocator<>> vec;  // 从arena中分配空间
+     *          vec.push_back(1);
+     *      }
+     *      arena.reset();  // 一次性回收所有空间
+     * @endcode
+     *
+     * @tparam Upstream 上游分配器
+     */
+    template<concepts::Allocator Upstream = Allocator>
+    class ArenaAllocator {
+    public:
+        using ArenaType = MonotonicArena<Upstream>;
+
+        ArenaAllocator() noexcept : arena(ArenaType::current()) {}
+        explicit ArenaAllocator(ArenaType& arena) noexcept : arena(&arena) {}
+        /// 不引用Arena, 直接使用给定的(可能带有状态的)上游分配器
+        explicit ArenaAllocator(const Upstream& upstream) noexcept : arena(nullptr), upstream(upstream) {}
+
+        void* allocate(const Layout& layout, usize length) noexcept {
+            if (arena == nullptr) {
+                return upstream.allocate(layout, length);
+            }
+            return arena->allocate(layout, length);
+        }
+
+        template <typename T>
+        constexpr T* allocate(usize length) noexcept {
+            if (std::is_constant_evaluated()) {
+                std::allocator<T> a;
+                return a.allocate(length);
+            } else {
+                constexpr Layout layout = Layout::from_type<T>();
+                return (T*) allocate(layout, length);
+            }
+        }
+
+        /**
+         * @brief 解分配空间.
+         *
+         * 若该分配器引用了Arena, 则为空操作; 否则, 使用上游分配器解分配空间.
+         */
+        void deallocate(void* ptr, const Layout& layout, usize length) noexcept {
+            if (arena == nullptr) {
+                upstream.deallocate(ptr, layout, length);
+            }
+        }
+
+        template<typename T>
+        constexpr void deallocate(T* ptr, usize length) {
+            if (std::is_constant_evaluated()) {
+                std::allocator<T> a;
+                a.deallocate(ptr, length);
+            } else {
+                constexpr auto layout = Layout::from_type<T>();
+                deallocate(ptr, layout, length);
+            }
+        }
+
+        void* grow(void* ptr, const Layout& layout, usize old_len, usize new_len) noexcept {
+            if (arena != nullptr) {
+                return arena->grow(ptr, layout, old_len, new_len);
+            }
+            return upstream_reallocate(ptr, layout, old_len, new_len);
+        }
+
+        void* shrink(void* ptr, const Layout& layout, usize old_len, usize new_len) noexcept {
+            if (arena != nullptr) {
+                return arena->shrink(ptr, layout, old_len, new_len);
+            }
+            return upstream_reallocate(ptr, layout, old_len, new_len);
+        }
+
+        /// 获取该分配器所引用的Arena. 若未引用任何Arena, 则返回nullptr.
+        ArenaType* get_arena() const noexcept {
+            return arena;
+        }
+
+        constexpr bool operator==(const ArenaAllocator& rhs) const {
+            return arena == rhs.arena && (arena != nullptr || upstream == rhs.upstream);
+        }
+
+    private:
+        ArenaType* arena;
+        Upstream upstream{};    // 仅在未引用Arena时使用; 引用Arena时, 由Arena以其自身的上游分配器申请chunk
+
+        void* upstream_reallocate(void* ptr, const Layout& layout, usize old_len, usize new_len) noexcept {
+            if constexpr (concepts::Reallocator<Upstream>) {
+                return new_len > old_len ?
+                        upstream.grow(ptr, layout, old_len, new_len) :
+                        upstream.shrink(ptr, layout, old_len, new_len);
+            } else {
+                void* n = upstream.allocate(layout, new_len);
+                if (n != nullptr) {
+                    std::memcpy(n, ptr, layout.size * (old_len < new_len ? old_len : new_len));
+                    upstream.deallocate(ptr, layout, old_len);
+                }
+                return n;
+            }
+        }
+    };
+
+    /**
+     * @brief 在作用域内把arena设置为当前线程的Arena.
+     *
+     * 离开作用域时, 恢复之前的Arena. ArenaScope可嵌套.
+     */
+    template<concepts::Allocator Upstream = Allocator>
+    class ArenaScope {
+    public:
+        explicit ArenaScope(MonotonicArena<Upstream>& arena) noexcept
+        : prev(MonotonicArena<Upstream>::current()) {
+            MonotonicArena<Upstream>::current() = &arena;
+        }
+
+        ArenaScope(const ArenaScope&) = delete;
+        ArenaScope& operator=(const ArenaScope&) = delete;
+
+        ~ArenaScope() {
+            MonotonicArena<Upstream>::current() = prev;
+        }
+
+    private:
+        MonotonicArena<Upstream>* prev;
+    };
+
+    /**
+     * @brief 在作用域内分配的所有空间, 在离开作用域时被释放.
+     *
+     * 构造时以`MonotonicArena::mark()`记录分配位置, 析构时以`rewind`回到该位置. ArenaRewindScope可嵌套.
+     * 在循环中使用时, 每次迭代都将复用相同的, 仍在缓存中的空间, 且不会访问上游分配器.
+     * 在作用域内创建的容器须在离开作用域之前被销毁.
+     *
+     * ## Example
+     * @code
+     *      MonotonicArena<> arena;
+     *      ArenaScope scope{arena};
+     *      for (auto& request: requests) {
+     *          ArenaRewindScope rewind{arena};
+     *          Vector<int, ArenaAllocator<>> tmp;    // 每次迭代复用相同的空间
+     *          handle(request, tmp);
+     *      }
+     * @endcode
+     */
+    template<concepts::Allocator Upstream = Allocator>
+    class ArenaRewindScope {
+    public:
+        explicit ArenaRewindScope(MonotonicArena<Upstream>& arena) noexcept
+        : arena(arena), checkpoint(arena.mark()) {}
+
+        ArenaRewindScope(const ArenaRewindScope&) = delete;
+        ArenaRewindScope& operator=(const ArenaRewindScope&) = delete;
+
+        ~ArenaRewindScope() {
+            arena.rewind(checkpoint);
+        }
+
+    private:
+        MonotonicArena<Upstream>& arena;
+        typename MonotonicArena<Upstream>::Checkpoint checkpoint;
+    };
+
+    static_assert(concepts::Reallocator<ArenaAllocator<>>);
+}
+
+#endif //MODERN_STL_ARENA_ALLOCATOR_H
@@ -0,0 +1,266 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef MODERN_STL_CACHING_ALLOCATOR_H
+#define MODERN_STL_CACHING_ALLOCATOR_H
+
+#include <memory>
+#include <cstddef>
+#include <concepts>
+#include "../layout.h"
+#include "allocator.h"
+#include "allocator_concept.h"
+
+namespace mstl::memory::allocator {
+
+    /**
+     * @brief 带有线程本地缓存的分配器适配器.
+     *
+     * 被解分配的空间不会立即归还给被包装的分配器A, 而是按大小级别放入当前线程的缓存中, 之后同一线程中相近大小的分配将直接复用它们.
+     * 当某个大小级别缓存的空间数量超过`BUCKET_LIMIT`时, 将其中的`FLUSH_BATCH`个空间一次性归还给A.
+     *
+     * 大小级别以16字节为粒度直至256字节, 之后每个2的幂区间再等分为4级, 直至`MAX_CACHED_SIZE`字节.
+     * 对齐要求不超过16字节的请求共用这些级别, 超过`MAX_CACHED_SIZE`字节或对齐要求更高的请求直接交给A.
+     *
+     * 所有线程共用A的实例, 因此A必须是无状态的, 即其所有实例均相等.
+     * 在一个线程中分配的空间可以在另一个线程中解分配; 它将进入后者的缓存. 线程退出时, 其缓存中的空间将被归还给A.
+     *
+     * ## Example
+     * @code
+     *      Vector<i32, CachingAllocator<>> vec;
+     *      vec.push_back(1);
+     * @endcode
+     *
+     * @tparam A 被包装的分配器
+     */
+    template<concepts::Allocator A = Allocator>
+    requires std::default_initializable<A>
+    class CachingAllocator {
+        struct Block {
+            Block* next;
+        };
+
+        struct Bucket {
+            Block* head = nullptr;
+            usize count = 0;
+        };
+
+    public:
+        static constexpr usize GRANULE = 16;
+        static constexpr usize MAX_CACHED_SIZE = 64 * 1024;
+        static constexpr usize BUCKET_LIMIT = 64;
+        static constexpr usize FLUSH_BATCH = BUCKET_LIMIT / 2;
+
+        void* allocate(const Layout& layout, usize length) noexcept {
+            usize bytes = layout.size * length;
+            if (!cacheable(bytes, layout.align)) [[unlikely]] {
+                return A{}.allocate(layout, length);
+            }
+
+            usize cls = class_of(bytes);
+            ThreadCache* cache = ThreadCache::get();
+            if (cache != nullptr) [[likely]] {
+                Bucket& bucket = cache->buckets[cls];
+                if (bucket.head != nullptr) {
+                    Block* block = bucket.head;
+                    bucket.head = block->next;
+                    bucket.count--;
+                    return block;
+                }
+            }
+            return A{}.allocate(class_layout(cls), 1);
+        }
+
+        /**
+         * @brief 分配空间, 并返回实际能容纳的对象数量.
+         *
+         * 由缓存满足的请求将得到其大小级别的全部空间.
+         */
+        Allocation allocate_at_least(const Layout& layout, usize length) noexcept {
+            usize bytes = layout.size * length;
+            if (!cacheable(bytes, layout.align)) [[unlikely]] {
+                A upstream{};
+                return memory::allocate_at_least(upstream, layout, length);
+            }
+
+            void* ptr = allocate(layout, length);
+            if (ptr == nullptr) {
+                return {nullptr, 0};
+            }
+            return {ptr, layout.size == 0 ? length : class_size(class_of(bytes)) / layout.size};
+        }
+
+        template <typename T>
+        constexpr T* allocate(usize length) noexcept {
+            if (std::is_constant_evaluated()) {
+                std::allocator<T> a;
+                return a.allocate(length);
+            } else {
+                constexpr Layout layout = Layout::from_type<T>();
+                return (T*) allocate(layout, length);
+            }
+        }
+
+        /**
+         * @brief 解分配空间.
+         *
+         * layout必须与分配时所使用的参数相同, length必须介于分配时请求的数量与`allocate_at_least`返回的数量之间. 被解分配的空间将被放入当前线程的缓存.
+         */
+        void deallocate(void* ptr, const Layout& layout, usize length) noexcept {
+            if (ptr == nullptr) {
+                return;
+            }
+            usize bytes = layout.size * length;
+            if (!cacheable(bytes, layout.align)) [[unlikely]] {
+                A{}.deallocate(ptr, layout, length);
+                return;
+            }
+
+            usize cls = class_of(bytes);
+            ThreadCache* cache = ThreadCache::get();
+            if (cache == nullptr) [[unlikely]] {
+                // 当前线程的缓存已被销毁
+                A{}.deallocate(ptr, class_layout(cls), 1);
+                return;
+            }
+
+            Bucket& bucket = cache->buckets[cls];
+            auto* block = static_cast<Block*>(ptr);
+            block->next = bucket.head;
+            bucket.head = block;
+            if (++bucket.count > BUCKET_LIMIT) [[unlikely]] {
+                flush_bucket(bucket, cls, FLUSH_BATCH);
+            }
+        }
+
+        template<typename T>
+        constexpr void deallocate(T* ptr, usize length) {
+            if (std::is_constant_evaluated()) {
+                std::allocator<T> a;
+                a.deallocate(ptr, length);
+            } else {
+                constexpr auto layout = Layout::from_type<T>();
+                deallocate(ptr, layout, length);
+            }
+        }
+
+        /**
+         * @brief 把当前线程缓存中的所有空间归还给被包装的分配器.
+         */
+        static void flush() noexcept {
+            ThreadCache* cache = ThreadCache::get();
+            if (cache != nullptr) {
+                cache->flush_all();
+            }
+        }
+
+        /**
+         * @brief 检查当前线程缓存中的空间数量.
+         */
+        static usize cached() noexcept {
+            ThreadCache* cache = ThreadCache::get();
+            usize total = 0;
+            if (cache != nullptr) {
+                for (auto& bucket: cache->buckets) {
+                    total += bucket.count;
+                }
+            }
+            return total;
+        }
+
+        constexpr bool operator==(const CachingAllocator&) const {
+            return true;
+        }
+
+    private:
+        static constexpr usize SMALL_CLASSES = 256 / GRANULE;   // 16, 32, ..., 256
+        static constexpr usize STEPS = 4;                       // 每个2的幂区间的级别数量
+
+        static constexpr usize log2(usize n) noexcept {
+            usize r = 0;
+            while (n >>= 1) {
+                r++;
+            }
+            return r;
+        }
+
+        static constexpr usize CLASS_COUNT = SMALL_CLASSES + (log2(MAX_CACHED_SIZE) - log2(256)) * STEPS;
+
+        static constexpr bool cacheable(usize bytes, usize align) noexcept {
+            return bytes <= MAX_CACHED_SIZE && align <= GRANULE;
+        }
+
+        static constexpr usize class_of(usize bytes) noexcept {
+            if (bytes <= 256) {
+                return bytes == 0 ? 0 : (bytes - 1) / GRANULE;
+            }
+            usize lg = log2(bytes - 1);                     // 2^lg < bytes <= 2^(lg+1)
+            usize sub = ((bytes - 1) >> (lg - 2)) - STEPS;  // 以区间宽度的1/4为步长
+            return SMALL_CLASSES + (lg - log2(256)) * STEPS + sub;
+        }
+
+        static constexpr usize class_size(usize cls) noexcept {
+            if (cls < SMALL_CLASSES) {
+                return (cls + 1) * GRANULE;
+            }
+            usize lg = (cls - SMALL_CLASSES) / STEPS + log2(256);
+            usize sub = (cls - SMALL_CLASSES) % STEPS;
+            return (usize(1) << lg) + (sub + 1) * (usize(1) << (lg - 2));
+        }
+
+        static constexpr Layout class_layout(usize cls) noexcept {
+            return Layout::from_size_align_unchecked(class_size(cls), GRANULE);
+        }
+
+        static void flush_bucket(Bucket& bucket, usize cls, usize n) noexcept {
+            A upstream{};
+            Layout layout = class_layout(cls);
+            while (n-- > 0 && bucket.head != nullptr) {
+                Block* block = bucket.head;
+                bucket.head = block->next;
+                bucket.count--;
+                upstream.deallocate(block, layout, 1);
+            }
+        }
+
+        struct ThreadCache {
+            Bucket buckets[CLASS_COUNT]{};
+
+            ThreadCache() noexcept {
+                destroyed() = false;
+            }
+
+            ~ThreadCache() {
+                flush_all();
+                destroyed() = true;
+            }
+
+            void flush_all() noexcept {
+                for (usize i = 0; i < CLASS_COUNT; i++) {
+                    flush_bucket(buckets[i], i, buckets[i].count);
+                }
+            }
+
+            // 线程退出时, 缓存可能先于其它线程本地对象被销毁. 此后的请求直接交给A.
+            static bool& destroyed() noexcept {
+                thread_local bool flag = false;
+                return flag;
+            }
+
+            static ThreadCache* get() noexcept {
+                if (destroyed()) [[unlikely]] {
+                    return nullptr;
+                }
+                thread_local ThreadCache cache;
+                return &cache;
+            }
+        };
+
+        static_assert(class_size(CLASS_COUNT - 1) == MAX_CACHED_SIZE);
+    };
+
+    static_assert(concepts::AllocateAtLeast<CachingAllocator<>>);
+}
+
+#endif //MODERN_STL_CACHING_ALLOCATOR_H
@@ -0,0 +1,365 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef MODERN_STL_FILE_ALLOCATOR_H
+#define MODERN_STL_FILE_ALLOCATOR_H
+
+#if __has_include(<sys/mman.h>) && __has_include(<unistd.h>) && __has_include(<fcntl.h>)
+
+#include <memory>
+#include <cstring>
+#include <type_traits>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "../layout.h"
+#include "allocator.h"
+#include "allocator_concept.h"
+
+#define MSTL_HAS_FILE_ALLOCATOR
+
+namespace mstl::memory::allocator {
+
+    /**
+     * @brief 以共享映射(`MAP_SHARED`)的方式映射到内存中的文件.
+     *
+     * 文件由一个`HEADER_SIZE`字节的头部与紧随其后的一块数据组成. 头部记录元素的大小与通过`sync`保存的元素数量.
+     * 对数据的修改直接写入文件, 因此重新打开文件后, 数据无需反序列化即可使用.
+     *
+     * 一个MappedFile仅持有一块数据, 通过`FileAllocator`分配给一个容器. 分配新的数据将丢弃原有的数据.
+     * 数据的首地址按页对齐, 因此能满足不超过`HEADER_SIZE`字节的对齐要求.
+     *
+     * MappedFile不可复制, 也不可移动. 容器通过`FileAllocator`引用它.
+     *
+     * ## Example
+     * @code
+     *      {
+     *          MappedFile file("table.bin");
+     *          Vector<u64, FileAllocator> vec{FileAllocator{file}};
+     *          vec.push_back(42);
+     *          file.sync(vec.size());      // 保存元素数量
+     *      }
+     *      {
+     *          MappedFile file("table.bin");
+     *          auto vec = Vector<u64, FileAllocator>::from_raw_parts(
+     *                  file.data<u64>(), file.length<u64>(), file.capacity<u64>(), FileAllocator{file});
+     *          assert(vec[0] == 42);
+     *      }
+     * @endcode
+     */
+    class MappedFile {
+        struct Header {
+            u64 magic;
+            u64 element_size;   /// <元素的大小, 0表示尚未分配数据
+            u64 length;         /// <通过sync保存的元素数量
+        };
+
+    public:
+        static constexpr usize HEADER_SIZE = 64;
+        static constexpr u64 MAGIC = 0x4C49464C54534DULL;   // "MSTLFIL"
+
+        /**
+         * @brief 打开path所指定的文件. 若文件不存在, 则创建它.
+         *
+         * 若文件已包含有效的头部, 则映射其中的数据. 可用`is_open`检查文件是否被成功打开.
+         */
+        explicit MappedFile(const char* path) noexcept {
+            fd = ::open(path, O_RDWR | O_CREAT, 0644);
+            if (fd < 0) {
+                return;
+            }
+            struct stat st{};
+            if (::fstat(fd, &st) != 0) {
+                close();
+                return;
+            }
+            auto size = usize(st.st_size);
+            if (size < HEADER_SIZE) {
+                return;     // 新文件, 或不完整的文件: 首次分配时初始化
+            }
+            void* p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (p == MAP_FAILED) {
+                close();
+                return;
+            }
+            base = static_cast<u8*>(p);
+            mapped = size;
+            if (header().magic != MAGIC) {
+                unmap();
+            }
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        ~MappedFile() {
+            unmap();
+            close();
+        }
+
+        /// 检查文件是否被成功打开.
+        bool is_open() const noexcept {
+            return fd >= 0;
+        }
+
+        /**
+         * @brief 获取文件中的数据.
+         * @return 若文件包含元素大小为sizeof(T)的数据, 则返回其首地址; 否则, 返回nullptr.
+         */
+        template<typename T>
+        requires std::is_trivially_copyable_v<T>
+        T* data() const noexcept {
+            return holds<T>() ? reinterpret_cast<T*>(base + HEADER_SIZE) : nullptr;
+        }
+
+        /**
+         * @brief 获取通过`sync`保存的元素数量. 若文件不包含元素大小为sizeof(T)的数据, 则返回0.
+         */
+        template<typename T>
+        requires std::is_trivially_copyable_v<T>
+        usize length() const noexcept {
+            if (!holds<T>()) {
+                return 0;
+            }
+            usize n = header().length;
+            usize cap = capacity<T>();
+            return n < cap ? n : cap;
+        }
+
+        /**
+         * @brief 获取数据能容纳的元素数量. 若文件不包含元素大小为sizeof(T)的数据, 则返回0.
+         */
+        template<typename T>
+        requires std::is_trivially_copyable_v<T>
+        usize capacity() const noexcept {
+            return holds<T>() ? (mapped - HEADER_SIZE) / sizeof(T) : 0;
+        }
+
+        /**
+         * @brief 把元素数量length写入头部, 并把所有修改写回文件.
+         * @return 若成功, 则返回true.
+         */
+        bool sync(usize length) noexcept {
+            if (base == nullptr) {
+                return false;
+            }
+            header().length = length;
+            return ::msync(base, mapped, MS_SYNC) == 0;
+        }
+
+        /**
+         * @brief 分配能容纳至少bytes字节的数据, 丢弃原有的数据.
+         *
+         * 文件的大小被向上取整至页大小的整数倍.
+         *
+         * @return 若成功, 则返回数据的首地址, 并把数据的实际大小写入bytes; 否则, 返回nullptr.
+         */
+        void* allocate(const Layout& layout, usize& bytes) noexcept {
+            if (fd < 0 || layout.align > HEADER_SIZE) {
+                return nullptr;
+            }
+            unmap();
+            usize size = round_up(HEADER_SIZE + bytes);
+            if (::ftruncate(fd, off_t(size)) != 0) {
+                return nullptr;
+            }
+            void* p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (p == MAP_FAILED) {
+                return nullptr;
+            }
+            base = static_cast<u8*>(p);
+            mapped = size;
+            header() = Header{MAGIC, layout.size, 0};
+            bytes = size - HEADER_SIZE;
+            return base + HEADER_SIZE;
+        }
+
+        /**
+         * @brief 以`ftruncate`改变文件的大小, 并重新映射数据, 使其能容纳至少bytes字节.
+         *
+         * 支持`mremap`时, 内核可能原地扩展映射; 否则, 重新映射整个文件. 文件中的内容总是被保留.
+         *
+         * @return 若成功, 则返回数据的首地址, 原有的地址不再有效; 否则, 返回nullptr, 原有的数据保持有效.
+         */
+        void* resize(usize bytes) noexcept {
+            if (base == nullptr) {
+                return nullptr;
+            }
+            usize size = round_up(HEADER_SIZE + bytes);
+            if (size == mapped) {
+                return base + HEADER_SIZE;
+            }
+            if (size > mapped && ::ftruncate(fd, off_t(size)) != 0) {
+                return nullptr;
+            }
+#if defined(MREMAP_MAYMOVE)
+            void* p = ::mremap(base, mapped, size, MREMAP_MAYMOVE);
+            if (p == MAP_FAILED) {
+                return nullptr;
+            }
+#else
+            void* p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (p == MAP_FAILED) {
+                return nullptr;
+            }
+            ::munmap(base, mapped);
+#endif
+            if (size < mapped) {
+                ::ftruncate(fd, off_t(size));
+            }
+            base = static_cast<u8*>(p);
+            mapped = size;
+            return base + HEADER_SIZE;
+        }
+
+        /**
+         * @brief 解除数据的映射. 文件中的内容被保留.
+         */
+        void unmap() noexcept {
+            if (base != nullptr) {
+                ::munmap(base, mapped);
+                base = nullptr;
+                mapped = 0;
+            }
+        }
+
+        /// 检查ptr是否为该文件中的数据.
+        bool owns(const void* ptr) const noexcept {
+            return base != nullptr && ptr == base + HEADER_SIZE;
+        }
+
+    private:
+        int fd = -1;
+        u8* base = nullptr;     // 映射的首地址, 即头部
+        usize mapped = 0;       // 映射的字节数, 即文件的大小
+
+        Header& header() const noexcept {
+            return *reinterpret_cast<Header*>(base);
+        }
+
+        template<typename T>
+        bool holds() const noexcept {
+            return base != nullptr && header().element_size == sizeof(T) && alignof(T) <= HEADER_SIZE;
+        }
+
+        void close() noexcept {
+            if (fd >= 0) {
+                ::close(fd);
+                fd = -1;
+            }
+        }
+
+        static usize round_up(usize bytes) noexcept {
+            static const usize page = usize(::sysconf(_SC_PAGESIZE));
+            return (bytes + page - 1) & ~(page - 1);
+        }
+    };
+
+    /**
+     * @brief 从`MappedFile`中分配空间的分配器.
+     *
+     * 仅适用于元素可按字节复制的`Vector`: Vector增长时, 以`grow`扩展文件并重新映射, 内容无需复制.
+     * 由于文件仅持有一块数据, 逐个移动元素的增长方式(先分配新空间, 再解分配旧空间)不可用.
+     * 解分配仅解除映射, 文件中的内容被保留.
+     *
+     * FileAllocator仅储存MappedFile的指针, 可被复制. 两个FileAllocator当且仅当引用同一个MappedFile时相等.
+     * 默认构造的FileAllocator不引用任何文件, 其所有分配均失败.
+     */
+    class FileAllocator {
+    public:
+        FileAllocator() noexcept = default;
+        explicit FileAllocator(MappedFile& file) noexcept : file(&file) {}
+
+        void* allocate(const Layout& layout, usize length) noexcept {
+            usize bytes = layout.size * length;
+            return file == nullptr ? nullptr : file->allocate(layout, bytes);
+        }
+
+        /**
+         * @brief 分配空间, 并返回实际能容纳的对象数量.
+         *
+         * 文件的大小为页大小的整数倍, 末尾的空间也可被使用.
+         */
+        Allocation allocate_at_least(const Layout& layout, usize length) noexcept {
+            usize bytes = layout.size * length;
+            void* ptr = file == nullptr ? nullptr : file->allocate(layout, bytes);
+            if (ptr == nullptr) {
+                return {nullptr, 0};
+            }
+            return {ptr, layout.size == 0 ? length : bytes / layout.size};
+        }
+
+        template <typename T>
+        constexpr T* allocate(usize length) noexcept {
+            if (std::is_constant_evaluated()) {
+                std::allocator<T> a;
+                return a.allocate(length);
+            } else {
+                constexpr Layout layout = Layout::from_type<T>();
+                return (T*) allocate(layout, length);
+            }
+        }
+
+        /**
+         * @brief 解除ptr所在的映射. 文件中的内容被保留.
+         */
+        void deallocate(void* ptr, const Layout&, usize) noexcept {
+            if (file != nullptr && file->owns(ptr)) {
+                file->unmap();
+            }
+        }
+
+        template<typename T>
+        constexpr void deallocate(T* ptr, usize length) {
+            if (std::is_constant_evaluated()) {
+                std::allocator<T> a;
+                a.deallocate(ptr, length);
+            } else {
+                constexpr auto layout = Layout::from_type<T>();
+                deallocate(ptr, layout, length);
+            }
+        }
+
+        /**
+         * @brief 扩展空间. 以`ftruncate`扩展文件, 并重新映射.
+         */
+        void* grow(void* ptr, const Layout& layout, usize, usize new_len) noexcept {
+            return reallocate(ptr, layout.size * new_len);
+        }
+
+        /**
+         * @brief 收缩空间. 重新映射, 并以`ftruncate`截断文件.
+         */
+        void* shrink(void* ptr, const Layout& layout, usize, usize new_len) noexcept {
+            return reallocate(ptr, layout.size * new_len);
+        }
+
+        /// 获取该分配器所引用的文件. 若未引用任何文件, 则返回nullptr.
+        MappedFile* get_file() const noexcept {
+            return file;
+        }
+
+        constexpr bool operator==(const FileAllocator& rhs) const {
+            return file == rhs.file;
+        }
+
+    private:
+        MappedFile* file = nullptr;
+
+        void* reallocate(void* ptr, usize bytes) noexcept {
+            if (file == nullptr || !file->owns(ptr)) {
+                return nullptr;
+            }
+            return file->resize(bytes);
+        }
+    };
+
+    static_assert(concepts::Reallocator<FileAllocator>);
+    static_assert(concepts::AllocateAtLeast<FileAllocator>);
+}
+
+#endif // __has_include(<sys/mman.h>) && __has_include(<unistd.h>) && __has_include(<fcntl.h>)
+
+#endif //MODERN_STL_FILE_ALLOCATOR_H
@@ -0,0 +1,261 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef MODERN_STL_INLINE_ALLOCATOR_H
+#define MODERN_STL_INLINE_ALLOCATOR_H
+
+#include <memory>
+#include <cstddef>
+#include <cstring>
+#include "../layout.h"
+#include "allocator.h"
+#include "allocator_concept.h"
+
+namespace mstl::memory::allocator {
+
+    /**
+     * @brief 容量为N字节的内联缓冲区.
+     *
+     * InlineArena通常位于栈上. 它以指针碰撞的方式分配空间; 解分配最近一次分配的空间时, 回收该空间, 其余解分配为空操作.
+     * 缓冲区的空间不足时, `InlineAllocator`将使用上游分配器.
+     *
+     * InlineArena不可复制, 也不可移动. 它必须比所有从中分配空间的容器存活得更久.
+     *
+     * @tparam N 缓冲区的大小(字节)
+     */
+    template<usize N>
+    class InlineArena {
+    public:
+        static constexpr usize CAPACITY = N;
+
+        InlineArena() noexcept = default;
+
+        InlineArena(const InlineArena&) = delete;
+        InlineArena& operator=(const InlineArena&) = delete;
+
+        /**
+         * @brief 从缓冲区中分配空间.
+         * @return 若剩余空间足够, 则返回所分配的空间; 否则, 返回nullptr.
+         */
+        void* allocate(const Layout& layout, usize length) noexcept {
+            usize bytes = layout.size * length;
+            u8* p = align_up(ptr, layout.align);
+            if (p <= end() && bytes <= usize(end() - p)) {
+                ptr = p + bytes;
+                return p;
+            }
+            return nullptr;
+        }
+
+        /**
+         * @brief 解分配空间. 若p是最近一次分配的空间, 则回收它.
+         */
+        void deallocate(void* p, const Layout& layout, usize length) noexcept {
+            if (is_last(p, layout.size * length)) {
+                ptr = static_cast<u8*>(p);
+            }
+        }
+
+        /**
+         * @brief 原地调整最近一次分配的空间的大小.
+         * @return 若p是最近一次分配的空间且剩余空间足够, 则返回true.
+         */
+        bool resize(void* p, const Layout& layout, usize old_len, usize new_len) noexcept {
+            usize old_bytes = layout.size * old_len;
+            usize new_bytes = layout.size * new_len;
+            if (!is_last(p, old_bytes) || new_bytes > usize(end() - static_cast<u8*>(p))) {
+                return false;
+            }
+            ptr = static_cast<u8*>(p) + new_bytes;
+            return true;
+        }
+
+        /// 检查p是否指向该缓冲区.
+        bool owns(const void* p) const noexcept {
+            auto* q = static_cast<const u8*>(p);
+            return q >= &buf[0] && q < &buf[0] + N;
+        }
+
+        /// 检查缓冲区中已使用的空间(字节).
+        usize used() const noexcept {
+            return ptr - &buf[0];
+        }
+
+        /// 回收所有空间. 所有从该缓冲区分配的空间都将失效.
+        void reset() noexcept {
+            ptr = &buf[0];
+        }
+
+        /**
+         * @brief 获取当前线程正在使用的InlineArena.
+         *
+         * 默认构造的`InlineAllocator`会从该缓冲区分配空间. 它由`InlineScope`设置; 若未设置, 则为nullptr.
+         */
+        static InlineArena*& current() noexcept {
+            thread_local InlineArena* arena = nullptr;
+            return arena;
+        }
+
+    private:
+        alignas(std::max_align_t) u8 buf[N];
+        u8* ptr = &buf[0];
+
+        u8* end() noexcept {
+            return &buf[0] + N;
+        }
+
+        bool is_last(void* p, usize bytes) const noexcept {
+            return static_cast<u8*>(p) + bytes == ptr;
+        }
+
+        static u8* align_up(u8* p, usize align) noexcept {
+            return reinterpret_cast<u8*>((reinterpret_cast<usize>(p) + align - 1) & ~(align - 1));
+        }
+    };
+
+    /**
+     * @brief 优先从`InlineArena`中分配空间, 空间不足时使用上游分配器的分配器.
+     *
+     * InlineAllocator储存缓冲区的指针与上游分配器, 可被复制. 两个InlineAllocator当且仅当引用同一个缓冲区且上游分配器相等时相等.
+     * 默认构造的InlineAllocator引用当前线程的`InlineArena<N>::current()`; 若未设置, 则直接使用上游分配器.
+     *
+     * 在缓冲区中的最近一次分配可被原地扩展, 因此元素可按字节复制的Vector可在缓冲区中增长而不浪费空间.
+     *
+     * ## Example
+     * @code
+     *      InlineArena<256> buf;
+     *      InlineScope scope{buf};
+     *      Vector<i32, InlineAllocator<256>> vec;  // 不访问堆
+     *      vec.push_back(1);
+     * @endcode
+     *
+     * @tparam N 缓冲区的大小(字节)
+     * @tparam Upstream 上游分配器
+     */
+    template<usize N, concepts::Allocator Upstream = Allocator>
+    class InlineAllocator {
+    public:
+        using ArenaType = InlineArena<N>;
+
+        InlineAllocator() noexcept : arena(ArenaType::current()) {}
+        explicit InlineAllocator(ArenaType& arena) noexcept : arena(&arena) {}
+        /// 引用当前线程的InlineArena, 缓冲区不足时使用给定的(可能带有状态的)上游分配器
+        explicit InlineAllocator(const Upstream& upstream) noexcept : arena(ArenaType::current()), upstream(upstream) {}
+        InlineAllocator(ArenaType& arena, const Upstream& upstream) noexcept : arena(&arena), upstream(upstream) {}
+
+        void* allocate(const Layout& layout, usize length) noexcept {
+            if (arena != nullptr) {
+                void* p = arena->allocate(layout, length);
+                if (p != nullptr) [[likely]] {
+                    return p;
+                }
+            }
+            return upstream.allocate(layout, length);
+        }
+
+        template <typename T>
+        constexpr T* allocate(usize length) noexcept {
+            if (std::is_constant_evaluated()) {
+                std::allocator<T> a;
+                return a.allocate(length);
+            } else {
+                constexpr Layout layout = Layout::from_type<T>();
+                return (T*) allocate(layout, length);
+            }
+        }
+
+        void deallocate(void* ptr, const Layout& layout, usize length) noexcept {
+            if (arena != nullptr && arena->owns(ptr)) {
+                arena->deallocate(ptr, layout, length);
+            } else {
+                upstream.deallocate(ptr, layout, length);
+            }
+        }
+
+        template<typename T>
+        constexpr void deallocate(T* ptr, usize length) {
+            if (std::is_constant_evaluated()) {
+                std::allocator<T> a;
+                a.deallocate(ptr, length);
+            } else {
+                constexpr auto layout = Layout::from_type<T>();
+                deallocate(ptr, layout, length);
+            }
+        }
+
+        /**
+         * @brief 扩展空间.
+         *
+         * 若ptr是缓冲区中最近一次分配的空间且剩余空间足够, 则原地扩展; 否则, 分配新的空间并复制原有的内容.
+         */
+        void* grow(void* ptr, const Layout& layout, usize old_len, usize new_len) noexcept {
+            return reallocate(ptr, layout, old_len, new_len);
+        }
+
+        void* shrink(void* ptr, const Layout& layout, usize old_len, usize new_len) noexcept {
+            return reallocate(ptr, layout, old_len, new_len);
+        }
+
+        /// 获取该分配器所引用的缓冲区. 若未引用任何缓冲区, 则返回nullptr.
+        ArenaType* get_arena() const noexcept {
+            return arena;
+        }
+
+        constexpr bool operator==(const InlineAllocator& rhs) const {
+            return arena == rhs.arena && upstream == rhs.upstream;
+        }
+
+    private:
+        ArenaType* arena;
+        Upstream upstream{};
+
+        void* reallocate(void* ptr, const Layout& layout, usize old_len, usize new_len) noexcept {
+            bool inline_block = arena != nullptr && arena->owns(ptr);
+            if (inline_block) {
+                if (arena->resize(ptr, layout, old_len, new_len)) {
+                    return ptr;
+                }
+            } else if constexpr (concepts::Reallocator<Upstream>) {
+                return new_len > old_len ?
+                        upstream.grow(ptr, layout, old_len, new_len) :
+                        upstream.shrink(ptr, layout, old_len, new_len);
+            }
+
+            void* p = allocate(layout, new_len);
+            if (p != nullptr) {
+                std::memcpy(p, ptr, layout.size * (old_len < new_len ? old_len : new_len));
+                deallocate(ptr, layout, old_len);
+            }
+            return p;
+        }
+    };
+
+    /**
+     * @brief 在作用域内把arena设置为当前线程的InlineArena.
+     *
+     * 离开作用域时, 恢复之前的InlineArena. InlineScope可嵌套.
+     */
+    template<usize N>
+    class InlineScope {
+    public:
+        explicit InlineScope(InlineArena<N>& arena) noexcept
+        : prev(InlineArena<N>::current()) {
+            InlineArena<N>::current() = &arena;
+        }
+
+        InlineScope(const InlineScope&) = delete;
+        InlineScope& operator=(const InlineScope&) = delete;
+
+        ~InlineScope() {
+            InlineArena<N>::current() = prev;
+        }
+
+    private:
+        InlineArena<N>* prev;
+    };
+
+    static_assert(concepts::Reallocator<InlineAllocator<256>>);
+}
+
+#endif //MODERN_STL_INLINE_ALLOCATOR_H
@@ -0,0 +1,387 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef MODERN_STL_INSTRUMENTED_ALLOCATOR_H
+#define MODERN_STL_INSTRUMENTED_ALLOCATOR_H
+
+#include <bit>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <concepts>
+#include "../layout.h"
+#include "allocator.h"
+#include "allocator_concept.h"
+
+#if __has_include(<execinfo.h>)
+#include <execinfo.h>
+#define MSTL_HAS_EXECINFO
+#endif
+
+namespace mstl::memory::allocator {
+
+    /**
+     * @brief `InstrumentedAllocator`在某一时刻的统计数据.
+     */
+    struct AllocationSnapshot {
+        static constexpr usize HISTOGRAM_BUCKETS = sizeof(usize) * 8 + 1;
+
+        u64 allocations = 0;        /// <分配次数
+        u64 deallocations = 0;      /// <解分配次数
+        u64 allocated_bytes = 0;    /// <累计分配的字节数
+        u64 freed_bytes = 0;        /// <累计解分配的字节数
+        u64 live_bytes = 0;         /// <当前持有的字节数
+        u64 peak_live_bytes = 0;    /// <持有的字节数的峰值
+        u64 histogram[HISTOGRAM_BUCKETS]{};   /// <histogram[k]为大小位于[2^(k-1), 2^k)字节的分配次数, histogram[0]为大小为0的分配次数
+    };
+
+    /**
+     * @brief 一次被采样的分配.
+     */
+    struct AllocationSample {
+        static constexpr usize MAX_FRAMES = 16;
+
+        usize bytes;                /// <分配的字节数
+        usize depth;                /// <frames中有效的返回地址数量
+        void* frames[MAX_FRAMES];   /// <分配时的调用栈(返回地址), 可用`backtrace_symbols`或addr2line符号化
+    };
+
+    /**
+     * @brief 统计分配与解分配的分配器适配器.
+     *
+     * InstrumentedAllocator把请求转发给被包装的分配器A, 同时记录分配与解分配的次数和字节数, 持有的字节数的峰值, 以及按2的幂划分的分配大小的直方图.
+     * 每个线程只写入自己的计数器, 且不使用原子的读-改-写操作, 因此记录的开销仅为数次线程本地的读写. `snapshot`汇总所有线程的计数器, 可在任意线程中周期性地调用.
+     *
+     * 持有的字节数的峰值由各线程每累计变化`PEAK_GRANULARITY`字节时合并到全局的计数器得到, 其误差不超过线程数与`PEAK_GRANULARITY`之积.
+     *
+     * 以`set_sample_interval(n)`开启采样后, 每个线程每n次分配记录一次调用栈, 可通过`for_each_sample`读取最近的`SAMPLE_CAPACITY`条记录.
+     *
+     * 统计数据由相同模板参数的所有InstrumentedAllocator共享. 可用不同的Tag区分不同的容器:
+     *
+     * ## Example
+     * @code
+     *      using CacheAlloc = InstrumentedAllocator<Allocator, struct CacheTag>;
+     *      Vector<u64, CacheAlloc> cache;
+     *      cache.push_back(1);
+     *
+     *      AllocationSnapshot s = CacheAlloc::snapshot();
+     *      std::cout << s.live_bytes << " / " << s.peak_live_bytes << std::endl;
+     * @endcode
+     *
+     * @tparam A 被包装的分配器
+     * @tparam Tag 用于区分统计数据的标签类型
+     */
+    template<concepts::Allocator A = Allocator, typename Tag = void>
+    class InstrumentedAllocator {
+    public:
+        static constexpr usize PEAK_GRANULARITY = 64 * 1024;
+        static constexpr usize SAMPLE_CAPACITY = 256;
+
+        InstrumentedAllocator() noexcept requires std::default_initializable<A> : alloc() {}
+        explicit InstrumentedAllocator(const A& alloc) noexcept : alloc(alloc) {}
+
+        void* allocate(const Layout& layout, usize length) noexcept {
+            void* ptr = alloc.allocate(layout, length);
+            if (ptr != nullptr) [[likely]] {
+                record_allocate(layout.size * length);
+            }
+            return ptr;
+        }
+
+        Allocation allocate_at_least(const Layout& layout, usize length) noexcept
+        requires concepts::AllocateAtLeast<A> {
+            Allocation block = alloc.allocate_at_least(layout, length);
+            if (block.ptr != nullptr) [[likely]] {
+                record_allocate(layout.size * block.length);
+            }
+            return block;
+        }
+
+        template <typename T>
+        constexpr T* allocate(usize length) noexcept {
+            if (std::is_constant_evaluated()) {
+                std::allocator<T> a;
+                return a.allocate(length);
+            } else {
+                constexpr Layout layout = Layout::from_type<T>();
+                return (T*) allocate(layout, length);
+            }
+        }
+
+        void deallocate(void* ptr, const Layout& layout, usize length) noexcept {
+            if (ptr == nullptr) {
+                return;
+            }
+            record_deallocate(layout.size * length);
+            alloc.deallocate(ptr, layout, length);
+        }
+
+        template<typename T>
+        constexpr void deallocate(T* ptr, usize length) {
+            if (std::is_constant_evaluated()) {
+                std::allocator<T> a;
+                a.deallocate(ptr, length);
+            } else {
+                constexpr auto layout = Layout::from_type<T>();
+                deallocate(ptr, layout, length);
+            }
+        }
+
+        /**
+         * @brief 扩展空间. 记为一次对旧空间的解分配与一次对新空间的分配.
+         */
+        void* grow(void* ptr, const Layout& layout, usize old_len, usize new_len) noexcept
+        requires concepts::Reallocator<A> {
+            void* p = alloc.grow(ptr, layout, old_len, new_len);
+            if (p != nullptr) {
+                record_deallocate(layout.size * old_len);
+                record_allocate(layout.size * new_len);
+            }
+            return p;
+        }
+
+        Allocation grow_at_least(void* ptr, const Layout& layout, usize old_len, usize new_len) noexcept
+        requires concepts::GrowAtLeast<A> {
+            Allocation block = alloc.grow_at_least(ptr, layout, old_len, new_len);
+            if (block.ptr != nullptr) {
+                record_deallocate(layout.size * old_len);
+                record_allocate(layout.size * block.length);
+            }
+            return block;
+        }
+
+        void* shrink(void* ptr, const Layout& layout, usize old_len, usize new_len) noexcept
+        requires concepts::Reallocator<A> {
+            void* p = alloc.shrink(ptr, layout, old_len, new_len);
+            if (p != nullptr) {
+                record_deallocate(layout.size * old_len);
+                record_allocate(layout.size * new_len);
+            }
+            return p;
+        }
+
+        /**
+         * @brief 汇总所有线程的统计数据.
+         *
+         * 可在任意线程中调用, 不会阻塞正在分配的线程. 各计数器分别读取, 因此在并发分配时它们之间可能存在微小的不一致.
+         */
+        static AllocationSnapshot snapshot() noexcept {
+            Registry& r = registry();
+            AllocationSnapshot s;
+            auto collect = [&s](const Counters& c) {
+                s.allocations += c.allocations.load(std::memory_order_relaxed);
+                s.deallocations += c.deallocations.load(std::memory_order_relaxed);
+                s.allocated_bytes += c.allocated_bytes.load(std::memory_order_relaxed);
+                s.freed_bytes += c.freed_bytes.load(std::memory_order_relaxed);
+                for (usize i = 0; i < AllocationSnapshot::HISTOGRAM_BUCKETS; i++) {
+                    s.histogram[i] += c.histogram[i].load(std::memory_order_relaxed);
+                }
+            };
+            for (ThreadSlot* slot = r.head.load(std::memory_order_acquire); slot != nullptr; slot = slot->next) {
+                collect(*slot);
+            }
+            collect(r.orphan);
+
+            s.live_bytes = s.allocated_bytes > s.freed_bytes ? s.allocated_bytes - s.freed_bytes : 0;
+            i64 peak = r.peak.load(std::memory_order_relaxed);
+            s.peak_live_bytes = u64(peak) > s.live_bytes ? u64(peak) : s.live_bytes;
+            return s;
+        }
+
+        /**
+         * @brief 设置采样间隔: 每个线程每interval次分配记录一次调用栈. interval为0时关闭采样.
+         */
+        static void set_sample_interval(u32 interval) noexcept {
+            registry().sample_interval.store(interval, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief 按记录的先后顺序, 对最近的至多`SAMPLE_CAPACITY`条采样记录调用f.
+         */
+        template<typename F>
+        requires std::invocable<F, const AllocationSample&>
+        static void for_each_sample(F&& f) {
+            Registry& r = registry();
+            std::lock_guard<std::mutex> guard(r.sample_mutex);
+            usize n = r.sample_total < SAMPLE_CAPACITY ? r.sample_total : SAMPLE_CAPACITY;
+            for (usize i = r.sample_total - n; i < r.sample_total; i++) {
+                f(r.samples[i % SAMPLE_CAPACITY]);
+            }
+        }
+
+        /// 获取被包装的分配器.
+        const A& inner() const noexcept {
+            return alloc;
+        }
+
+        constexpr bool operator==(const InstrumentedAllocator& rhs) const {
+            return alloc == rhs.alloc;
+        }
+
+    private:
+        A alloc;
+
+        struct Counters {
+            std::atomic<u64> allocations{0};
+            std::atomic<u64> deallocations{0};
+            std::atomic<u64> allocated_bytes{0};
+            std::atomic<u64> freed_bytes{0};
+            std::atomic<u64> histogram[AllocationSnapshot::HISTOGRAM_BUCKETS]{};
+        };
+
+        /**
+         * 一个线程的计数器. 线程退出后, 其计数器保留在注册表中, 可被之后创建的线程复用.
+         */
+        struct ThreadSlot: Counters {
+            ThreadSlot* next = nullptr;
+            std::atomic<bool> in_use{true};
+            i64 pending = 0;    // 尚未合并到全局的持有字节数的变化量
+            u32 countdown = 0;  // 距离下一次采样的分配次数
+        };
+
+        struct Registry {
+            std::atomic<ThreadSlot*> head{nullptr};
+            Counters orphan;    // 线程本地数据已被销毁的线程使用的计数器
+            std::atomic<i64> live{0};
+            std::atomic<i64> peak{0};
+            std::atomic<u32> sample_interval{0};
+
+            std::mutex sample_mutex;
+            usize sample_total = 0;
+            AllocationSample samples[SAMPLE_CAPACITY]{};
+        };
+
+        // 注册表永不析构: 其它线程退出时仍可能访问它
+        static Registry& registry() noexcept {
+            static Registry* r = new Registry;
+            return *r;
+        }
+
+        // 仅由所有者线程写入, 因此无需原子的读-改-写操作
+        static void bump(std::atomic<u64>& c, u64 n) noexcept {
+            c.store(c.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+        }
+
+        static constexpr usize bucket_of(usize bytes) noexcept {
+            return std::bit_width(bytes);
+        }
+
+        static void record_allocate(usize bytes) noexcept {
+            ThreadSlot* slot = Local::get();
+            if (slot == nullptr) [[unlikely]] {
+                Counters& c = registry().orphan;
+                c.allocations.fetch_add(1, std::memory_order_relaxed);
+                c.allocated_bytes.fetch_add(bytes, std::memory_order_relaxed);
+                c.histogram[bucket_of(bytes)].fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            bump(slot->allocations, 1);
+            bump(slot->allocated_bytes, bytes);
+            bump(slot->histogram[bucket_of(bytes)], 1);
+            slot->pending += i64(bytes);
+            if (slot->pending >= i64(PEAK_GRANULARITY)) [[unlikely]] {
+                merge_pending(*slot);
+            }
+
+            u32 interval = registry().sample_interval.load(std::memory_order_relaxed);
+            if (interval != 0) [[unlikely]] {
+                if (slot->countdown == 0 || slot->countdown > interval) {
+                    slot->countdown = interval;
+                }
+                if (--slot->countdown == 0) {
+                    record_sample(bytes);
+                }
+            }
+        }
+
+        static void record_deallocate(usize bytes) noexcept {
+            ThreadSlot* slot = Local::get();
+            if (slot == nullptr) [[unlikely]] {
+                Counters& c = registry().orphan;
+                c.deallocations.fetch_add(1, std::memory_order_relaxed);
+                c.freed_bytes.fetch_add(bytes, std::memory_order_relaxed);
+                return;
+            }
+
+            bump(slot->deallocations, 1);
+            bump(slot->freed_bytes, bytes);
+            slot->pending -= i64(bytes);
+            if (slot->pending <= -i64(PEAK_GRANULARITY)) [[unlikely]] {
+                merge_pending(*slot);
+            }
+        }
+
+        static void merge_pending(ThreadSlot& slot) noexcept {
+            Registry& r = registry();
+            i64 now = r.live.fetch_add(slot.pending, std::memory_order_relaxed) + slot.pending;
+            slot.pending = 0;
+            i64 peak = r.peak.load(std::memory_order_relaxed);
+            while (now > peak && !r.peak.compare_exchange_weak(peak, now, std::memory_order_relaxed)) {}
+        }
+
+        static void record_sample(usize bytes) noexcept {
+            AllocationSample sample{};
+            sample.bytes = bytes;
+#ifdef MSTL_HAS_EXECINFO
+            sample.depth = ::backtrace(sample.frames, AllocationSample::MAX_FRAMES);
+#else
+            sample.frames[0] = __builtin_return_address(0);
+            sample.depth = 1;
+#endif
+            Registry& r = registry();
+            std::lock_guard<std::mutex> guard(r.sample_mutex);
+            r.samples[r.sample_total % SAMPLE_CAPACITY] = sample;
+            r.sample_total++;
+        }
+
+        /**
+         * 当前线程占用的ThreadSlot. 线程退出时, 合并其持有字节数的变化量并释放该ThreadSlot.
+         */
+        struct Local {
+            ThreadSlot* slot;
+
+            Local() noexcept {
+                Registry& r = registry();
+                for (ThreadSlot* s = r.head.load(std::memory_order_acquire); s != nullptr; s = s->next) {
+                    bool expected = false;
+                    if (s->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                        slot = s;
+                        return;
+                    }
+                }
+                slot = new ThreadSlot;
+                slot->next = r.head.load(std::memory_order_relaxed);
+                while (!r.head.compare_exchange_weak(slot->next, slot, std::memory_order_release, std::memory_order_relaxed)) {}
+            }
+
+            ~Local() {
+                merge_pending(*slot);
+                slot->countdown = 0;
+                slot->in_use.store(false, std::memory_order_release);
+                destroyed() = true;
+            }
+
+            static bool& destroyed() noexcept {
+                thread_local bool flag = false;
+                return flag;
+            }
+
+            static ThreadSlot* get() noexcept {
+                if (destroyed()) [[unlikely]] {
+                    return nullptr;
+                }
+                thread_local Local local;
+                return local.slot;
+            }
+        };
+    };
+
+    static_assert(concepts::Allocator<InstrumentedAllocator<>>);
+    static_assert(concepts::Reallocator<InstrumentedAllocator<>>);
+    static_assert(concepts::AllocateAtLeast<InstrumentedAllocator<>>);
+    static_assert(concepts::GrowAtLeast<InstrumentedAllocator<>>);
+}
+
+#endif //MODERN_STL_INSTRUMENTED_ALLOCATOR_H
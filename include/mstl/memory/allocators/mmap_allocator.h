@@ -0,0 +1,231 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef MODERN_STL_MMAP_ALLOCATOR_H
+#define MODERN_STL_MMAP_ALLOCATOR_H
+
+#if __has_include(<sys/mman.h>)
+
+#include <memory>
+#include <cstring>
+#include <sys/mman.h>
+#include "../layout.h"
+#include "allocator.h"
+#include "allocator_concept.h"
+
+#define MSTL_HAS_MMAP_ALLOCATOR
+
+namespace mstl::memory::allocator {
+
+    /**
+     * @brief 使用mmap分配大块空间, 并尽可能使用大页(huge page)的分配器.
+     *
+     * 不小于`THRESHOLD`字节的请求将被向上取整至`HUGE_PAGE_SIZE`的整数倍, 并以匿名映射分配:
+     * 优先使用`MAP_HUGETLB`; 若系统未预留大页, 则退回普通页, 以`HUGE_PAGE_SIZE`对齐映射, 并以`madvise(MADV_HUGEPAGE)`请求透明大页.
+     * 大页可减少访问大块空间时的TLB缺失, 以及首次访问时的缺页中断次数.
+     *
+     * 更小的请求交给`Allocator`. 扩展和收缩大块空间时使用`mremap`, 无需复制内容.
+     *
+     * MmapAllocator是无状态的, 其所有实例均相等.
+     *
+     * ## Example
+     * @code
+     *      Vector<u64, MmapAllocator> vec;
+     *      vec.reserve(1ull << 30);  // 映射8GiB的空间, 之后的增长使用mremap
+     * @endcode
+     */
+    class MmapAllocator {
+    public:
+        static constexpr usize HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+        static constexpr usize THRESHOLD = HUGE_PAGE_SIZE;
+
+        void* allocate(const Layout& layout, usize length) noexcept { // NOLINT(readability-convert-member-functions-to-static)
+            usize bytes = layout.size * length;
+            if (!mapped(bytes)) {
+                return small.allocate(layout, length);
+            }
+            return map(round_up(bytes));
+        }
+
+        /**
+         * @brief 分配空间, 并返回实际能容纳的对象数量.
+         *
+         * 映射的空间的大小为`HUGE_PAGE_SIZE`的整数倍.
+         */
+        Allocation allocate_at_least(const Layout& layout, usize length) noexcept { // NOLINT(readability-convert-member-functions-to-static)
+            usize bytes = layout.size * length;
+            if (layout.size == 0) {
+                return memory::allocate_at_least(small, layout, length);
+            }
+            if (!mapped(bytes)) {
+                return below_threshold(memory::allocate_at_least(small, layout, length), layout);
+            }
+            void* ptr = map(round_up(bytes));
+            if (ptr == nullptr) {
+                return {nullptr, 0};
+            }
+            return {ptr, round_up(bytes) / layout.size};
+        }
+
+        template <typename T>
+        constexpr T* allocate(usize length) noexcept {
+            if (std::is_constant_evaluated()) {
+                std::allocator<T> a;
+                return a.allocate(length);
+            } else {
+                constexpr Layout layout = Layout::from_type<T>();
+                return (T*) allocate(layout, length);
+            }
+        }
+
+        void deallocate(void* ptr, const Layout& layout, usize length) noexcept { // NOLINT(readability-convert-member-functions-to-static)
+            if (ptr == nullptr) {
+                return;
+            }
+            usize bytes = layout.size * length;
+            if (!mapped(bytes)) {
+                small.deallocate(ptr, layout, length);
+                return;
+            }
+            ::munmap(ptr, round_up(bytes));
+        }
+
+        template<typename T>
+        constexpr void deallocate(T* ptr, usize length) {
+            if (std::is_constant_evaluated()) {
+                std::allocator<T> a;
+                a.deallocate(ptr, length);
+            } else {
+                constexpr auto layout = Layout::from_type<T>();
+                deallocate(ptr, layout, length);
+            }
+        }
+
+        /**
+         * @brief 扩展空间.
+         *
+         * 若原空间已被映射, 则使用`mremap`扩展, 内核可能原地扩展, 或移动页表而不复制内容.
+         */
+        void* grow(void* ptr, const Layout& layout, usize old_len, usize new_len) noexcept {
+            return reallocate(ptr, layout, old_len, new_len);
+        }
+
+        /**
+         * @brief 扩展空间, 并返回实际能容纳的对象数量.
+         *
+         * 映射的空间的大小为`HUGE_PAGE_SIZE`的整数倍.
+         */
+        Allocation grow_at_least(void* ptr, const Layout& layout, usize old_len, usize new_len) noexcept {
+            if (layout.size == 0) {
+                return {grow(ptr, layout, old_len, new_len), new_len};
+            }
+            usize new_bytes = layout.size * new_len;
+            if (!mapped(layout.size * old_len) && !mapped(new_bytes)) {
+                return below_threshold(small.grow_at_least(ptr, layout, old_len, new_len), layout);
+            }
+            void* p = reallocate(ptr, layout, old_len, new_len);
+            if (p == nullptr) {
+                return {nullptr, 0};
+            }
+            return {p, round_up(new_bytes) / layout.size};
+        }
+
+        void* shrink(void* ptr, const Layout& layout, usize old_len, usize new_len) noexcept {
+            return reallocate(ptr, layout, old_len, new_len);
+        }
+
+        constexpr bool operator==(const MmapAllocator&) const {
+            return true;
+        }
+
+    private:
+        [[no_unique_address]] Allocator small{};
+
+        static constexpr bool mapped(usize bytes) noexcept {
+            return bytes >= THRESHOLD;
+        }
+
+        /// 释放与扩展时按字节数判断空间是否被映射, 因此malloc给出的可用空间不能计入THRESHOLD及以上的部分
+        static constexpr Allocation below_threshold(Allocation block, const Layout& layout) noexcept {
+            usize limit = (THRESHOLD - 1) / layout.size;
+            if (block.length > limit) {
+                block.length = limit;
+            }
+            return block;
+        }
+
+        static constexpr usize round_up(usize bytes) noexcept {
+            return (bytes + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+        }
+
+        static void* map(usize size) noexcept {
+#if defined(MAP_HUGETLB)
+            int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+    #if defined(MAP_HUGE_2MB)
+            flags |= MAP_HUGE_2MB;
+    #endif
+            void* p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+            if (p != MAP_FAILED) {
+                return p;
+            }
+#endif
+            // 未预留大页. 多映射一个大页, 以便裁剪出按HUGE_PAGE_SIZE对齐的区域, 使透明大页能够覆盖整个区域
+            void* raw = ::mmap(nullptr, size + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE,
+                               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (raw == MAP_FAILED) {
+                return nullptr;
+            }
+            auto begin = reinterpret_cast<usize>(raw);
+            usize aligned = (begin + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+            if (aligned != begin) {
+                ::munmap(raw, aligned - begin);
+            }
+            usize tail = begin + size + HUGE_PAGE_SIZE - (aligned + size);
+            if (tail != 0) {
+                ::munmap(reinterpret_cast<void*>(aligned + size), tail);
+            }
+#if defined(MADV_HUGEPAGE)
+            ::madvise(reinterpret_cast<void*>(aligned), size, MADV_HUGEPAGE);
+#endif
+            return reinterpret_cast<void*>(aligned);
+        }
+
+        void* reallocate(void* ptr, const Layout& layout, usize old_len, usize new_len) noexcept {
+            usize old_bytes = layout.size * old_len;
+            usize new_bytes = layout.size * new_len;
+
+            if (!mapped(old_bytes) && !mapped(new_bytes)) {
+                return new_len > old_len ?
+                        small.grow(ptr, layout, old_len, new_len) :
+                        small.shrink(ptr, layout, old_len, new_len);
+            }
+
+#if defined(MREMAP_MAYMOVE)
+            if (mapped(old_bytes) && mapped(new_bytes)) {
+                if (round_up(old_bytes) == round_up(new_bytes)) {
+                    return ptr;
+                }
+                void* p = ::mremap(ptr, round_up(old_bytes), round_up(new_bytes), MREMAP_MAYMOVE);
+                return p == MAP_FAILED ? nullptr : p;
+            }
+#endif
+
+            // 跨越阈值, 或不支持mremap: 分配新的空间并复制
+            void* p = allocate(layout, new_len);
+            if (p != nullptr) {
+                std::memcpy(p, ptr, old_bytes < new_bytes ? old_bytes : new_bytes);
+                deallocate(ptr, layout, old_len);
+            }
+            return p;
+        }
+    };
+
+    static_assert(concepts::Reallocator<MmapAllocator>);
+    static_assert(concepts::AllocateAtLeast<MmapAllocator>);
+    static_assert(concepts::GrowAtLeast<MmapAllocator>);
+}
+
+#endif // __has_include(<sys/mman.h>)
+
+#endif //MODERN_STL_MMAP_ALLOCATOR_H
@@ -0,0 +1,280 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef MODERN_STL_POOL_ALLOCATOR_H
+#define MODERN_STL_POOL_ALLOCATOR_H
+
+#include <memory>
+#include <cstddef>
+#include "../layout.h"
+#include "allocator.h"
+#include "allocator_concept.h"
+
+namespace mstl::memory::allocator {
+
+    /**
+     * @brief 按大小分级的节点池.
+     *
+     * 节点池把不超过`MAX_SLOT_SIZE`字节的分配请求按`GRANULE`字节向上取整, 归入对应的大小级别(size class).
+     * 每个级别从连续的slab中切分出固定大小的slot, 被解分配的slot通过侵入式的空闲链表(free list)回收, 供之后的分配复用.
+     * 因此, 频繁插入和删除节点不会访问上游分配器, 且先后分配的节点在内存中相邻.
+     *
+     * 超过`MAX_SLOT_SIZE`字节, 或对齐要求超过`GRANULE`的请求将直接交给上游分配器.
+     *
+     * NodePool不可复制, 也不可移动. 容器通过`PoolAllocator`引用它. 所有slab在NodePool析构时归还给上游分配器.
+     *
+     * @tparam Upstream 提供slab的上游分配器.
+     */
+    template<concepts::Allocator Upstream = Allocator>
+    class NodePool {
+        struct FreeSlot {
+            FreeSlot* next;
+        };
+
+        struct Slab {
+            Slab* next;
+            usize length;   /// <slab能容纳的GRANULE的数量
+        };
+
+        struct SizeClass {
+            FreeSlot* free = nullptr;  // 空闲链表
+            u8* ptr = nullptr;         // 当前slab中尚未切分的空间
+            u8* end = nullptr;
+        };
+
+    public:
+        static constexpr usize GRANULE = alignof(std::max_align_t);
+        static constexpr usize MAX_SLOT_SIZE = 256;
+        static constexpr usize DEFAULT_SLAB_SIZE = 64 * 1024;
+
+        explicit NodePool(usize slab_size = DEFAULT_SLAB_SIZE, const Upstream& upstream = Upstream{}) noexcept
+        : upstream(upstream), slab_size(slab_size < MIN_SLAB_SIZE ? MIN_SLAB_SIZE : (slab_size + GRANULE - 1) / GRANULE * GRANULE) {}
+
+        NodePool(const NodePool&) = delete;
+        NodePool& operator=(const NodePool&) = delete;
+
+        ~NodePool() {
+            release();
+        }
+
+        /**
+         * @brief 分配空间.
+         *
+         * 若请求的空间能由某个大小级别满足, 则优先从空闲链表中取出slot, 其次从slab中切分; 否则, 使用上游分配器分配空间.
+         *
+         * @return 若分配成功, 则返回指向新分配的空间的首地址的指针; 否则, 返回nullptr.
+         */
+        void* allocate(const Layout& layout, usize length) noexcept {
+            usize bytes = layout.size * length;
+            if (!pooled(bytes, layout.align)) [[unlikely]] {
+                return upstream.allocate(layout, length);
+            }
+
+            SizeClass& sc = classes[class_of(bytes)];
+            if (sc.free != nullptr) [[likely]] {
+                FreeSlot* slot = sc.free;
+                sc.free = slot->next;
+                return slot;
+            }
+            return carve(sc, slot_size(class_of(bytes)));
+        }
+
+        /**
+         * @brief 分配空间, 并返回实际能容纳的对象数量.
+         *
+         * 由大小级别满足的请求将得到整个slot.
+         */
+        Allocation allocate_at_least(const Layout& layout, usize length) noexcept {
+            usize bytes = layout.size * length;
+            if (!pooled(bytes, layout.align)) [[unlikely]] {
+                return memory::allocate_at_least(upstream, layout, length);
+            }
+
+            void* ptr = allocate(layout, length);
+            if (ptr == nullptr) {
+                return {nullptr, 0};
+            }
+            return {ptr, layout.size == 0 ? length : slot_size(class_of(bytes)) / layout.size};
+        }
+
+        /**
+         * @brief 解分配空间.
+         *
+         * layout必须与分配时所使用的参数相同, length必须介于分配时请求的数量与`allocate_at_least`返回的数量之间. 被解分配的slot将被放入对应大小级别的空闲链表.
+         */
+        void deallocate(void* ptr, const Layout& layout, usize length) noexcept {
+            if (ptr == nullptr) {
+                return;
+            }
+            usize bytes = layout.size * length;
+            if (!pooled(bytes, layout.align)) [[unlikely]] {
+                upstream.deallocate(ptr, layout, length);
+                return;
+            }
+
+            SizeClass& sc = classes[class_of(bytes)];
+            auto* slot = static_cast<FreeSlot*>(ptr);
+            slot->next = sc.free;
+            sc.free = slot;
+        }
+
+        /**
+         * @brief 把所有slab归还给上游分配器.
+         *
+         * 所有通过该节点池分配的slot都将失效.
+         */
+        void release() noexcept {
+            while (slabs != nullptr) {
+                Slab* next = slabs->next;
+                upstream.deallocate(slabs, SLAB_UNIT, slabs->length);
+                slabs = next;
+            }
+            for (auto& sc: classes) {
+                sc = SizeClass{};
+            }
+        }
+
+        /**
+         * @brief 检查该节点池从上游分配器持有的空间大小.
+         * @return 所有slab的大小之和(字节).
+         */
+        usize reserved() const noexcept {
+            usize total = 0;
+            for (Slab* s = slabs; s != nullptr; s = s->next) {
+                total += s->length * GRANULE;
+            }
+            return total;
+        }
+
+    private:
+        static constexpr usize CLASS_COUNT = MAX_SLOT_SIZE / GRANULE;
+        static constexpr usize SLAB_HEADER = (sizeof(Slab) + GRANULE - 1) / GRANULE * GRANULE;
+        static constexpr usize MIN_SLAB_SIZE = SLAB_HEADER + MAX_SLOT_SIZE;
+
+        Upstream upstream;
+        usize slab_size;
+        Slab* slabs = nullptr;
+        SizeClass classes[CLASS_COUNT]{};
+
+        static constexpr bool pooled(usize bytes, usize align) noexcept {
+            return bytes <= MAX_SLOT_SIZE && align <= GRANULE;
+        }
+
+        static constexpr usize class_of(usize bytes) noexcept {
+            return bytes == 0 ? 0 : (bytes - 1) / GRANULE;
+        }
+
+        static constexpr usize slot_size(usize cls) noexcept {
+            return (cls + 1) * GRANULE;
+        }
+
+        static constexpr Layout SLAB_UNIT = Layout::from_size_align_unchecked(GRANULE, GRANULE);
+
+        void* carve(SizeClass& sc, usize size) noexcept {
+            if (usize(sc.end - sc.ptr) < size) {
+                // 上游分配器返回的空间可能大于请求的大小, 记录实际的大小以切分更多slot
+                auto block = memory::allocate_at_least(upstream, SLAB_UNIT, slab_size / GRANULE);
+                auto* slab = static_cast<Slab*>(block.ptr);
+                if (slab == nullptr) {
+                    return nullptr;
+                }
+                slab->next = slabs;
+                slab->length = block.length;
+                slabs = slab;
+                sc.ptr = reinterpret_cast<u8*>(slab) + SLAB_HEADER;
+                sc.end = reinterpret_cast<u8*>(slab) + block.length * GRANULE;
+            }
+            void* p = sc.ptr;
+            sc.ptr += size;
+            return p;
+        }
+    };
+
+    /**
+     * @brief 从`NodePool`中分配空间的分配器.
+     *
+     * PoolAllocator储存节点池的指针, 可被复制. 两个PoolAllocator当且仅当引用同一个节点池时相等; 都不引用节点池时, 比较其上游分配器.
+     * 默认构造的PoolAllocator不引用任何节点池, 它直接使用上游分配器分配和解分配空间.
+     *
+     * ## Example
+     * @code
+     *      NodePool<> pool;
+     *      List<int, PoolAllocator<>> ls{PoolAllocator<>{pool}};
+     *      ls.push_back(1);  // 节点从pool中分配
+     * @endcode
+     *
+     * @tparam Upstream 上游分配器
+     */
+    template<concepts::Allocator Upstream = Allocator>
+    class PoolAllocator {
+    public:
+        using PoolType = NodePool<Upstream>;
+
+        PoolAllocator() noexcept : pool(nullptr) {}
+        explicit PoolAllocator(PoolType& pool) noexcept : pool(&pool) {}
+        /// 不引用节点池, 直接使用给定的(可能带有状态的)上游分配器
+        explicit PoolAllocator(const Upstream& upstream) noexcept : pool(nullptr), upstream(upstream) {}
+
+        void* allocate(const Layout& layout, usize length) noexcept {
+            if (pool == nullptr) {
+                return upstream.allocate(layout, length);
+            }
+            return pool->allocate(layout, length);
+        }
+
+        Allocation allocate_at_least(const Layout& layout, usize length) noexcept {
+            if (pool == nullptr) {
+                return memory::allocate_at_least(upstream, layout, length);
+            }
+            return pool->allocate_at_least(layout, length);
+        }
+
+        template <typename T>
+        constexpr T* allocate(usize length) noexcept {
+            if (std::is_constant_evaluated()) {
+                std::allocator<T> a;
+                return a.allocate(length);
+            } else {
+                constexpr Layout layout = Layout::from_type<T>();
+                return (T*) allocate(layout, length);
+            }
+        }
+
+        void deallocate(void* ptr, const Layout& layout, usize length) noexcept {
+            if (pool == nullptr) {
+                upstream.deallocate(ptr, layout, length);
+            } else {
+                pool->deallocate(ptr, layout, length);
+            }
+        }
+
+        template<typename T>
+        constexpr void deallocate(T* ptr, usize length) {
+            if (std::is_constant_evaluated()) {
+                std::allocator<T> a;
+                a.deallocate(ptr, length);
+            } else {
+                constexpr auto layout = Layout::from_type<T>();
+                deallocate(ptr, layout, length);
+            }
+        }
+
+        /// 获取该分配器所引用的节点池. 若未引用任何节点池, 则返回nullptr.
+        PoolType* get_pool() const noexcept {
+            return pool;
+        }
+
+        constexpr bool operator==(const PoolAllocator& rhs) const {
+            return pool == rhs.pool && (pool != nullptr || upstream == rhs.upstream);
+        }
+
+    private:
+        PoolType* pool;
+        Upstream upstream{};    // 仅在未引用节点池时使用; 引用节点池时, 超出大小级别的请求由节点池自身的上游分配器满足
+    };
+
+    static_assert(concepts::AllocateAtLeast<PoolAllocator<>>);
+}
+
+#endif //MODERN_STL_POOL_ALLOCATOR_H
@@ -0,0 +1,335 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef MODERN_STL_SLAB_ALLOCATOR_H
+#define MODERN_STL_SLAB_ALLOCATOR_H
+
+#include <memory>
+#include <atomic>
+#include <cstddef>
+#include <concepts>
+#include "../layout.h"
+#include "allocator.h"
+#include "allocator_concept.h"
+
+namespace mstl::memory::allocator {
+
+    /**
+     * @brief 供多个线程并发使用的, 分配固定大小slot的无锁slab分配器.
+     *
+     * 大小不超过`SlotSize`字节且对齐要求不超过`SlotAlign`的请求将得到一个slot, 其余请求直接交给上游分配器.
+     *
+     * 每个线程持有两个弹匣(magazine), 每个弹匣最多缓存`BATCH`个空闲slot, 绝大多数分配与解分配只访问当前线程的弹匣.
+     * 弹匣为空或已满时, 线程才与全局仓库(depot)交换一整批slot. 仓库是以带标签指针(tagged pointer)防止ABA问题的Treiber栈,
+     * 每次交换只需一次CAS操作. 仓库也为空时, 线程从上游分配器分配新的slab并将其切分为若干批slot.
+     *
+     * 相同模板参数的所有SlabAllocator共用一个全局的仓库, 因此SlabAllocator是无状态的, 其所有实例均相等.
+     * 在一个线程中分配的slot可以在另一个线程中解分配. slab在程序运行期间不会被归还给上游分配器.
+     *
+     * ## Example
+     * @code
+     *      ForwardList<i32, SlabAllocator<32>> ls;  // 所有线程的节点都从slab中分配
+     *      ls.push_front(1);
+     * @endcode
+     *
+     * @tparam SlotSize slot的大小(字节)
+     * @tparam SlotAlign slot的对齐
+     * @tparam Upstream 提供slab的上游分配器, 必须是无状态的
+     */
+    template<usize SlotSize, usize SlotAlign = alignof(std::max_align_t), concepts::Allocator Upstream = Allocator>
+    requires std::default_initializable<Upstream> && (SlotAlign != 0) && ((SlotAlign & (SlotAlign - 1)) == 0)
+    class SlabAllocator {
+        struct Slot {
+            Slot* next;         // 同一批中的下一个slot
+            Slot* next_batch;   // 仅对仓库中每批的第一个slot有效
+        };
+
+        struct Slab {
+            Slab* next;
+        };
+
+    public:
+        static constexpr usize SLOT_ALIGN = SlotAlign < alignof(Slot) ? alignof(Slot) : SlotAlign;
+        static constexpr usize SLOT_SIZE = ((SlotSize < sizeof(Slot) ? sizeof(Slot) : SlotSize) + SLOT_ALIGN - 1) / SLOT_ALIGN * SLOT_ALIGN;
+        static constexpr usize BATCH = 32;
+        static constexpr usize SLAB_SIZE = 64 * 1024;
+
+        void* allocate(const Layout& layout, usize length) noexcept {
+            if (!slotted(layout.size * length, layout.align)) [[unlikely]] {
+                return Upstream{}.allocate(layout, length);
+            }
+
+            Magazines* mags = Magazines::get();
+            if (mags == nullptr) [[unlikely]] {
+                // 当前线程的弹匣已被销毁
+                Slot* batch = depot().pop();
+                if (batch == nullptr) {
+                    batch = carve();
+                }
+                if (batch != nullptr && batch->next != nullptr) {
+                    depot().push(batch->next);
+                }
+                return batch;
+            }
+
+            Magazine& loaded = mags->loaded;
+            if (loaded.head == nullptr) [[unlikely]] {
+                if (!mags->refill()) {
+                    return nullptr;
+                }
+            }
+            Slot* slot = loaded.head;
+            loaded.head = slot->next;
+            loaded.count--;
+            return slot;
+        }
+
+        template <typename T>
+        constexpr T* allocate(usize length) noexcept {
+            if (std::is_constant_evaluated()) {
+                std::allocator<T> a;
+                return a.allocate(length);
+            } else {
+                constexpr Layout layout = Layout::from_type<T>();
+                return (T*) allocate(layout, length);
+            }
+        }
+
+        void deallocate(void* ptr, const Layout& layout, usize length) noexcept {
+            if (ptr == nullptr) {
+                return;
+            }
+            if (!slotted(layout.size * length, layout.align)) [[unlikely]] {
+                Upstream{}.deallocate(ptr, layout, length);
+                return;
+            }
+
+            auto* slot = static_cast<Slot*>(ptr);
+            Magazines* mags = Magazines::get();
+            if (mags == nullptr) [[unlikely]] {
+                slot->next = nullptr;
+                depot().push(slot);
+                return;
+            }
+
+            if (mags->loaded.count == BATCH) [[unlikely]] {
+                mags->spill();
+            }
+            Magazine& loaded = mags->loaded;
+            slot->next = loaded.head;
+            loaded.head = slot;
+            loaded.count++;
+        }
+
+        template<typename T>
+        constexpr void deallocate(T* ptr, usize length) {
+            if (std::is_constant_evaluated()) {
+                std::allocator<T> a;
+                a.deallocate(ptr, length);
+            } else {
+                constexpr auto layout = Layout::from_type<T>();
+                deallocate(ptr, layout, length);
+            }
+        }
+
+        /**
+         * @brief 检查所有线程从上游分配器持有的slab的大小之和(字节).
+         */
+        static usize reserved() noexcept {
+            return depot().reserved.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief 检查当前线程的弹匣中缓存的slot数量.
+         */
+        static usize cached() noexcept {
+            Magazines* mags = Magazines::get();
+            return mags == nullptr ? 0 : mags->loaded.count + mags->spare.count;
+        }
+
+        constexpr bool operator==(const SlabAllocator&) const {
+            return true;
+        }
+
+    private:
+        static_assert(sizeof(void*) == 8, "SlabAllocator packs the ABA tag into the upper 16 bits of a pointer");
+
+        static constexpr usize SLAB_HEADER = (sizeof(Slab) + SLOT_ALIGN - 1) / SLOT_ALIGN * SLOT_ALIGN;
+        static constexpr usize SLOTS_PER_SLAB = SLAB_SIZE < SLAB_HEADER + BATCH * SLOT_SIZE ? BATCH : (SLAB_SIZE - SLAB_HEADER) / SLOT_SIZE;
+        static constexpr Layout SLAB_LAYOUT = Layout::from_size_align_unchecked(SLAB_HEADER + SLOTS_PER_SLAB * SLOT_SIZE, SLOT_ALIGN);
+
+        static constexpr bool slotted(usize bytes, usize align) noexcept {
+            return bytes <= SLOT_SIZE && align <= SLOT_ALIGN;
+        }
+
+        /**
+         * 以批为单位储存空闲slot的Treiber栈.
+         *
+         * 栈顶是一个64位的字, 低48位为指针, 高16位为每次修改时递增的标签, 以防止ABA问题.
+         * 出栈时读取的`next_batch`可能已被其它线程改写, 但此时标签已改变, CAS必定失败. slab从不被释放, 因此该读取总是访问有效的内存.
+         */
+        struct Depot {
+            static constexpr u64 PTR_MASK = (u64(1) << 48) - 1;
+            static constexpr u64 TAG_ONE = u64(1) << 48;
+
+            std::atomic<u64> top{0};
+            std::atomic<Slab*> slabs{nullptr};
+            std::atomic<usize> reserved{0};
+
+            static Slot* ptr_of(u64 word) noexcept {
+                return reinterpret_cast<Slot*>(word & PTR_MASK);
+            }
+
+            static u64 pack(Slot* p, u64 old) noexcept {
+                return (reinterpret_cast<u64>(p) & PTR_MASK) | ((old & ~PTR_MASK) + TAG_ONE);
+            }
+
+            /// 把从first到last的若干批slot压入栈中
+            void push(Slot* first, Slot* last) noexcept {
+                u64 old = top.load(std::memory_order_relaxed);
+                do {
+                    last->next_batch = ptr_of(old);
+                } while (!top.compare_exchange_weak(old, pack(first, old),
+                                                    std::memory_order_release, std::memory_order_relaxed));
+            }
+
+            void push(Slot* batch) noexcept {
+                push(batch, batch);
+            }
+
+            Slot* pop() noexcept {
+                u64 old = top.load(std::memory_order_acquire);
+                Slot* batch;
+                do {
+                    batch = ptr_of(old);
+                    if (batch == nullptr) {
+                        return nullptr;
+                    }
+                } while (!top.compare_exchange_weak(old, pack(batch->next_batch, old),
+                                                    std::memory_order_acquire, std::memory_order_acquire));
+                return batch;
+            }
+        };
+
+        // 仓库永不析构: 其它线程退出时仍可能把slot归还给它
+        static Depot& depot() noexcept {
+            static Depot* d = new Depot;
+            return *d;
+        }
+
+        /**
+         * 从上游分配器分配新的slab, 切分为若干批slot. 返回第一批, 其余批次被压入仓库.
+         */
+        static Slot* carve() noexcept {
+            auto* slab = static_cast<Slab*>(Upstream{}.allocate(SLAB_LAYOUT, 1));
+            if (slab == nullptr) {
+                return nullptr;
+            }
+            Depot& d = depot();
+            slab->next = d.slabs.load(std::memory_order_relaxed);
+            while (!d.slabs.compare_exchange_weak(slab->next, slab, std::memory_order_relaxed)) {}
+            d.reserved.fetch_add(SLAB_LAYOUT.size, std::memory_order_relaxed);
+
+            u8* base = reinterpret_cast<u8*>(slab) + SLAB_HEADER;
+            auto slot_at = [base](usize i) { return reinterpret_cast<Slot*>(base + i * SLOT_SIZE); };
+
+            Slot* prev_batch = nullptr;
+            for (usize i = 0; i < SLOTS_PER_SLAB; i++) {
+                Slot* s = slot_at(i);
+                bool batch_end = (i + 1) % BATCH == 0 || i + 1 == SLOTS_PER_SLAB;
+                s->next = batch_end ? nullptr : slot_at(i + 1);
+                if (i % BATCH == 0) {
+                    if (prev_batch != nullptr) {
+                        prev_batch->next_batch = s;
+                    }
+                    prev_batch = s;
+                }
+            }
+
+            Slot* first = slot_at(0);
+            if (SLOTS_PER_SLAB > BATCH) {
+                d.push(slot_at(BATCH), prev_batch);
+            }
+            return first;
+        }
+
+        struct Magazine {
+            Slot* head = nullptr;
+            usize count = 0;
+
+            void take(Slot* batch) noexcept {
+                head = batch;
+                count = 0;
+                for (Slot* s = batch; s != nullptr; s = s->next) {
+                    count++;
+                }
+            }
+        };
+
+        /**
+         * 每个线程的两个弹匣. spare要么为空, 要么已满, 以避免在批次边界处反复访问仓库.
+         */
+        struct Magazines {
+            Magazine loaded;
+            Magazine spare;
+
+            Magazines() noexcept {
+                destroyed() = false;
+            }
+
+            ~Magazines() {
+                if (loaded.head != nullptr) {
+                    depot().push(loaded.head);
+                }
+                if (spare.head != nullptr) {
+                    depot().push(spare.head);
+                }
+                destroyed() = true;
+            }
+
+            /// loaded为空时调用
+            bool refill() noexcept {
+                if (spare.count != 0) {
+                    std::swap(loaded, spare);
+                    return true;
+                }
+                Slot* batch = depot().pop();
+                if (batch == nullptr) {
+                    batch = carve();
+                    if (batch == nullptr) {
+                        return false;
+                    }
+                }
+                loaded.take(batch);
+                return true;
+            }
+
+            /// loaded已满时调用
+            void spill() noexcept {
+                if (spare.count != 0) {
+                    depot().push(spare.head);
+                }
+                spare = loaded;
+                loaded = Magazine{};
+            }
+
+            static bool& destroyed() noexcept {
+                thread_local bool flag = false;
+                return flag;
+            }
+
+            static Magazines* get() noexcept {
+                if (destroyed()) [[unlikely]] {
+                    return nullptr;
+                }
+                thread_local Magazines mags;
+                return &mags;
+            }
+        };
+    };
+
+    static_assert(concepts::Allocator<SlabAllocator<32>>);
+}
+
+#endif //MODERN_STL_SLAB_ALLOCATOR_H
@@ -8,7 +8,9 @@
 #include <mstl/basic_concepts.h>
 #include <mstl/result/result.h>
 #include <mstl/global.h>
+#include <mstl/utility/tuple.h>
 #include <bit>
+#include <limits>
 #include "layout_error.h"
 
 namespace mstl::memory {
@@ -56,6 +58,91 @@ namespace mstl::memory {
             return {size, align};
         }
 
+        /**
+         * @brief 生成能容纳n个T类型的对象的数组的Layout.
+         * @return 若数组的大小溢出, 则返回`LayoutError`.
+         */
+        template<class T>
+        requires (!basic::RefType<T>)
+        constexpr static mstl::result::Result<Layout, LayoutError> array(usize n) {
+            auto res = from_type<T>().repeat(n);
+            if (res.is_err()) {
+                return {LayoutError{}};
+            }
+            return {res.unwrap_unchecked().first()};
+        }
+
+        /**
+         * @brief 计算在该Layout所描述的对象之后, 为满足align对齐所需的填充字节数.
+         *
+         * align必须为2的幂.
+         */
+        constexpr usize padding_needed_for(usize align) const {
+            usize rounded = (size + align - 1) & ~(align - 1);
+            return rounded - size;
+        }
+
+        /**
+         * @brief 把大小向上取整至对齐的整数倍.
+         *
+         * 所得的Layout即该对象作为数组元素时所占用的空间.
+         */
+        constexpr Layout pad_to_align() const {
+            return {size + padding_needed_for(align), align};
+        }
+
+        /**
+         * @brief 生成连续存放n个该Layout所描述的对象的Layout.
+         *
+         * 每个对象之间填充至对齐的整数倍.
+         *
+         * ## Example
+         * @code
+         *      auto res = Layout::from_size_align_unchecked(6, 4).repeat(3).unwrap();
+         *      // res.first().size == 24, res.second() == 8
+         * @endcode
+         *
+         * @return 新的Layout, 以及相邻两个对象的首地址之间的距离; 若大小溢出, 则返回`LayoutError`.
+         */
+        constexpr mstl::result::Result<utility::Pair<Layout, usize>, LayoutError> repeat(usize n) const {
+            usize stride = pad_to_align().size;
+            if (n != 0 && stride > std::numeric_limits<usize>::max() / n) {
+                return {LayoutError{}};
+            }
+            return {utility::make_pair(Layout{stride * n, align}, stride)};
+        }
+
+        /**
+         * @brief 生成在该Layout所描述的对象之后存放next所描述的对象的Layout.
+         *
+         * next所描述的对象将被放置在满足其对齐要求的最小偏移处. 新的Layout的对齐为二者之中较大的对齐.
+         * 新的Layout不包含尾部的填充; 若需将其作为数组元素, 应调用`pad_to_align()`.
+         *
+         * ## Example
+         * @code
+         *      // struct { Header h; T data[n]; } 的布局
+         *      auto res = Layout::from_type<Header>().extend(Layout::array<T>(n).unwrap()).unwrap();
+         *      auto* h = (Header*)alloc.allocate(res.first().pad_to_align(), 1);
+         *      auto* data = (T*)((u8*)h + res.second());
+         * @endcode
+         *
+         * @return 新的Layout, 以及next所描述的对象的偏移量; 若大小溢出, 则返回`LayoutError`.
+         */
+        constexpr mstl::result::Result<utility::Pair<Layout, usize>, LayoutError> extend(const Layout& next) const {
+            usize new_align = align > next.align ? align : next.align;
+            usize pad = padding_needed_for(next.align);
+            constexpr usize MAX = std::numeric_limits<usize>::max();
+            if (size > MAX - pad || size + pad > MAX - next.size) {
+                return {LayoutError{}};
+            }
+            usize offset = size + pad;
+            return {utility::make_pair(Layout{offset + next.size, new_align}, offset)};
+        }
+
+        constexpr bool operator==(const Layout& rhs) const {
+            return size == rhs.size && align == rhs.align;
+        }
+
     private:
         constexpr Layout(usize s, usize a): size(s), align(a) {}
     };
@@ -6,7 +6,16 @@
 #define MODERN_STL_MEMORY_H
 
 #include "layout.h"
+#include "relocatable.h"
 #include "allocators/allocator_concept.h"
 #include "allocators/allocator.h"
+#include "allocators/arena_allocator.h"
+#include "allocators/pool_allocator.h"
+#include "allocators/caching_allocator.h"
+#include "allocators/slab_allocator.h"
+#include "allocators/instrumented_allocator.h"
+#include "allocators/inline_allocator.h"
+#include "allocators/mmap_allocator.h"
+#include "allocators/file_allocator.h"
 
 #endif //MODERN_STL_MEMORY_H
@@ -0,0 +1,61 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef MODERN_STL_RELOCATABLE_H
+#define MODERN_STL_RELOCATABLE_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <type_traits>
+
+namespace mstl::memory {
+
+    /**
+     * @brief 检查T是否可平凡重定位(trivially relocatable).
+     *
+     * 若把一个T对象按字节复制到新的位置, 并且不再析构原对象, 其效果等同于移动构造一个新对象并析构原对象,
+     * 则称T可平凡重定位. 容器可以`memcpy`/`memmove`移动这类元素, 而无需逐个移动构造与析构.
+     *
+     * 可按字节复制的类型均可平凡重定位. 其它不持有指向自身的指针的类型可通过特化该模板以声明:
+     * @code
+     *      template<>
+     *      struct mstl::memory::IsTriviallyRelocatable<MyType>: std::true_type {};
+     * @endcode
+     *
+     * @note libstdc++与MSVC的`std::string`在短字符串优化时持有指向自身的指针, 因此仅在libc++中被视为可平凡重定位.
+     */
+    template<typename T>
+    struct IsTriviallyRelocatable: std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+    template<typename T, typename D>
+    struct IsTriviallyRelocatable<std::unique_ptr<T, D>>: IsTriviallyRelocatable<D> {};
+
+    template<typename T>
+    struct IsTriviallyRelocatable<std::shared_ptr<T>>: std::true_type {};
+
+    template<typename T>
+    struct IsTriviallyRelocatable<std::weak_ptr<T>>: std::true_type {};
+
+    template<typename T>
+    struct IsTriviallyRelocatable<std::vector<T, std::allocator<T>>>: std::true_type {};
+
+#ifdef _LIBCPP_VERSION
+    template<typename C, typename Traits>
+    struct IsTriviallyRelocatable<std::basic_string<C, Traits, std::allocator<C>>>: std::true_type {};
+#endif
+
+    template<typename T>
+    constexpr bool IsTriviallyRelocatableV = IsTriviallyRelocatable<std::remove_cv_t<T>>::value;
+}
+
+namespace mstl::memory::concepts {
+    /**
+     * 可平凡重定位的类型. 参见`IsTriviallyRelocatable`.
+     */
+    template<typename T>
+    concept TriviallyRelocatable = IsTriviallyRelocatableV<T>;
+}
+
+#endif //MODERN_STL_RELOCATABLE_H
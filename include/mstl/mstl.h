@@ -12,6 +12,7 @@
 #include "collection/array.h"
 #include "collection/linked_list.h"
 #include "collection/vector.h"
+#include "collection/small_vector.h"
 #include "iter/iterator.h"
 #include "memory/memory.h"
 #include "ops/ops.h"
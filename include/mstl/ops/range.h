@@ -132,6 +132,34 @@ namespace mstl::ops {
             return !(low < high);
         }
 
+        /// impl InternalIterator
+        template<typename F>
+        MSTL_INLINE constexpr
+        void for_each_internal(F&& f) requires Inc<Idx> {
+            for (; low < high; low++) {
+                f(Idx{low});
+            }
+        }
+
+        template<typename Acc, typename F>
+        MSTL_INLINE constexpr
+        bool try_fold(Acc& acc, F&& f) requires Inc<Idx> {
+            while (low < high) {
+                Idx value = low;
+                low++;
+                if (!f(acc, std::move(value))) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /// impl ExactSizeIterator: 整数区间的剩余元素数量
+        MSTL_INLINE constexpr
+        usize len() requires std::integral<Idx> {
+            return is_empty() ? 0 : usize(high - low);
+        }
+
         constexpr RangeCursor<Idx> begin()
         requires Inc<Idx> && Dec<Idx> {
             return { low };
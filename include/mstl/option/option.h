@@ -89,10 +89,10 @@ namespace mstl {
         }
 
         constexpr Option(Option&& other) noexcept
-        requires (!basic::Movable<T>) = delete;
+        requires (!std::move_constructible<T>) = delete;
 
         constexpr Option(Option&& other) noexcept
-        requires basic::Movable<T> {
+        requires std::move_constructible<T> {
             hold_value = other.hold_value;
 
             if (hold_value) {
@@ -104,16 +104,18 @@ namespace mstl {
         }
 
         constexpr Option& operator=(Option&& other) noexcept
-        requires (!basic::Movable<T>) = delete;
+        requires (!std::move_constructible<T>) = delete;
 
+        /// 赋值替换所持有的值, 而不是对其赋值: T为持有引用的元组时, 后者会修改引用所指的对象
         constexpr Option& operator=(Option&& other) noexcept
-        requires basic::Movable<T> {
+        requires std::move_constructible<T> {
             if (this == &other) {
                 return *this;
             }
             if (hold_value == other.hold_value) {
                 if (hold_value) {
-                    value = std::move(other.value);
+                    destroy_val();
+                    construct_val(std::move(other.value));
                 }
             } else {
                 hold_value = other.hold_value;
@@ -131,10 +133,10 @@ namespace mstl {
         }
 
         constexpr Option(const Option& other)
-        requires (!basic::CopyAble<T>) = delete;
+        requires (!std::copy_constructible<T>) = delete;
 
         constexpr Option(const Option& other)
-        requires basic::CopyAble<T> {
+        requires std::copy_constructible<T> {
             hold_value = other.hold_value;
 
             if (hold_value) {
@@ -145,16 +147,19 @@ namespace mstl {
         }
 
         constexpr Option& operator=(const Option& other)
-        requires (!basic::CopyAble<T>) = delete;
+        requires (!std::copy_constructible<T>) = delete;
 
         constexpr Option& operator=(const Option& other)
-        requires basic::CopyAble<T> {
+        requires std::copy_constructible<T> {
             if (this == &other) {
                 return *this;
             }
             if (hold_value == other.hold_value) {
                 if (hold_value) {
-                    value = other.value;
+                    // 先复制再替换, 复制抛出异常时原有的值不受影响
+                    T copy(other.value);
+                    destroy_val();
+                    construct_val(std::move(copy));
                 }
             } else {
                 hold_value = other.hold_value;
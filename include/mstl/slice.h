@@ -5,11 +5,13 @@
 #ifndef __MODERN_STL_SLICE_H__
 #define __MODERN_STL_SLICE_H__
 
+#include <concepts>
 #include <mstl/global.h>
 #include <mstl/intrinsics.h>
 #include <mstl/basic_concepts.h>
 #include <mstl/ops/range.h>
 #include <mstl/option/option.h>
+#include <mstl/iter/iter_chunk.h>
 
 namespace mstl {
     template<typename T, typename I>
@@ -65,6 +67,38 @@ namespace mstl {
             return start;
         }
 
+        /// impl ChunkedIterator
+        template<usize N>
+        MSTL_INLINE constexpr
+        iter::IterChunk<Item, N> next_chunk() {
+            iter::IterChunk<Item, N> chunk;
+            const usize n = len() < N ? len() : N;
+            for (usize i = 0; i < n; i++) {
+                chunk.push(*start++);
+            }
+            return chunk;
+        }
+
+        /// impl InternalIterator
+        template<typename F>
+        MSTL_INLINE constexpr
+        void for_each_internal(F&& f) {
+            for (; start != end; start++) {
+                f(*start);
+            }
+        }
+
+        template<typename Acc, typename F>
+        MSTL_INLINE constexpr
+        bool try_fold(Acc& acc, F&& f) {
+            while (start != end) {
+                if (!f(acc, *start++)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
     private:
         T* start = nullptr;
         T* end = nullptr;
@@ -83,6 +117,11 @@ namespace mstl {
         constexpr Slice(T *ptr, usize size): ptr(ptr), size(size) {}
 
         constexpr Slice(const Slice&) = default;
+
+        /// 由Slice<U>转换为只读的Slice<const U>
+        template<typename U>
+        requires std::same_as<T, const U>
+        constexpr Slice(const Slice<U>& other): ptr(other.as_ptr()), size(other.len()) {}
         constexpr Slice& operator=(const Slice& other) = default;
 
         MSTL_INLINE constexpr
@@ -113,6 +152,21 @@ namespace mstl {
             return ptr;
         }
 
+        MSTL_INLINE constexpr
+        T* as_ptr() const {
+            return ptr;
+        }
+
+        MSTL_INLINE constexpr
+        usize len() const {
+            return size;
+        }
+
+        MSTL_INLINE constexpr
+        bool is_empty() const {
+            return size == 0;
+        }
+
     private:
         T* ptr = nullptr;
         usize size = 0;
@@ -7,6 +7,7 @@
 
 // std
 #include <cstdlib>
+#include <cstring>
 #include <algorithm>
 
 #include <mstl/slice.h>
@@ -39,11 +40,11 @@ namespace mstl::str {
 
     template <typename Encoding, memory::concepts::Allocator Allocator = memory::allocator::Allocator>
     class BasicString {
-        friend std::ostream& operator<<(std::ostream& os, const mstl::str::BasicString<Encoding>& str) {
-            if (str.len < LOCAL_STORAGE_SIZE) {
-                os.write(reinterpret_cast<const char *>(&str.storage.local[0]), str.len);
-            } else {
+        friend std::ostream& operator<<(std::ostream& os, const BasicString& str) {
+            if (str.on_heap()) {
                 os.write(reinterpret_cast<const char *>(str.alloc.bytes), str.len);
+            } else {
+                os.write(reinterpret_cast<const char *>(&str.storage.local[0]), str.len);
             }
             return os;
         }
@@ -55,7 +56,7 @@ namespace mstl::str {
         constexpr BasicString() = default;
         constexpr BasicString(Allocator&& a): alloc(std::forward<Allocator&&>(a)) {}
         constexpr ~BasicString() {
-            if (this->len > LOCAL_STORAGE_SIZE) {
+            if (on_heap()) {
                 alloc.deallocate(alloc.bytes, LAYOUT, storage.cap);
             }
         }
@@ -78,7 +79,7 @@ namespace mstl::str {
         constexpr BasicString(const BasicString& other) {
             this->len = other.len;
 
-            if (other.len > LOCAL_STORAGE_SIZE) {
+            if (other.on_heap()) {
                 // FIXME: 可能会溢出
                 storage.cap = other.storage.cap;
                 alloc.bytes = (u8*)alloc.allocate(LAYOUT, storage.cap);
@@ -102,13 +103,13 @@ namespace mstl::str {
             // 4. heap    |   heap
 
             // 1. 直接复制 local storage
-            if (this->len < LOCAL_STORAGE_SIZE && other.len < LOCAL_STORAGE_SIZE) {
+            if (!this->on_heap() && !other.on_heap()) {
                 this->len = other.len;
                 this->alloc = other.alloc;
                 this->storage = other.storage;
             }
             // 2. this 需要分配空间
-            else if (this->len < LOCAL_STORAGE_SIZE && other.len > LOCAL_STORAGE_SIZE) {
+            else if (!this->on_heap() && other.on_heap()) {
                 this->len = other.len;
                 this->alloc = other.alloc;
                 this->storage.cap = other.storage.cap;
@@ -117,9 +118,10 @@ namespace mstl::str {
                 copy(this->alloc.bytes, other.alloc.bytes, other.len);
             }
             // 3. 需要解分配 this 的空间
-            else if (this->len > LOCAL_STORAGE_SIZE && other.len < LOCAL_STORAGE_SIZE) {
+            else if (this->on_heap() && !other.on_heap()) {
                 // deallocate before replace allocator
                 this->alloc.deallocate(this->alloc.bytes, LAYOUT, this->storage.cap);
+                this->alloc.bytes = nullptr;
                 this->alloc = other.alloc;
 
                 this->len = other.len;
@@ -166,7 +168,7 @@ namespace mstl::str {
             // 4. heap    |   heap
 
             // 1. 直接复制 local storage
-            if (this->len < LOCAL_STORAGE_SIZE && other.len < LOCAL_STORAGE_SIZE) {
+            if (!this->on_heap() && !other.on_heap()) {
                 this->len = other.len;
                 this->alloc = std::move(other.alloc);
                 this->storage = other.storage;
@@ -174,7 +176,7 @@ namespace mstl::str {
                 other.len = 0;
             }
             // 2. 需要将 other.bytes other.len other.cap 置为空
-            else if (this->len < LOCAL_STORAGE_SIZE && other.len > LOCAL_STORAGE_SIZE) {
+            else if (!this->on_heap() && other.on_heap()) {
                 this->len = other.len;
                 this->alloc = std::move(other.alloc);
                 this->alloc.bytes = other.alloc.bytes;
@@ -185,9 +187,10 @@ namespace mstl::str {
                 other.storage.cap = 0;
             }
             // 3. 需要将 this.bytes 解分配 复制 other.storage
-            else if (this->len > LOCAL_STORAGE_SIZE && other.len < LOCAL_STORAGE_SIZE) {
+            else if (this->on_heap() && !other.on_heap()) {
                 // deallocate before replace allocator
                 this->alloc.deallocate(this->alloc.bytes, LAYOUT, this->storage.cap);
+                this->alloc.bytes = nullptr;
 
                 this->len = other.len;
                 this->alloc = std::move(other.alloc);
@@ -287,30 +290,51 @@ namespace mstl::str {
             len = new_len;
         }
 
+        /**
+         * @brief 把堆上的空间收缩为恰好能容纳字符串的大小.
+         *
+         * 若字符串能放入本地的空间, 则移回本地并释放堆上的空间; 若字符串储存在本地, 则不做任何事.
+         */
         constexpr void shrink_to_fit() {
-            // TODO
+            if (!on_heap()) {
+                return;
+            }
+
+            if (len <= LOCAL_STORAGE_SIZE) {
+                // local与cap共用空间, 须先取出cap
+                u8 *heap = alloc.bytes;
+                usize cap = storage.cap;
+                copy(&storage.local[0], heap, len);
+                alloc.deallocate(heap, LAYOUT, cap);
+                alloc.bytes = nullptr;
+            } else if (storage.cap > len) {
+                reallocate_heap(len);
+            }
         }
 
+        /**
+         * @brief 预留至少能容纳new_cap个字节的空间.
+         *
+         * 与`std::string::reserve`相同, 从不收缩空间. 储存在本地的字符串将被移至堆上, 以便之后的插入不再分配.
+         */
         constexpr void reserve(usize new_cap) {
-            using std::strong_ordering;
-            switch (new_cap <=> this->cap) {
-                case strong_ordering::greater: {
-                    this->storage.cap = new_cap;
-                    u8 *new_space = (u8*)alloc.allocate(LAYOUT, new_cap);
-                    // copy to new space
-                    copy(new_space, alloc.bytes, len);
-                    // deallocate
-                    alloc.deallocate(alloc.bytes, LAYOUT, len);
-                    this->bytes = new_space;
-                    break;
-                }
-                case strong_ordering::less:
-                    shrink_to_fit();
-                    break;
-                case strong_ordering::equal:
-                case strong_ordering::equivalent:
-                    break;
+            if (new_cap <= capacity()) {
+                return;
             }
+
+            if (on_heap()) {
+                reallocate_heap(new_cap);
+            } else {
+                AllocateInfo info{};
+                allocate_at_least(new_cap, info);
+                copy(alloc.bytes, &storage.local[0], len);
+                storage.cap = info.new_cap;
+            }
+        }
+
+        /// 不重新分配时能容纳的字节数
+        constexpr usize capacity() const noexcept {
+            return on_heap() ? storage.cap : LOCAL_STORAGE_SIZE;
         }
 
         constexpr bool is_char_boundary(usize idx) {
@@ -326,7 +350,7 @@ namespace mstl::str {
 
                 const auto slice_len = end - start;
                 u8* start_ptr = nullptr;
-                if (len > LOCAL_STORAGE_SIZE) {
+                if (on_heap()) {
                     start_ptr = &this->alloc.bytes[start];
                 } else {
                     start_ptr = &this->storage.local[start];
@@ -347,9 +371,15 @@ namespace mstl::str {
         }
 
     private:
+        /// 字符串是否储存在堆上. 储存在本地时alloc.bytes为空指针
+        MSTL_INLINE constexpr
+        bool on_heap() const noexcept {
+            return alloc.bytes != nullptr;
+        }
+
         MSTL_INLINE constexpr
         Slice<u8> make_slice() {
-            if (this->len > LOCAL_STORAGE_SIZE) {
+            if (on_heap()) {
                 return Slice<u8>::from_raw(alloc.bytes, len);
             } else {
                 return Slice<u8>::from_raw(&storage.local[0], len);
@@ -386,15 +416,20 @@ namespace mstl::str {
 
         /// decide whether to allocate memory based on new_Len
         /// and return the info
-        AllocateInfo try_allocate_new_space(usize new_len) {
+        constexpr AllocateInfo try_allocate_new_space(usize new_len) {
             AllocateInfo info{};
-            if (len > LOCAL_STORAGE_SIZE) {
+            if (on_heap()) {
                 // original data is on heap
                 info.src = alloc.bytes;
                 if (new_len > storage.cap) {
+                    if constexpr (memory::concepts::Reallocator<Allocator>) {
+                        // grow the space in place, so des = src
+                        reallocate_heap(new_len + new_len / 2);
+                        info.src = info.des = alloc.bytes;
+                        return info;
+                    }
                     // need to allocate new space
-                    info.new_cap = new_len + new_len / 2;
-                    alloc.bytes = (u8*)alloc.allocate(LAYOUT, info.new_cap);
+                    allocate_at_least(new_len + new_len / 2, info);
                     info.des = alloc.bytes;
                     info.alloc_new_space = true;
                     info.need_deallocate = true;
@@ -408,8 +443,7 @@ namespace mstl::str {
                 info.src = &storage.local[0];
                 if (new_len > LOCAL_STORAGE_SIZE) {
                     // need to alloc heap space
-                    info.new_cap = new_len + new_len / 2;
-                    alloc.bytes = (u8*)alloc.allocate(LAYOUT, info.new_cap);
+                    allocate_at_least(new_len + new_len / 2, info);
                     info.des = alloc.bytes;
                     info.alloc_new_space = true;
                     // don't need to deallocate old space
@@ -424,6 +458,40 @@ namespace mstl::str {
             return info;
         }
 
+        /// allocate heap space for at least cap bytes
+        /// and record the real capacity in info.new_cap
+        constexpr void allocate_at_least(usize cap, AllocateInfo& info) {
+            auto block = memory::allocate_at_least(static_cast<Allocator&>(alloc), LAYOUT, cap);
+            if (block.ptr == nullptr) {
+                MSTL_PANIC("BasicString: allocation failed");
+            }
+            alloc.bytes = (u8*)block.ptr;
+            info.new_cap = block.length;
+        }
+
+        /// 把堆上的空间的容量调整为new_cap, 并保留原有的数据
+        /// should only be called when data is on heap and new_cap >= len
+        constexpr void reallocate_heap(usize new_cap) {
+            u8 *new_space = nullptr;
+            if constexpr (memory::concepts::Reallocator<Allocator>) {
+                new_space = new_cap > storage.cap ?
+                        (u8*)alloc.grow(alloc.bytes, LAYOUT, storage.cap, new_cap) :
+                        (u8*)alloc.shrink(alloc.bytes, LAYOUT, storage.cap, new_cap);
+            }
+            if (new_space == nullptr) {
+                auto block = memory::allocate_at_least(static_cast<Allocator&>(alloc), LAYOUT, new_cap);
+                if (block.ptr == nullptr) {
+                    MSTL_PANIC("BasicString: allocation failed");
+                }
+                new_space = (u8*)block.ptr;
+                new_cap = block.length;
+                copy(new_space, alloc.bytes, len);
+                alloc.deallocate(alloc.bytes, LAYOUT, storage.cap);
+            }
+            alloc.bytes = new_space;
+            storage.cap = new_cap;
+        }
+
         /// 所有对 Allocate 的 move copy 都只会对其继承的 Allocator 进行 move copy
         /// 不会对 bytes 进行 move copy
         struct Allocate: public Allocator {
@@ -441,12 +509,14 @@ namespace mstl::str {
                     return *this;
                 }
                 Allocator::operator=(other);
+                return *this;
             }
             constexpr Allocate& operator=(Allocate&& other) noexcept {
                 if (this == &other) {
                     return *this;
                 }
                 Allocator::operator=(std::forward<Allocate&&>(other));
+                return *this;
             }
 
             u8 *bytes = nullptr;
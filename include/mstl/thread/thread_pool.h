@@ -0,0 +1,390 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#ifndef __MODERN_STL_THREAD_POOL_H__
+#define __MODERN_STL_THREAD_POOL_H__
+
+#include <mutex>
+#include <deque>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <exception>
+#include <utility>
+#include <type_traits>
+#include <condition_variable>
+#include <mstl/global.h>
+#include <mstl/option/option.h>
+
+namespace mstl::thread {
+    /**
+     * @brief 可被工作线程执行的任务.
+     *
+     * 任务对象由提交者持有(通常位于提交者的栈上), 线程池不负责其生命周期. 提交者须在任务完成后才销毁任务对象.
+     */
+    class Job {
+    public:
+        Job(const Job&) = delete;
+        Job& operator=(const Job&) = delete;
+
+        void execute() noexcept {
+            run(this);
+        }
+
+    protected:
+        explicit Job(void (*run)(Job*) noexcept): run(run) {}
+        ~Job() = default;
+
+    private:
+        void (*run)(Job*) noexcept;
+    };
+
+    /// 工作线程等待任务完成时使用的标志: 等待者在等待期间执行其他任务, 而不是阻塞
+    class SpinLatch {
+    public:
+        bool probe() const noexcept {
+            return done.load(std::memory_order_acquire);
+        }
+
+        void set() noexcept {
+            // 设置后等待者可能立即销毁本对象, 因此这是对本对象的最后一次访问
+            done.store(true, std::memory_order_release);
+        }
+
+    private:
+        std::atomic<bool> done{false};
+    };
+
+    /// 线程池以外的线程等待任务完成时使用的标志: 等待者阻塞直到任务完成
+    class LockLatch {
+    public:
+        void set() noexcept {
+            std::lock_guard<std::mutex> guard(mutex);
+            done = true;
+            cv.notify_all();
+        }
+
+        void wait() noexcept {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait(lock, [this] { return done; });
+        }
+
+    private:
+        std::mutex mutex;
+        std::condition_variable cv;
+        bool done = false;
+    };
+
+    /// 在任务中抛出的异常被保存下来, 在等待者确认任务完成后以`rethrow`重新抛出
+    template<typename F, typename Latch>
+    class StackJob: public Job {
+    public:
+        explicit StackJob(F& func): Job(&StackJob::invoke), func(func) {}
+
+        Latch latch;
+
+        void rethrow() const {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+    private:
+        static void invoke(Job* job) noexcept {
+            auto* self = static_cast<StackJob*>(job);
+            try {
+                self->func();
+            } catch (...) {
+                self->error = std::current_exception();
+            }
+            self->latch.set();
+        }
+
+        F& func;
+        std::exception_ptr error;
+    };
+
+    /// 工作线程的任务队列. 所有者从尾部压入和弹出任务, 其他线程从头部窃取任务
+    class JobQueue {
+    public:
+        void push(Job* job) {
+            std::lock_guard<std::mutex> guard(mutex);
+            jobs.push_back(job);
+        }
+
+        Job* pop() noexcept {
+            std::lock_guard<std::mutex> guard(mutex);
+            if (jobs.empty()) {
+                return nullptr;
+            }
+            Job* job = jobs.back();
+            jobs.pop_back();
+            return job;
+        }
+
+        /// 仅当尾部的任务是job时弹出它, 否则说明job已被窃取
+        bool pop_if(Job* job) noexcept {
+            std::lock_guard<std::mutex> guard(mutex);
+            if (jobs.empty() || jobs.back() != job) {
+                return false;
+            }
+            jobs.pop_back();
+            return true;
+        }
+
+        Job* steal() noexcept {
+            std::lock_guard<std::mutex> guard(mutex);
+            if (jobs.empty()) {
+                return nullptr;
+            }
+            Job* job = jobs.front();
+            jobs.pop_front();
+            return job;
+        }
+
+    private:
+        std::mutex mutex;
+        std::deque<Job*> jobs;
+    };
+
+    /**
+     * @brief 工作窃取(work-stealing)线程池.
+     *
+     * 每个工作线程持有一个任务队列. `join(a, b)`将b压入当前线程的队列, 然后执行a;
+     * 若a完成时b仍未被其他线程窃取, 则当前线程直接执行b, 否则在等待b完成期间执行其他任务.
+     * 空闲的工作线程依次从自己的队列, 全局注入队列与其他线程的队列中获取任务, 仍找不到任务时进入休眠.
+     *
+     * 递归地以`join`划分任务时, 先被窃取的总是靠近根部的较大的任务, 因此线程间的同步次数与任务的规模无关.
+     *
+     * ## Example
+     * @code
+     *      ThreadPool pool(4);
+     *      u64 total = pool.install([&] {
+     *          u64 left = 0, right = 0;
+     *          join([&] { left = work(0, n / 2); }, [&] { right = work(n / 2, n); });
+     *          return left + right;
+     *      });
+     * @endcode
+     */
+    class ThreadPool {
+        struct Worker {
+            ThreadPool* pool = nullptr;
+            usize index = 0;
+            u64 seed = 0;
+            JobQueue queue;
+            std::thread thread;
+        };
+
+    public:
+        /// 创建含有threads个工作线程的线程池. threads为0时使用硬件线程数
+        explicit ThreadPool(usize threads = 0): count(threads == 0 ? default_threads() : threads) {
+            workers = std::make_unique<Worker[]>(count);
+            for (usize i = 0; i < count; i++) {
+                Worker& worker = workers[i];
+                worker.pool = this;
+                worker.index = i;
+                worker.seed = 0x9E3779B97F4A7C15ull * (i + 1);
+            }
+            for (usize i = 0; i < count; i++) {
+                workers[i].thread = std::thread([this, i] { worker_main(workers[i]); });
+            }
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        ~ThreadPool() {
+            {
+                std::lock_guard<std::mutex> guard(sleep_mutex);
+                stop.store(true);
+            }
+            sleep_cv.notify_all();
+            for (usize i = 0; i < count; i++) {
+                workers[i].thread.join();
+            }
+        }
+
+        usize num_threads() const noexcept {
+            return count;
+        }
+
+        /**
+         * 在线程池中执行func, 并返回其结果. 当前线程阻塞直到func完成.
+         * 若当前线程就是本线程池的工作线程, 则直接执行func. func抛出的异常在当前线程中重新抛出.
+         */
+        template<typename F>
+        std::invoke_result_t<F&> install(F&& func) {
+            using R = std::invoke_result_t<F&>;
+            if (Worker* worker = current_worker; worker != nullptr && worker->pool == this) {
+                return func();
+            }
+
+            if constexpr (std::is_void_v<R>) {
+                auto task = [&] { func(); };
+                StackJob<decltype(task), LockLatch> job(task);
+                inject(&job);
+                job.latch.wait();
+                job.rethrow();
+            } else {
+                auto result = Option<R>::none();
+                auto task = [&] { result = Option<R>::some(func()); };
+                StackJob<decltype(task), LockLatch> job(task);
+                inject(&job);
+                job.latch.wait();
+                job.rethrow();
+                return result.unwrap_unchecked();
+            }
+        }
+
+        /**
+         * 可能并行地执行a与b, 两者均完成后返回. 在本线程池以外的线程中调用时, 等同于`install`.
+         *
+         * 若a抛出异常, 则仍等待b完成(或在b未被窃取时丢弃b)后再传播该异常, 因为b位于当前线程的栈上.
+         * 若只有b抛出异常, 则在b完成后传播该异常.
+         */
+        template<typename A, typename B>
+        void join(A&& a, B&& b) {
+            Worker* worker = current_worker;
+            if (worker == nullptr || worker->pool != this) {
+                install([&] { join(a, b); });
+                return;
+            }
+
+            StackJob<std::remove_reference_t<B>, SpinLatch> job(b);
+            worker->queue.push(&job);
+            notify();
+
+            try {
+                a();
+            } catch (...) {
+                if (!worker->queue.pop_if(&job)) {
+                    wait_until(job.latch, *worker);
+                }
+                throw;
+            }
+
+            if (worker->queue.pop_if(&job)) {
+                // b未被窃取
+                b();
+                return;
+            }
+            wait_until(job.latch, *worker);
+            job.rethrow();
+        }
+
+        /// 全局线程池, 含有与硬件线程数相同的工作线程, 在首次使用时创建
+        static ThreadPool& global() {
+            static ThreadPool pool;
+            return pool;
+        }
+
+        /// 当前线程所属的线程池. 当前线程不是工作线程时, 返回全局线程池
+        static ThreadPool& current() {
+            Worker* worker = current_worker;
+            return worker != nullptr ? *worker->pool : global();
+        }
+
+        static usize default_threads() noexcept {
+            const usize n = std::thread::hardware_concurrency();
+            return n == 0 ? 1 : n;
+        }
+
+    private:
+        /// 等待被窃取的任务完成, 期间执行其他任务
+        void wait_until(const SpinLatch& latch, Worker& self) noexcept {
+            while (!latch.probe()) {
+                if (Job* other = find_work(self); other != nullptr) {
+                    other->execute();
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        void inject(Job* job) {
+            injector.push(job);
+            notify();
+        }
+
+        void notify() {
+            epoch.fetch_add(1);
+            if (sleepers.load() > 0) {
+                std::lock_guard<std::mutex> guard(sleep_mutex);
+                sleep_cv.notify_one();
+            }
+        }
+
+        Job* find_work(Worker& self) noexcept {
+            if (Job* job = self.queue.pop(); job != nullptr) {
+                return job;
+            }
+            if (Job* job = injector.steal(); job != nullptr) {
+                return job;
+            }
+
+            // xorshift选择起始的窃取对象, 避免所有线程同时窃取同一个队列
+            self.seed ^= self.seed << 13;
+            self.seed ^= self.seed >> 7;
+            self.seed ^= self.seed << 17;
+            const usize start = self.seed % count;
+            for (usize i = 0; i < count; i++) {
+                Worker& victim = workers[(start + i) % count];
+                if (&victim == &self) {
+                    continue;
+                }
+                if (Job* job = victim.queue.steal(); job != nullptr) {
+                    return job;
+                }
+            }
+            return nullptr;
+        }
+
+        void worker_main(Worker& self) {
+            current_worker = &self;
+            constexpr usize SPIN_ROUNDS = 64;
+            usize idle = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                const u64 seen = epoch.load();
+                if (Job* job = find_work(self); job != nullptr) {
+                    job->execute();
+                    idle = 0;
+                    continue;
+                }
+                if (++idle < SPIN_ROUNDS) {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                // 休眠前再次检查epoch: 若在查找任务后有新的任务被提交, 则epoch已改变
+                std::unique_lock<std::mutex> lock(sleep_mutex);
+                sleepers.fetch_add(1);
+                sleep_cv.wait(lock, [&] { return stop.load() || epoch.load() != seen; });
+                sleepers.fetch_sub(1);
+                idle = 0;
+            }
+            current_worker = nullptr;
+        }
+
+        inline static thread_local Worker* current_worker = nullptr;
+
+        usize count;
+        std::unique_ptr<Worker[]> workers;
+        JobQueue injector;
+
+        std::atomic<u64> epoch{0};
+        std::atomic<usize> sleepers{0};
+        std::atomic<bool> stop{false};
+        std::mutex sleep_mutex;
+        std::condition_variable sleep_cv;
+    };
+
+    /// 在当前线程所属的线程池中可能并行地执行a与b, 见`ThreadPool::join`
+    template<typename A, typename B>
+    MSTL_INLINE inline
+    void join(A&& a, B&& b) {
+        ThreadPool::current().join(std::forward<A>(a), std::forward<B>(b));
+    }
+}
+
+#endif //__MODERN_STL_THREAD_POOL_H__
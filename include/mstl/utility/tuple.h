@@ -51,11 +51,14 @@ namespace mstl::utility {
         requires (std::convertible_to<F, First> && (std::convertible_to<R, Rest> && ...))
                 : f(std::forward<F>(f)), r(std::forward<R>(r)...) {}
 
-        constexpr Tuple(const Tuple &other) noexcept requires basic::CopyAble<First>
+        // 持有左值引用的元组可以复制与移动构造, 副本引用相同的对象
+        constexpr Tuple(const Tuple &other) noexcept
+        requires (basic::CopyAble<First> || std::is_lvalue_reference_v<First>)
                 : f(other.f), r(other.r) {}
 
-        constexpr Tuple(Tuple &&other)  noexcept requires basic::Movable<First>
-                : f(std::move(other.f)), r(std::move(other.r)) {}
+        constexpr Tuple(Tuple &&other)  noexcept
+        requires (basic::Movable<First> || std::is_lvalue_reference_v<First>)
+                : f(std::forward<First>(other.f)), r(std::move(other.r)) {}
 
 
 
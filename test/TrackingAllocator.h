@@ -17,6 +17,7 @@ namespace mstl {
 
         static usize memory_allocated_cumulative;
         static usize memory_deallocated_cumulative;
+        static usize allocation_count;
         static std::map<void*, usize> memory_map;
 
     public:
@@ -30,11 +31,21 @@ namespace mstl {
 
         void* allocate(const memory::Layout& layout, usize length) noexcept { // NOLINT(readability-convert-member-functions-to-static)
             memory_allocated_cumulative += layout.size * length;
+            allocation_count++;
             void* ptr = alloc.allocate(layout, length);
             memory_map[ptr] = layout.size * length;
             return ptr;
         }
 
+        memory::Allocation allocate_at_least(const memory::Layout& layout, usize length) noexcept
+        requires memory::concepts::AllocateAtLeast<A> {
+            memory::Allocation block = alloc.allocate_at_least(layout, length);
+            memory_allocated_cumulative += layout.size * block.length;
+            allocation_count++;
+            memory_map[block.ptr] = layout.size * block.length;
+            return block;
+        }
+
         void deallocate(void* ptr, const memory::Layout& layout, usize length) noexcept{ // NOLINT(readability-convert-member-functions-to-static)
             if (ptr == nullptr) {
                 return;
@@ -65,6 +76,10 @@ namespace mstl {
             return memory_deallocated_cumulative;
         }
 
+        static usize get_allocation_count() {
+            return allocation_count;
+        }
+
         static usize get_beholding_memory() {
             return memory_allocated_cumulative - memory_deallocated_cumulative;
         }
@@ -92,6 +107,9 @@ namespace mstl {
     template<memory::concepts::Allocator A>
     usize TrackingAllocator<A>::memory_deallocated_cumulative = 0;
 
+    template<memory::concepts::Allocator A>
+    usize TrackingAllocator<A>::allocation_count = 0;
+
     template<memory::concepts::Allocator A>
     std::map<void*, usize> TrackingAllocator<A>::memory_map = {};
 } // mstl
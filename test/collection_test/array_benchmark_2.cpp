@@ -18,7 +18,7 @@ usize vec_1(Array<usize, 1000>& arr) {
     filter([](const auto& num) {
         return num % 2 == 0;
     }) |
-    fold(0ull, [](usize acc, usize size) {
+    fold(usize(0), [](usize acc, usize size) {
         return acc + size;
     });
     return sum;
@@ -36,6 +36,34 @@ usize vec_2(Array<usize, 1000>& arr) {
     return sum;
 }
 
+// map | filter | fold 与等价的下标循环
+usize vec_3(Array<usize, 1000>& arr) {
+    usize sum = arr.iter() |
+    map([](const usize& num) {
+        return num * 3;
+    }) |
+    filter([](const auto& num) {
+        return num % 2 == 0;
+    }) |
+    fold(usize(0), [](usize acc, usize size) {
+        return acc + size;
+    });
+    return sum;
+}
+
+usize vec_4(Array<usize, 1000>& arr) {
+    usize sum = 0;
+
+    for(usize i = 0; i < arr.size(); i++) {
+        usize num = arr[i] * 3;
+        if (num % 2 == 0) {
+            sum += num;
+        }
+    }
+
+    return sum;
+}
+
 void generate_test_data() {
     std::cout << "Start To Gen Test Data\n";
 
@@ -86,6 +114,28 @@ void BM_with_index(benchmark::State& state) {
 
 BENCHMARK(BM_with_index)->UseRealTime();
 
+void BM_map_with_iter(benchmark::State& state) {
+    volatile usize res = 0;
+    for (auto _: state) {
+        for (auto& arr: vec) {
+            res = vec_3(arr);
+        }
+    }
+}
+
+BENCHMARK(BM_map_with_iter)->UseRealTime();
+
+void BM_map_with_index(benchmark::State& state) {
+    volatile usize res = 0;
+    for (auto _: state) {
+        for (auto& arr: vec) {
+            res = vec_4(arr);
+        }
+    }
+}
+
+BENCHMARK(BM_map_with_index)->UseRealTime();
+
 int main(int argc, char** argv) {
     ::benchmark::Initialize(&argc, argv);
     if (::benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
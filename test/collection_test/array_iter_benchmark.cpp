@@ -0,0 +1,94 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#include <string>
+#include <benchmark/benchmark.h>
+#include <mstl/mstl.h>
+
+using namespace mstl;
+using namespace mstl::iter;
+using namespace mstl::collection;
+
+// 对Array<std::string, 1024>执行 into_iter() | map | collect.
+// BM_owning为对照组: 以原先的设计, 迭代器在构造时把所有元素移入自身持有的数组, 每次移动迭代器也移动所有元素;
+// BM_borrowing为当前的ArrayIter, 借用数组的存储, 在迭代时逐个移出元素.
+
+constexpr usize SIZE = 1024;
+using Strings = Array<std::string, SIZE>;
+
+/// 原先的ArrayIter: 持有N个元素
+template<typename T, usize N>
+class OwningArrayIter {
+public:
+    using Item = T;
+
+    explicit OwningArrayIter(T* arr_data) {
+        for (usize i = 0; i < N; i++) {
+            data[i] = std::move(arr_data[i]);
+        }
+    }
+
+    OwningArrayIter(const OwningArrayIter& other) = default;
+
+    OwningArrayIter(OwningArrayIter&& other) noexcept: pos(other.pos) {
+        for (usize i = 0; i < N; i++) {
+            data[i] = std::move(other.data[i]);
+        }
+    }
+
+    Option<T> next() {
+        if (pos == N) {
+            return Option<T>::none();
+        }
+        return Option<T>::some(std::move(data[pos++]));
+    }
+
+    usize len() {
+        return N - pos;
+    }
+
+    bool is_empty() {
+        return pos == N;
+    }
+
+private:
+    T data[N];
+    usize pos = 0;
+};
+
+void fill(Strings& arr) {
+    for (usize i = 0; i < SIZE; i++) {
+        arr[i] = std::string(32, char('a' + i % 26));
+    }
+}
+
+auto length = [](std::string s) { return s.size(); };
+
+void BM_owning(benchmark::State& state) {
+    Strings arr;
+    for (auto _ : state) {
+        state.PauseTiming();
+        fill(arr);
+        state.ResumeTiming();
+        auto lengths = OwningArrayIter<std::string, SIZE>(arr.begin()) | map(length) | collect<Vector<usize>>();
+        benchmark::DoNotOptimize(lengths.data());
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_owning);
+
+void BM_borrowing(benchmark::State& state) {
+    Strings arr;
+    for (auto _ : state) {
+        state.PauseTiming();
+        fill(arr);
+        state.ResumeTiming();
+        auto lengths = arr.into_iter() | map(length) | collect<Vector<usize>>();
+        benchmark::DoNotOptimize(lengths.data());
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_borrowing);
+
+BENCHMARK_MAIN();
@@ -10,6 +10,13 @@ using namespace mstl;
 using namespace mstl::iter;
 using namespace mstl::collection;
 
+// 迭代器借用数组的存储, 不能从临时数组创建
+template<typename A>
+concept RvalueIntoIter = requires(A a) { std::move(a).into_iter(); };
+
+static_assert(IntoIterator<Array<i32, 3>>);
+static_assert(!RvalueIntoIter<Array<i32, 3>>);
+
 template<typename T>
 struct Pow {
     T pow;
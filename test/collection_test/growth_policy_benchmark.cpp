@@ -0,0 +1,66 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+
+#include <mstl/mstl.h>
+
+using namespace mstl;
+using namespace mstl::collection;
+using namespace mstl::memory::allocator;
+
+// 以增长策略G把n个元素逐个加入Vector, 报告每轮的重新分配次数, 分配器持有的空间的峰值, 以及常驻内存(RSS)的增量.
+// InstrumentedAllocator以G为标签, 使各策略的统计数据相互独立.
+
+// 当前进程的常驻内存(字节). 不支持/proc时返回0.
+static usize resident_bytes() {
+    usize pages = 0, resident = 0;
+    FILE* f = std::fopen("/proc/self/statm", "r");
+    if (f == nullptr) {
+        return 0;
+    }
+    if (std::fscanf(f, "%zu %zu", &pages, &resident) != 2) {
+        resident = 0;
+    }
+    std::fclose(f);
+    return resident * 4096;
+}
+
+template<typename G>
+void BM_growth(benchmark::State& state) {
+    using A = InstrumentedAllocator<Allocator, G>;
+    const usize n = state.range(0);
+
+    auto before = A::snapshot();
+    usize rss = 0;
+    usize capacity = 0;
+    for (auto _ : state) {
+        usize base = resident_bytes();
+        Vector<u64, A, G> vec{A{}};
+        for (usize i = 0; i < n; i++) {
+            vec.push_back(i);
+        }
+        benchmark::DoNotOptimize(vec.data());
+        rss = resident_bytes() - base;
+        capacity = vec.capacity();
+    }
+    auto after = A::snapshot();
+
+    auto iterations = (double) state.iterations();
+    state.counters["reallocs"] = double(after.allocations - before.allocations) / iterations - 1;
+    state.counters["peak_bytes"] = (double) after.peak_live_bytes;
+    state.counters["rss_bytes"] = (double) rss;
+    state.counters["unused"] = double(capacity - n) / double(capacity);
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(BM_growth, growth::Doubling)->Arg(1'000'000)->Arg(20'000'000);
+BENCHMARK_TEMPLATE(BM_growth, growth::OneAndHalf)->Arg(1'000'000)->Arg(20'000'000);
+BENCHMARK_TEMPLATE(BM_growth, growth::PageRounded<>)->Arg(1'000'000)->Arg(20'000'000);
+BENCHMARK_TEMPLATE(BM_growth, growth::PageRounded<growth::OneAndHalf>)->Arg(1'000'000)->Arg(20'000'000);
+BENCHMARK_TEMPLATE(BM_growth, growth::HugeBuffer<>)->Arg(1'000'000)->Arg(20'000'000);
+BENCHMARK_TEMPLATE(BM_growth, growth::HugeBuffer<4 * 1024 * 1024, 4 * 1024 * 1024>)->Arg(1'000'000)->Arg(20'000'000);
+
+BENCHMARK_MAIN();
@@ -20,6 +20,8 @@ using namespace mstl::iter;
 using namespace mstl::collection;
 
 using Strings = std::vector<std::string>;
+using ArenaAlloc = memory::allocator::ArenaAllocator<>;
+using PoolAlloc = memory::allocator::PoolAllocator<>;
 
 Strings generate_test_data() {
     Strings vec;
@@ -368,4 +370,142 @@ BENCHMARK_TEMPLATE(BM_unique, List<std::string>);
 BENCHMARK_TEMPLATE(BM_unique, std::forward_list<std::string>);
 BENCHMARK_TEMPLATE(BM_unique, ForwardList<std::string>);
 
+
+// 以下benchmark在MonotonicArena中运行上述负载, 每轮结束后reset().
+template<typename L>
+void BM_assign_construct_arena(benchmark::State& state) {
+    memory::allocator::MonotonicArena<> arena;
+
+    for (auto _ : state) {
+        {
+            memory::allocator::ArenaScope scope{arena};
+            assign_constrct<L>();
+        }
+        arena.reset();
+    }
+}
+BENCHMARK_TEMPLATE(BM_assign_construct_arena, List<std::string>);
+BENCHMARK_TEMPLATE(BM_assign_construct_arena, List<std::string, ArenaAlloc>);
+
+BENCHMARK_TEMPLATE(BM_assign_construct_arena, ForwardList<std::string>);
+BENCHMARK_TEMPLATE(BM_assign_construct_arena, ForwardList<std::string, ArenaAlloc>);
+
+template<typename L>
+void BM_push_back_arena(benchmark::State& state) {
+    Strings vec = generate_test_data();
+    memory::allocator::MonotonicArena<> arena;
+
+    for (auto _ : state) {
+        {
+            memory::allocator::ArenaScope scope{arena};
+            push_back<L>(vec);
+        }
+        arena.reset();
+    }
+}
+BENCHMARK_TEMPLATE(BM_push_back_arena, List<std::string>);
+BENCHMARK_TEMPLATE(BM_push_back_arena, List<std::string, ArenaAlloc>);
+
+template<typename L>
+void BM_push_front_arena(benchmark::State& state) {
+    Strings vec = generate_test_data();
+    memory::allocator::MonotonicArena<> arena;
+
+    for (auto _ : state) {
+        {
+            memory::allocator::ArenaScope scope{arena};
+            push_front<L>(vec);
+        }
+        arena.reset();
+    }
+}
+BENCHMARK_TEMPLATE(BM_push_front_arena, ForwardList<std::string>);
+BENCHMARK_TEMPLATE(BM_push_front_arena, ForwardList<std::string, ArenaAlloc>);
+
+template<typename L>
+void BM_resize_arena(benchmark::State& state) {
+    memory::allocator::MonotonicArena<> arena;
+
+    for (auto _ : state) {
+        {
+            memory::allocator::ArenaScope scope{arena};
+            resize<L>();
+        }
+        arena.reset();
+    }
+}
+BENCHMARK_TEMPLATE(BM_resize_arena, List<std::string>);
+BENCHMARK_TEMPLATE(BM_resize_arena, List<std::string, ArenaAlloc>);
+
+BENCHMARK_TEMPLATE(BM_resize_arena, ForwardList<std::string>);
+BENCHMARK_TEMPLATE(BM_resize_arena, ForwardList<std::string, ArenaAlloc>);
+
+// 以下benchmark比较从NodePool中分配节点与使用默认分配器.
+template<typename L>
+L make_list(memory::allocator::NodePool<>& pool) {
+    using A = decltype(std::declval<const L&>().get_allocator());
+    if constexpr (std::is_same_v<A, PoolAlloc>) {
+        return L(PoolAlloc{pool});
+    } else {
+        return L();
+    }
+}
+
+template<typename L>
+void BM_churn_pool(benchmark::State& state) {
+    memory::allocator::NodePool<> pool;
+    L ls = make_list<L>(pool);
+    for (u64 i = 0; i < 1000; i++) {
+        ls.push_back(i);
+    }
+
+    for (auto _ : state) {
+        for (u64 i = 0; i < 1000000; i++) {
+            ls.push_back(i);
+            ls.pop_front();
+        }
+    }
+}
+BENCHMARK_TEMPLATE(BM_churn_pool, List<u64>);
+BENCHMARK_TEMPLATE(BM_churn_pool, List<u64, PoolAlloc>);
+
+template<typename L>
+void BM_sort_pool(benchmark::State& state) {
+    Strings vec = generate_test_data();
+    memory::allocator::NodePool<> pool;
+
+    for (auto _ : state) {
+        L ls = make_list<L>(pool);
+        for (auto& str: vec) {
+            ls.push_back(str);
+        }
+        ls.sort();
+    }
+}
+BENCHMARK_TEMPLATE(BM_sort_pool, List<std::string>);
+BENCHMARK_TEMPLATE(BM_sort_pool, List<std::string, PoolAlloc>);
+
+template<typename L>
+void BM_traverse_pool(benchmark::State& state) {
+    Strings vec = generate_test_data();
+    memory::allocator::NodePool<> pool;
+    L ls = make_list<L>(pool);
+    for (auto& str: vec) {
+        ls.push_front(str);  // 节点与字符串的堆空间交替分配
+    }
+
+    for (auto _ : state) {
+        usize total = 0;
+        for (auto& str: ls) {
+            total += str.size();
+        }
+        benchmark::DoNotOptimize(total);
+    }
+}
+BENCHMARK_TEMPLATE(BM_traverse_pool, ForwardList<std::string>);
+BENCHMARK_TEMPLATE(BM_traverse_pool, ForwardList<std::string, PoolAlloc>);
+
+BENCHMARK_TEMPLATE(BM_traverse_pool, List<std::string>);
+BENCHMARK_TEMPLATE(BM_traverse_pool, List<std::string, PoolAlloc>);
+
 BENCHMARK_MAIN();
\ No newline at end of file
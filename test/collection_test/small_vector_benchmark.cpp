@@ -0,0 +1,78 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#include <string>
+#include <benchmark/benchmark.h>
+#include <mstl/mstl.h>
+
+using namespace mstl;
+using namespace mstl::collection;
+
+// 模拟每个条目的属性列表: 为ITEMS个条目各构建一个含n个属性的列表, 遍历后丢弃.
+// n不超过内部缓冲区的容量时, SmallVector不访问堆.
+
+constexpr usize ITEMS = 1024;
+
+template<typename Vec>
+void BM_attribute_list(benchmark::State& state) {
+    const usize n = state.range(0);
+    for (auto _ : state) {
+        u64 sum = 0;
+        for (usize item = 0; item < ITEMS; item++) {
+            Vec attrs;
+            for (usize i = 0; i < n; i++) {
+                attrs.push_back(u32(item + i));
+            }
+            for (auto v: attrs) {
+                sum += v;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * ITEMS);
+}
+BENCHMARK_TEMPLATE(BM_attribute_list, Vector<u32>)->Arg(2)->Arg(4)->Arg(8)->Arg(16)->Arg(64);
+BENCHMARK_TEMPLATE(BM_attribute_list, SmallVector<u32, 8>)->Arg(2)->Arg(4)->Arg(8)->Arg(16)->Arg(64);
+
+template<typename Vec>
+void BM_attribute_list_str(benchmark::State& state) {
+    const usize n = state.range(0);
+    for (auto _ : state) {
+        usize total = 0;
+        for (usize item = 0; item < ITEMS; item++) {
+            Vec attrs;
+            for (usize i = 0; i < n; i++) {
+                attrs.emplace_back("attr");
+            }
+            for (const auto& s: attrs) {
+                total += s.size();
+            }
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * ITEMS);
+}
+BENCHMARK_TEMPLATE(BM_attribute_list_str, Vector<std::string>)->Arg(2)->Arg(4)->Arg(8)->Arg(16)->Arg(64);
+BENCHMARK_TEMPLATE(BM_attribute_list_str, SmallVector<std::string, 8>)->Arg(2)->Arg(4)->Arg(8)->Arg(16)->Arg(64);
+
+// 以collect构建列表
+template<typename Vec>
+void BM_collect(benchmark::State& state) {
+    const usize n = state.range(0);
+    Vector<u32> src;
+    for (usize i = 0; i < n; i++) {
+        src.push_back(u32(i));
+    }
+    for (auto _ : state) {
+        for (usize item = 0; item < ITEMS; item++) {
+            auto v = iter::collect<Vec>(src.iter());
+            benchmark::DoNotOptimize(v.data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * ITEMS);
+}
+BENCHMARK_TEMPLATE(BM_collect, Vector<u32>)->Arg(4)->Arg(8)->Arg(64);
+BENCHMARK_TEMPLATE(BM_collect, SmallVector<u32, 8>)->Arg(4)->Arg(8)->Arg(64);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,164 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#include <iostream>
+#include <string>
+#include <mstl/mstl.h>
+#include "../TrackingAllocator.h"
+
+#define BOOST_TEST_MODULE SmallVector Test
+
+#include <boost/test/unit_test.hpp>
+
+using namespace mstl;
+using namespace collection;
+using mstl::utility::to_string;
+
+using Tracking = TrackingAllocator<>;
+
+static_assert(iter::IntoIterator<SmallVector<int, 4, Tracking>>);
+static_assert(iter::FromIterator<SmallVector<std::string, 4>, VectorIter<std::string>>);
+
+BOOST_AUTO_TEST_CASE(INLINE_TEST) {
+    usize count = Tracking::get_allocation_count();
+    SmallVector<int, 4, Tracking> a{Tracking{}};
+    BOOST_REQUIRE(a.capacity() == 4);
+    for (int i = 0; i < 4; i++) {
+        a.push_back(i);
+    }
+    BOOST_CHECK(a.is_inline());
+    BOOST_CHECK(a.data() == &a[0]);
+    BOOST_CHECK(Tracking::get_allocation_count() == count);
+    BOOST_TEST_CHECK(to_string(a) == "SmallVec [0, 1, 2, 3]");
+
+    a.emplace_back(4);                  // 超过内部缓冲区的容量
+    BOOST_CHECK(!a.is_inline());
+    BOOST_CHECK(a.capacity() >= 8);
+    BOOST_CHECK(Tracking::get_allocation_count() == count + 1);
+    BOOST_TEST_CHECK(to_string(a) == "SmallVec [0, 1, 2, 3, 4]");
+
+    a.clear();
+    BOOST_CHECK(a.is_inline());
+    BOOST_CHECK(a.capacity() == 4);
+    BOOST_CHECK(Tracking::get_beholding_memory() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(SPILL_TEST_STR) {
+    SmallVector<std::string, 2> a = {"foo", "bar"};
+    BOOST_CHECK(a.is_inline());
+    a.push_back("Hello");
+    a.push_back("World");
+    BOOST_CHECK(!a.is_inline());
+    BOOST_TEST_CHECK(to_string(a) == "SmallVec [foo, bar, Hello, World]");
+
+    a.pop_back();
+    BOOST_CHECK(a.back().unwrap() == "Hello");
+    BOOST_CHECK(a.at(3).is_none());
+}
+
+BOOST_AUTO_TEST_CASE(COPY_MOVE_TEST) {
+    SmallVector<std::string, 4> a = {"foo", "bar"};
+    SmallVector<std::string, 4> b = {"foo", "bar", "Hello", "World", "!"};
+
+    auto c = a;
+    auto d = b;
+    BOOST_CHECK(c == a);
+    BOOST_CHECK(d == b);
+    BOOST_CHECK(c.is_inline());
+    BOOST_CHECK(!d.is_inline());
+
+    auto e = std::move(a);             // 内部缓冲区中的元素被逐个移动
+    BOOST_CHECK(e == c);
+    BOOST_CHECK(e.is_inline());
+    BOOST_CHECK(a.empty());
+
+    const std::string* p = b.data();
+    auto f = std::move(b);             // 堆上的空间被直接接管
+    BOOST_CHECK(f == d);
+    BOOST_CHECK(f.data() == p);
+    BOOST_CHECK(b.empty() && b.is_inline());
+
+    e = std::move(f);
+    BOOST_CHECK(e == d);
+    f = c;
+    BOOST_CHECK(f == c);
+}
+
+BOOST_AUTO_TEST_CASE(ITERATION_TEST) {
+    SmallVector<int, 4, Tracking> a = {0, 1, 2, 3};
+
+    auto b = iter::combine(
+            a.iter(),
+            iter::Map{}, [](int a) {
+                return a * 2;
+            },
+            iter::CollectAs<SmallVector<int, 4, Tracking>>{}
+    );
+    BOOST_TEST_CHECK(to_string(b) == "SmallVec [0, 2, 4, 6]");
+
+    int sum = 0;
+    for (const auto& i: a) {
+        sum += i;
+    }
+    BOOST_CHECK(sum == 6);
+
+    auto c = a.into_iter();
+    BOOST_REQUIRE(a.empty());
+    auto d = iter::collect<Vector<int>>(std::move(c));
+    BOOST_TEST_CHECK(to_string(d) == "Vec [0, 1, 2, 3]");
+}
+
+BOOST_AUTO_TEST_CASE(INTO_ITER_TEST_STR) {
+    SmallVector<std::string, 2> a = {"foo", "bar", "Hello"};
+    auto iter = a.into_iter();
+    BOOST_REQUIRE(iter.next().unwrap() == "foo");
+    BOOST_REQUIRE(iter.next().unwrap() == "bar");
+    BOOST_REQUIRE(iter.next().unwrap() == "Hello");
+    BOOST_REQUIRE(iter.next().is_none());
+}
+
+BOOST_AUTO_TEST_CASE(INSERT_ERASE_TEST) {
+    SmallVector<int, 4> a = {1, 2, 3};
+    a.insert(a.begin(), 0);
+    BOOST_CHECK(a.is_inline());
+    a.insert(a.begin() + 2, 10);
+    BOOST_TEST_CHECK(to_string(a) == "SmallVec [0, 1, 10, 2, 3]");
+
+    a.erase(a.begin() + 2);
+    a.erase(a.begin());
+    BOOST_TEST_CHECK(to_string(a) == "SmallVec [1, 2, 3]");
+
+    SmallVector<std::string, 2> b = {"bar"};
+    b.insert(b.begin(), "foo");
+    b.insert(b.end(), "baz");
+    BOOST_TEST_CHECK(to_string(b) == "SmallVec [foo, bar, baz]");
+    b.erase(b.begin() + 1);
+    BOOST_TEST_CHECK(to_string(b) == "SmallVec [foo, baz]");
+}
+
+BOOST_AUTO_TEST_CASE(INSERT_ALIAS_TEST) {
+    // 插入的值引用容器自身的元素: 应在移动元素之前复制
+    SmallVector<std::string, 8> a = {"a", "b", "c"};
+    a.insert(a.begin(), a[2]);
+    BOOST_TEST_CHECK(to_string(a) == "SmallVec [c, a, b, c]");
+
+    // 插入时扩容
+    SmallVector<std::string, 2> b = {"a", "b"};
+    b.insert(b.begin(), b[1]);
+    BOOST_TEST_CHECK(to_string(b) == "SmallVec [b, a, b]");
+}
+
+BOOST_AUTO_TEST_CASE(RESIZE_TEST) {
+    SmallVector<int, 4> a = {0, 1};
+    a.resize(6, 7);
+    BOOST_TEST_CHECK(to_string(a) == "SmallVec [0, 1, 7, 7, 7, 7]");
+    a.resize(1);
+    BOOST_TEST_CHECK(to_string(a) == "SmallVec [0]");
+    a.resize(3);
+    BOOST_TEST_CHECK(to_string(a) == "SmallVec [0, 0, 0]");
+}
+
+BOOST_AUTO_TEST_CASE(MEMORY_TRACK) {
+    BOOST_REQUIRE(Tracking::get_beholding_memory() == 0);
+}
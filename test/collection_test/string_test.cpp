@@ -3,6 +3,7 @@
 //
 #include <mstl/mstl.h>
 #include <iostream>
+#include <sstream>
 
 #define BOOST_TEST_MODULE String Test
 #include <boost/test/unit_test.hpp>
@@ -75,3 +76,53 @@ BOOST_AUTO_TEST_CASE(ASCII_STR_TEST) {
     });
     std::cout << s << std::endl;
 }
+
+BOOST_AUTO_TEST_CASE(RESERVE_TEST) {
+    AsciiString str = "0123456789abcdefg"_ascii;
+    str.reserve(1000);
+    for (mstl::usize i = 0; i < 1000; i++) {
+        str.push_back("x"_ascii);
+    }
+    BOOST_CHECK(str.size() == 1017);
+    str.shrink_to_fit();
+    BOOST_CHECK(str.size() == 1017);
+
+    std::stringstream ss;
+    ss << str;
+    BOOST_CHECK(ss.str() == "0123456789abcdefg" + std::string(1000, 'x'));
+}
+
+BOOST_AUTO_TEST_CASE(RESERVE_LOCAL_TEST) {
+    // 储存在本地的字符串预留空间后移至堆上, 之后的插入不再分配
+    AsciiString str = "abc"_ascii;
+    str.reserve(100);
+    mstl::usize cap = str.capacity();
+    BOOST_CHECK(cap >= 100);
+    for (mstl::usize i = 0; i < 97; i++) {
+        str.push_back("x"_ascii);
+    }
+    BOOST_CHECK(str.capacity() == cap);
+
+    // 不收缩
+    str.reserve(10);
+    BOOST_CHECK(str.capacity() == cap);
+
+    std::stringstream ss;
+    ss << str;
+    BOOST_CHECK(ss.str() == "abc" + std::string(97, 'x'));
+
+    // 堆上的短字符串在复制, 移动与收缩时保持内容
+    AsciiString small = "ab"_ascii;
+    small.reserve(64);
+    AsciiString copied = small;
+    AsciiString assigned = "0123456789abcdefghij"_ascii;
+    assigned = small;
+    AsciiString moved = std::move(small);
+    moved.shrink_to_fit();
+    BOOST_CHECK(moved.capacity() == 16);
+    for (auto* s : {&copied, &assigned, &moved}) {
+        std::stringstream out;
+        out << *s;
+        BOOST_CHECK(out.str() == "ab");
+    }
+}
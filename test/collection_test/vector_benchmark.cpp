@@ -9,6 +9,10 @@
 #include <initializer_list>
 
 #include <benchmark/benchmark.h>
+#if __has_include(<unistd.h>) && __has_include(<fcntl.h>)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 #include <mstl/mstl.h>
 
 extern std::initializer_list<std::string> list;
@@ -18,6 +22,7 @@ using namespace mstl::iter;
 using namespace mstl::collection;
 
 using Strings = std::vector<std::string>;
+using ArenaAlloc = memory::allocator::ArenaAllocator<>;
 
 Strings generate_test_data() {
     Strings vec;
@@ -183,4 +188,273 @@ void BM_erase(benchmark::State& state) {
 BENCHMARK_TEMPLATE(BM_erase, std::vector<std::string>);
 BENCHMARK_TEMPLATE(BM_erase, Vector<std::string>);
 
+// 以下benchmark在MonotonicArena中运行上述负载, 每轮结束后reset().
+template<typename Vec>
+void BM_push_back_arena(benchmark::State& state) {
+    Strings vec = generate_test_data();
+    memory::allocator::MonotonicArena<> arena;
+
+    for (auto _ : state) {
+        {
+            memory::allocator::ArenaScope scope{arena};
+            push_back<Vec>(vec);
+        }
+        arena.reset();
+    }
+}
+BENCHMARK_TEMPLATE(BM_push_back_arena, Vector<std::string>);
+BENCHMARK_TEMPLATE(BM_push_back_arena, Vector<std::string, ArenaAlloc>);
+
+template<typename Vec>
+void BM_range_based_arena(benchmark::State& state) {
+    auto vec = generate_test_data();
+    memory::allocator::MonotonicArena<> arena;
+
+    for (auto _ : state) {
+        {
+            memory::allocator::ArenaScope scope{arena};
+            range_based<Vec>(vec);
+        }
+        arena.reset();
+    }
+}
+BENCHMARK_TEMPLATE(BM_range_based_arena, Vector<std::string>);
+BENCHMARK_TEMPLATE(BM_range_based_arena, Vector<std::string, ArenaAlloc>);
+
+template<typename Vec>
+void BM_insert_arena(benchmark::State& state) {
+    Strings vec = generate_test_data();
+    memory::allocator::MonotonicArena<> arena;
+
+    for (auto _ : state) {
+        {
+            memory::allocator::ArenaScope scope{arena};
+            insert<Vec>(vec);
+        }
+        arena.reset();
+    }
+}
+BENCHMARK_TEMPLATE(BM_insert_arena, Vector<std::string>);
+BENCHMARK_TEMPLATE(BM_insert_arena, Vector<std::string, ArenaAlloc>);
+
+template<typename Vec>
+void BM_resize_arena(benchmark::State& state) {
+    memory::allocator::MonotonicArena<> arena;
+
+    for (auto _ : state) {
+        {
+            memory::allocator::ArenaScope scope{arena};
+            resize<Vec>();
+        }
+        arena.reset();
+    }
+}
+BENCHMARK_TEMPLATE(BM_resize_arena, Vector<std::string>);
+BENCHMARK_TEMPLATE(BM_resize_arena, Vector<std::string, ArenaAlloc>);
+
+// 以下benchmark比较增长可按字节复制的元素的大缓冲区. Vector通过分配器的grow扩展空间.
+template<typename Vec>
+void BM_grow_trivial(benchmark::State& state) {
+    const usize n = state.range(0);
+    for (auto _ : state) {
+        Vec vec;
+        for (usize i = 0; i < n; i++) {
+            vec.push_back(i);
+        }
+        benchmark::DoNotOptimize(vec.data());
+    }
+    state.SetBytesProcessed(state.iterations() * n * sizeof(u64));
+}
+BENCHMARK_TEMPLATE(BM_grow_trivial, std::vector<u64>)->Arg(1 << 16)->Arg(1 << 24);
+BENCHMARK_TEMPLATE(BM_grow_trivial, Vector<u64>)->Arg(1 << 16)->Arg(1 << 24);
+
+// 以下benchmark比较以memcpy/memmove重定位元素与逐个移动构造元素.
+// std::vector<char>可平凡重定位; libstdc++中的std::string持有指向自身的指针, 只能逐个移动.
+using Bytes = std::vector<char>;
+
+template<typename S>
+S make_payload(usize i) {
+    S s(20, 'a');
+    s[i % 20] = 'b';
+    return s;
+}
+
+template<typename Vec>
+void BM_grow_relocate(benchmark::State& state) {
+    using S = std::remove_cvref_t<decltype(*std::declval<Vec&>().data())>;
+    const usize n = state.range(0);
+    S payload = make_payload<S>(0);
+    for (auto _ : state) {
+        Vec vec;
+        for (usize i = 0; i < n; i++) {
+            vec.push_back(payload);
+        }
+        benchmark::DoNotOptimize(vec.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(BM_grow_relocate, std::vector<std::string>)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_grow_relocate, Vector<std::string>)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_grow_relocate, std::vector<Bytes>)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_grow_relocate, Vector<Bytes>)->Arg(1 << 16)->Arg(1 << 20);
+
+template<typename Vec>
+void BM_insert_erase_front_relocate(benchmark::State& state) {
+    using S = std::remove_cvref_t<decltype(*std::declval<Vec&>().data())>;
+    const usize n = state.range(0);
+    Vec vec;
+    for (usize i = 0; i < n; i++) {
+        vec.push_back(make_payload<S>(i));
+    }
+    S payload = make_payload<S>(0);
+    for (auto _ : state) {
+        vec.insert(vec.begin(), payload);
+        vec.erase(vec.begin());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(BM_insert_erase_front_relocate, std::vector<std::string>)->Arg(1 << 12)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_insert_erase_front_relocate, Vector<std::string>)->Arg(1 << 12)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_insert_erase_front_relocate, std::vector<Bytes>)->Arg(1 << 12)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_insert_erase_front_relocate, Vector<Bytes>)->Arg(1 << 12)->Arg(1 << 16);
+
+// 以下benchmark比较批量追加元素的方式: 逐个push_back, 范围insert与extend_from_slice.
+template<typename T>
+void BM_append_push_back(benchmark::State& state) {
+    const usize n = state.range(0);
+    Vector<T> src(n, T{});
+    for (auto _ : state) {
+        Vector<T> vec;
+        for (usize i = 0; i < n; i++) {
+            vec.push_back(src[i]);
+        }
+        benchmark::DoNotOptimize(vec.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(BM_append_push_back, u32)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_append_push_back, std::string)->Arg(1 << 10)->Arg(1 << 16);
+
+template<typename T>
+void BM_append_insert(benchmark::State& state) {
+    const usize n = state.range(0);
+    Vector<T> src(n, T{});
+    for (auto _ : state) {
+        Vector<T> vec;
+        vec.insert(vec.end(), src.begin(), src.end());
+        benchmark::DoNotOptimize(vec.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(BM_append_insert, u32)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_append_insert, std::string)->Arg(1 << 10)->Arg(1 << 16);
+
+template<typename T>
+void BM_append_extend_from_slice(benchmark::State& state) {
+    const usize n = state.range(0);
+    Vector<T> src(n, T{});
+    for (auto _ : state) {
+        Vector<T> vec;
+        vec.extend_from_slice(src.as_slice());
+        benchmark::DoNotOptimize(vec.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(BM_append_extend_from_slice, u32)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_append_extend_from_slice, std::string)->Arg(1 << 10)->Arg(1 << 16);
+
+// 把多个批次追加到同一个Vector: 逐个移动元素与append
+template<typename T>
+void BM_append_batches(benchmark::State& state) {
+    const usize n = state.range(0);
+    const bool use_append = state.range(1);
+    for (auto _ : state) {
+        state.PauseTiming();
+        Vector<Vector<T>> batches;
+        for (usize b = 0; b < 16; b++) {
+            batches.push_back(Vector<T>(n, T{}));
+        }
+        state.ResumeTiming();
+        Vector<T> vec;
+        for (usize b = 0; b < 16; b++) {
+            if (use_append) {
+                vec.append(std::move(batches[b]));
+            } else {
+                for (auto& v: batches[b]) {
+                    vec.push_back(std::move(v));
+                }
+            }
+        }
+        benchmark::DoNotOptimize(vec.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n * 16);
+}
+BENCHMARK_TEMPLATE(BM_append_batches, std::string)->Args({1 << 12, 0})->Args({1 << 12, 1});
+
+// map | collect: 按size_hint一次性预留空间
+void BM_collect_map(benchmark::State& state) {
+    const usize n = state.range(0);
+    Vector<u64> src;
+    for (usize i = 0; i < n; i++) {
+        src.push_back(i);
+    }
+    for (auto _ : state) {
+        auto vec = iter::combine(src.iter(),
+            Map{}, [](u64& x) { return x * 3; },
+            CollectAs<Vector<u64>>{}
+        );
+        benchmark::DoNotOptimize(vec.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_collect_map)->Arg(1 << 10)->Arg(1 << 20);
+
+#if __has_include(<unistd.h>) && __has_include(<fcntl.h>)
+// 以下benchmark以read()把256MB的数据读入Vector<u8>: 初始化新元素的resize, 不初始化新元素的resize_uninit,
+// 以及直接写入spare_capacity. 数据源为/dev/zero, 以排除磁盘的影响.
+enum class FillMode { RESIZE, RESIZE_UNINIT, SPARE_CAPACITY };
+
+static void read_all(int fd, u8* buf, usize n) {
+    while (n > 0) {
+        auto r = ::read(fd, buf, n);
+        if (r <= 0) {
+            break;
+        }
+        buf += r;
+        n -= r;
+    }
+}
+
+template<FillMode M>
+void BM_read_fill(benchmark::State& state) {
+    const usize n = 256 * 1024 * 1024;
+    int fd = ::open("/dev/zero", O_RDONLY);
+    if (fd < 0) {
+        state.SkipWithError("cannot open /dev/zero");
+        return;
+    }
+    for (auto _ : state) {
+        Vector<u8> buf;
+        if constexpr (M == FillMode::RESIZE) {
+            buf.resize(n);
+            read_all(fd, buf.data(), n);
+        } else if constexpr (M == FillMode::RESIZE_UNINIT) {
+            buf.resize_uninit(n);
+            read_all(fd, buf.data(), n);
+        } else {
+            buf.reserve(n);
+            auto spare = buf.spare_capacity();
+            read_all(fd, spare.as_ptr(), n);
+            buf.set_len(n);
+        }
+        benchmark::DoNotOptimize(buf.data());
+    }
+    ::close(fd);
+    state.SetBytesProcessed(state.iterations() * n);
+}
+BENCHMARK_TEMPLATE(BM_read_fill, FillMode::RESIZE)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_read_fill, FillMode::RESIZE_UNINIT)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_read_fill, FillMode::SPARE_CAPACITY)->Unit(benchmark::kMillisecond);
+#endif
+
 BENCHMARK_MAIN();
\ No newline at end of file
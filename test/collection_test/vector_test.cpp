@@ -216,9 +216,104 @@ BOOST_AUTO_TEST_CASE(FROM_ITER_TEST_STR) {
 
 BOOST_AUTO_TEST_CASE(RESERVE_TEST) {
     auto a = INTVEC;
-    BOOST_CHECK(a.capacity() == 4);
+    BOOST_CHECK(a.capacity() >= 4);
     a.reserve(8);
-    BOOST_CHECK(a.capacity() == 8);
+    BOOST_CHECK(a.capacity() >= 8);
+}
+
+BOOST_AUTO_TEST_CASE(RESERVE_REALLOC_TEST) {
+    // 元素可按字节复制时, 由分配器的grow扩展空间
+    static_assert(memory::concepts::Reallocator<memory::allocator::Allocator>);
+    Vector<int> a;
+    for (int i = 0; i < 100000; i++) {
+        a.push_back(i);
+    }
+    a.reserve(1 << 20);
+    BOOST_CHECK(a.capacity() >= 1 << 20);
+    BOOST_CHECK(a.size() == 100000);
+    BOOST_CHECK(a[0] == 0);
+    BOOST_CHECK(a[99999] == 99999);
+}
+
+// 不提供allocate_at_least的分配器, 用于比较重新分配的次数
+class ExactAllocator {
+    memory::allocator::Allocator alloc;
+public:
+    void* allocate(const memory::Layout& layout, usize length) noexcept {
+        return alloc.allocate(layout, length);
+    }
+
+    void deallocate(void* ptr, const memory::Layout& layout, usize length) noexcept {
+        alloc.deallocate(ptr, layout, length);
+    }
+
+    template<class T>
+    T* allocate(usize len) {
+        return alloc.template allocate<T>(len);
+    }
+
+    template<class T>
+    void deallocate(T* ptr, usize len) {
+        alloc.template deallocate(ptr, len);
+    }
+
+    bool operator==(const ExactAllocator&) const {
+        return true;
+    }
+};
+
+BOOST_AUTO_TEST_CASE(ALLOCATE_AT_LEAST_TEST) {
+    using AtLeast = TrackingAllocator<>;
+    using Exact = TrackingAllocator<ExactAllocator>;
+    static_assert(memory::concepts::AllocateAtLeast<AtLeast>);
+    static_assert(!memory::concepts::AllocateAtLeast<Exact>);
+
+    usize at_least_count = AtLeast::get_allocation_count();
+    usize exact_count = Exact::get_allocation_count();
+    {
+        Vector<u8, AtLeast> a;
+        Vector<u8, Exact> b;
+        for (usize i = 0; i < 100000; i++) {
+            a.push_back(i);
+            b.push_back(i);
+        }
+        BOOST_CHECK(a == b);
+    }
+    at_least_count = AtLeast::get_allocation_count() - at_least_count;
+    exact_count = Exact::get_allocation_count() - exact_count;
+
+    std::cout << "Reallocations with allocate_at_least: " << at_least_count
+              << ", without: " << exact_count << std::endl;
+    BOOST_CHECK(at_least_count <= exact_count);
+    BOOST_CHECK(Exact::get_beholding_memory() == 0);
+
+    // 报告的容量是取整后请求的大小, 而不是malloc_usable_size: 超出请求的部分不可使用
+    memory::allocator::Allocator alloc;
+    auto block = alloc.allocate_at_least(memory::Layout::from_type<u8>(), 17);
+    BOOST_REQUIRE(block.ptr != nullptr);
+    BOOST_CHECK(block.length == 32);
+    std::memset(block.ptr, 0, block.length);
+    auto grown = alloc.grow_at_least(block.ptr, memory::Layout::from_type<u32>(), 8, 33);
+    BOOST_REQUIRE(grown.ptr != nullptr);
+    BOOST_CHECK(grown.length == 36);
+    alloc.deallocate(grown.ptr, memory::Layout::from_type<u32>(), grown.length);
+}
+
+BOOST_AUTO_TEST_CASE(FROM_RAW_PARTS_TEST) {
+    {
+        TrackingAllocator<> alloc;
+        auto* ptr = (int*)alloc.allocate(memory::Layout::from_type<int>(), 8);
+        for (int i = 0; i < 3; i++) {
+            ptr[i] = i;
+        }
+        auto vec = Vector<int, TrackingAllocator<>>::from_raw_parts(ptr, 3, 8, alloc);
+        BOOST_CHECK(vec.size() == 3);
+        BOOST_CHECK(vec.capacity() == 8);
+        BOOST_CHECK(vec[2] == 2);
+        vec.push_back(3);
+        BOOST_CHECK(&vec[0] == ptr);
+    }
+    BOOST_CHECK(TrackingAllocator<>::get_beholding_memory() == 0);
 }
 
 BOOST_AUTO_TEST_CASE(SWAP_TEST) {
@@ -401,6 +496,320 @@ BOOST_AUTO_TEST_CASE(INSERT_TEST) {
     BOOST_TEST_CHECK(*re == "10");
 }
 
+// 移动时计数的类型. Relocatable声明自身可平凡重定位, 其移动构造函数不应被Vector调用
+template<bool R>
+struct MoveCounter {
+    static inline usize moves = 0;
+
+    std::unique_ptr<int> val;
+
+    explicit MoveCounter(int v): val(std::make_unique<int>(v)) {}
+    MoveCounter(MoveCounter&& o) noexcept: val(std::move(o.val)) { moves++; }
+    MoveCounter& operator=(MoveCounter&& o) noexcept { val = std::move(o.val); moves++; return *this; }
+};
+
+using Relocatable = MoveCounter<true>;
+using NonRelocatable = MoveCounter<false>;
+
+template<>
+struct mstl::memory::IsTriviallyRelocatable<Relocatable>: std::true_type {};
+
+static_assert(memory::concepts::TriviallyRelocatable<int>);
+static_assert(memory::concepts::TriviallyRelocatable<std::unique_ptr<int>>);
+static_assert(memory::concepts::TriviallyRelocatable<Vector<std::string>>);
+static_assert(memory::concepts::TriviallyRelocatable<Relocatable>);
+static_assert(!memory::concepts::TriviallyRelocatable<NonRelocatable>);
+
+template<typename T>
+void check_relocation(usize expected_moves) {
+    T::moves = 0;
+    {
+        Vector<T, TrackingAllocator<>> vec{TrackingAllocator<>{}};
+        for (int i = 0; i < 100; i++) {
+            vec.emplace_back(i);
+        }
+        vec.insert(vec.begin(), T{-1});             // [-1, 0, 1, ..., 99]
+        vec.emplace(vec.begin() + 50, 1000);        // [-1, 0, ..., 48, 1000, 49, ..., 99]
+        vec.erase(vec.begin() + 1);                 // [-1, 1, ..., 48, 1000, 49, ..., 99]
+        vec.erase(vec.begin() + 90, vec.end());     // [-1, 1, ..., 48, 1000, 49, ..., 88]
+
+        BOOST_REQUIRE(vec.size() == 90);
+        BOOST_CHECK(*vec[0].val == -1);
+        BOOST_CHECK(*vec[1].val == 1);
+        BOOST_CHECK(*vec[48].val == 48);
+        BOOST_CHECK(*vec[49].val == 1000);
+        BOOST_CHECK(*vec[50].val == 49);
+        BOOST_CHECK(*vec[89].val == 88);
+    }
+    BOOST_CHECK(TrackingAllocator<>::get_beholding_memory() == 0);
+    if (expected_moves != 0) {
+        BOOST_CHECK(T::moves <= expected_moves);
+    } else {
+        BOOST_CHECK(T::moves > 0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(RELOCATE_TEST) {
+    check_relocation<Relocatable>(2);     // 仅移动传入insert/emplace的参数
+    check_relocation<NonRelocatable>(0);
+}
+
+BOOST_AUTO_TEST_CASE(INSERT_FRONT_TEST) {
+    Vector<std::string> a;
+    a.insert(a.begin(), "b");
+    a.insert(a.begin(), "a");
+    a.insert(a.end(), "c");
+    BOOST_TEST_CHECK(to_string(a) == "Vec [a, b, c]");
+
+    Vector<int> b;
+    b.insert(b.begin(), 3, 1);
+    b.insert(b.begin(), {0, 0});
+    BOOST_TEST_CHECK(to_string(b) == "Vec [0, 0, 1, 1, 1]");
+}
+
+BOOST_AUTO_TEST_CASE(EXTEND_TEST) {
+    Vector<int, TrackingAllocator<>> a = {0, 1};
+    int raw[] = {2, 3, 4};
+    a.extend_from_slice(Slice<const int>::from_raw(raw, 3));
+    BOOST_TEST_CHECK(to_string(a) == "Vec [0, 1, 2, 3, 4]");
+
+    a.extend_from_slice(a.as_slice());      // 引用自身的元素
+    BOOST_TEST_CHECK(to_string(a) == "Vec [0, 1, 2, 3, 4, 0, 1, 2, 3, 4]");
+
+    Vector<int, TrackingAllocator<>> b;
+    b.extend(a.iter());                     // ExactSizeIterator以外的迭代器逐个插入
+    BOOST_CHECK(b == a);
+
+    Vector<std::string> c = {"foo"};
+    Vector<std::string> d = {"bar", "baz"};
+    c.extend_from_slice(d.as_slice());
+    BOOST_TEST_CHECK(to_string(c) == "Vec [foo, bar, baz]");
+    c.extend(d);                            // 左值不被消耗, 其元素被复制到c
+    BOOST_TEST_CHECK(to_string(c) == "Vec [foo, bar, baz, bar, baz]");
+    BOOST_TEST_CHECK(to_string(d) == "Vec [bar, baz]");
+    c.extend(std::move(d));                 // 右值被转换为迭代器, 其元素被移入c
+    BOOST_TEST_CHECK(to_string(c) == "Vec [foo, bar, baz, bar, baz, bar, baz]");
+    BOOST_CHECK(d.empty());
+
+    Vector<std::string, TrackingAllocator<>> other = {"qux"};
+    c.extend(other);                        // 分配器不同的Vector
+    SmallVector<std::string, 2> small = {"quux"};
+    c.extend(small);
+    Array<std::string, 1> arr = {"corge"};
+    c.extend(arr);
+    BOOST_TEST_CHECK(to_string(c) == "Vec [foo, bar, baz, bar, baz, bar, baz, qux, quux, corge]");
+    BOOST_CHECK(other.size() == 1 && other[0] == "qux");
+    BOOST_CHECK(small.size() == 1 && small[0] == "quux");
+    BOOST_CHECK(arr[0] == "corge");
+
+    Vector<std::string> self = {"a", "b"};
+    self.extend(self);                      // 引用自身的元素
+    BOOST_TEST_CHECK(to_string(self) == "Vec [a, b, a, b]");
+
+    Vector<int> e;
+    e.extend(Slice<const int>::from_raw(raw, 3).iter());
+    BOOST_TEST_CHECK(to_string(e) == "Vec [2, 3, 4]");
+    BOOST_CHECK(e.capacity() >= 3);
+}
+
+// 复制第throw_at次时抛出异常, 并记录存活的对象数量
+struct ThrowOnCopy {
+    static inline isize live = 0;
+    static inline isize copies = 0;
+    static inline isize throw_at = -1;
+
+    explicit ThrowOnCopy(int v): val(v) { live++; }
+    ThrowOnCopy(const ThrowOnCopy& o): val(o.val) {
+        if (copies++ == throw_at) {
+            throw std::runtime_error("copy");
+        }
+        live++;
+    }
+    ~ThrowOnCopy() { live--; }
+
+    int val;
+};
+
+BOOST_AUTO_TEST_CASE(EXTEND_EXCEPTION_TEST) {
+    {
+        Vector<ThrowOnCopy> src;
+        for (int i = 0; i < 8; i++) {
+            src.emplace_back(i);
+        }
+        Vector<ThrowOnCopy, TrackingAllocator<>> dst{TrackingAllocator<>{}};
+        dst.reserve(32);                    // ThrowOnCopy不可移动, 避免重新分配时复制
+        dst.emplace_back(-1);
+
+        // ExactSizeIterator: 已插入的元素计入长度, 由dst析构
+        ThrowOnCopy::copies = 0;
+        ThrowOnCopy::throw_at = 3;
+        BOOST_CHECK_THROW(dst.extend(src.citer()), std::runtime_error);
+        BOOST_CHECK(dst.size() == 4);
+        BOOST_CHECK(dst[3].val == 2);
+
+        ThrowOnCopy::copies = 0;
+        ThrowOnCopy::throw_at = 5;
+        BOOST_CHECK_THROW(dst.extend_from_slice(src.as_slice()), std::runtime_error);
+        BOOST_CHECK(dst.size() == 9);
+        BOOST_CHECK(dst[8].val == 4);
+        ThrowOnCopy::throw_at = -1;
+    }
+    BOOST_CHECK(ThrowOnCopy::live == 0);
+}
+
+BOOST_AUTO_TEST_CASE(APPEND_TEST) {
+    Vector<std::string> a;
+    Vector<std::string> b = STRVEC;
+    const std::string* p = b.data();
+    a.append(std::move(b));                 // a为空, 直接接管b的空间
+    BOOST_CHECK(a.data() == p);
+    BOOST_CHECK(b.empty());
+
+    Vector<std::string> c = {"!"};
+    a.append(std::move(c));
+    BOOST_TEST_CHECK(to_string(a) == "Vec [foo, bar, Hello, World, !]");
+    BOOST_CHECK(c.empty());
+
+    auto d = INTVEC;
+    d.extend(INTVEC);
+    BOOST_TEST_CHECK(to_string(d) == "Vec [0, 1, 2, 3, 0, 1, 2, 3]");
+
+    Vector<NonRelocatable, TrackingAllocator<>> e, f;
+    e.emplace_back(1);
+    f.emplace_back(2);
+    f.emplace_back(3);
+    e.append(std::move(f));
+    BOOST_REQUIRE(e.size() == 3);
+    BOOST_CHECK(*e[2].val == 3);
+    BOOST_CHECK(f.empty());
+}
+
+BOOST_AUTO_TEST_CASE(RESIZE_UNINIT_TEST) {
+    Vector<u8, TrackingAllocator<>> a;
+    a.resize_uninit(16);
+    BOOST_REQUIRE(a.size() == 16);
+    for (usize i = 0; i < 16; i++) {
+        a[i] = u8(i);
+    }
+    a.resize_uninit(4);
+    BOOST_TEST_CHECK(a.size() == 4);
+    BOOST_TEST_CHECK(a[3] == 3);
+
+    Vector<std::string> b = {"foo"};
+    b.resize_default_init(3);                   // std::string仍被默认构造
+    BOOST_TEST_CHECK(to_string(b) == "Vec [foo, , ]");
+    b.truncate(1);
+    BOOST_TEST_CHECK(to_string(b) == "Vec [foo]");
+}
+
+BOOST_AUTO_TEST_CASE(SPARE_CAPACITY_TEST) {
+    Vector<int, TrackingAllocator<>> a = {0, 1};
+    a.reserve(8);
+    auto spare = a.spare_capacity();
+    BOOST_REQUIRE(spare.len() == a.capacity() - 2);
+    BOOST_CHECK(spare.as_ptr() == a.data() + 2);
+    for (usize i = 0; i < 3; i++) {
+        spare.as_ptr()[i] = int(i + 2);
+    }
+    a.set_len(5);
+    BOOST_TEST_CHECK(to_string(a) == "Vec [0, 1, 2, 3, 4]");
+
+    Vector<std::string> b;
+    b.reserve(2);
+    std::construct_at(b.spare_capacity().as_ptr(), "foo");
+    b.set_len(1);
+    BOOST_TEST_CHECK(to_string(b) == "Vec [foo]");
+}
+
+BOOST_AUTO_TEST_CASE(SIZE_HINT_TEST) {
+    using Tracking = TrackingAllocator<>;
+    Vector<int, Tracking> src = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    auto twice = [](int& a) { return a * 2; };
+    auto even = [](int& a) { return a % 4 == 0; };
+
+    auto hint = iter::size_hint(src.iter());
+    BOOST_CHECK(hint.lower == 10 && hint.upper.unwrap() == 10);
+
+    auto mapped = iter::combine(src.iter(), iter::Map{}, twice);
+    static_assert(iter::ExactSizeIterator<decltype(mapped)>);
+    BOOST_CHECK(iter::size_hint(mapped).lower == 10);
+
+    auto filtered = iter::combine(src.iter(), iter::Filter{}, even);
+    hint = iter::size_hint(filtered);
+    BOOST_CHECK(hint.lower == 0 && hint.upper.unwrap() == 10);
+
+    auto count = Tracking::get_allocation_count();
+    auto a = iter::combine(src.iter(), iter::Map{}, twice, iter::CollectAs<Vector<int, Tracking>>{});
+    BOOST_CHECK(Tracking::get_allocation_count() == count + 1);      // 仅分配一次
+    BOOST_CHECK(a.size() == 10 && a[9] == 18);
+
+    auto b = iter::collect<Vector<int, Tracking>>(ops::Range<int>(0, 100));
+    BOOST_CHECK(Tracking::get_allocation_count() == count + 2);
+    BOOST_CHECK(b.size() == 100 && b[99] == 99);
+
+    auto c = iter::combine(src.iter(), iter::Filter{}, even, iter::CollectAs<Vector<int, Tracking>>{});
+    BOOST_TEST_CHECK(to_string(c) == "Vec [0, 4, 8]");
+
+    auto d = iter::collect<Vector<int, Tracking>>(std::move(a).into_iter());
+    BOOST_CHECK(d.size() == 10);
+}
+
+template<typename G>
+auto capacities(usize n) {
+    Vector<usize> caps;
+    Vector<u64, ExactAllocator, G> vec{ExactAllocator{}};
+    for (usize i = 0; i < n; i++) {
+        if (vec.size() == vec.capacity()) {
+            caps.push_back(vec.capacity());
+        }
+        vec.push_back(i);
+    }
+    for (usize i = 0; i < n; i++) {
+        BOOST_REQUIRE(vec[i] == i);
+    }
+    return caps;
+}
+
+BOOST_AUTO_TEST_CASE(GROWTH_POLICY_TEST) {
+    using namespace collection::growth;
+
+    BOOST_CHECK(Vector<int>{}.capacity() >= 2);
+    BOOST_CHECK((Vector<int, memory::allocator::Allocator, OneAndHalf>{}.capacity() == 0));
+
+    BOOST_CHECK(OneAndHalf::next_capacity(0, 1, 8) == 2);
+    BOOST_CHECK(OneAndHalf::next_capacity(2, 3, 8) == 3);
+    BOOST_CHECK(OneAndHalf::next_capacity(4, 5, 8) == 6);
+    BOOST_CHECK(OneAndHalf::next_capacity(4, 100, 8) == 100);
+
+    BOOST_CHECK(Doubling::next_capacity(0, 1, 8) == 2);
+    BOOST_CHECK(Doubling::next_capacity(64, 65, 8) == 128);
+
+    // 512 * 8 = 4096字节起按页取整
+    BOOST_CHECK((PageRounded<OneAndHalf>::next_capacity(100, 101, 8) == 150));
+    BOOST_CHECK((PageRounded<OneAndHalf>::next_capacity(400, 401, 8) == 1024));
+    BOOST_CHECK((PageRounded<Doubling>::next_capacity(0, 1000, 24) == 1024));   // 24000字节取整为24576字节
+
+    using Huge = HugeBuffer<1024, 4096>;
+    BOOST_CHECK(Huge::next_capacity(64, 65, 8) == 128);        // 512字节, 翻倍
+    BOOST_CHECK(Huge::next_capacity(128, 129, 8) == 1024);     // 1024字节, 增加4096字节并对齐到4096字节
+    BOOST_CHECK(Huge::next_capacity(1024, 1025, 8) == 1536);
+    BOOST_CHECK(Huge::next_capacity(1024, 5000, 8) == 5120);
+
+    auto c = capacities<OneAndHalf>(100);
+    BOOST_TEST_CHECK(to_string(c) == "Vec [0, 2, 3, 5, 8, 12, 18, 27, 41, 62, 93]");
+    BOOST_CHECK(capacities<Doubling>(100).size() < c.size());
+    capacities<PageRounded<>>(10000);
+    capacities<HugeBuffer<1024, 4096>>(10000);
+
+    // 插入多个元素时同样按增长策略扩展
+    Vector<int, ExactAllocator, OneAndHalf> v{ExactAllocator{}};
+    v.insert(v.begin(), 3, 1);
+    BOOST_CHECK(v.capacity() == 3);
+    v.insert(v.begin(), {0, 0});
+    BOOST_CHECK(v.capacity() == 5);
+    BOOST_TEST_CHECK(to_string(v) == "Vec [0, 0, 1, 1, 1]");
+}
+
 BOOST_AUTO_TEST_CASE(MEMORY_TRACK) {
     std::cout << std::endl;
     std::cout << "================= MEMORY TRACK =================" << std::endl;
@@ -0,0 +1,320 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#include <ranges>
+#include <array>
+#include <span>
+#include <benchmark/benchmark.h>
+#include <mstl/mstl.h>
+
+using namespace mstl;
+using namespace mstl::iter;
+using namespace mstl::collection;
+using utility::get;
+
+// 对64K个u32比较各适配器与等价的std::ranges视图.
+// *_mstl为本库的适配器, *_ranges为std::ranges, *_index为手写的下标循环.
+// GCC 12的<ranges>没有zip, enumerate, stride与concat(均为C++23), 以iota下标与transform代替.
+// 所有循环的次数都取自运行时的size(): 编译期已知的次数会使GCC在-O2下也向量化循环, 比较将不公平.
+// 在-O2下, GCC 12只向量化无需尾部处理的循环, 因此三者的zip, enumerate与rev都不会被向量化; 在-O3(Release)下三者都会.
+
+constexpr usize SIZE = 1 << 16;
+
+Vector<u32> make_data(u32 seed) {
+    Vector<u32> v;
+    v.reserve(SIZE);
+    for (usize i = 0; i < SIZE; i++) {
+        v.push_back(u32(i * seed % 1009));
+    }
+    return v;
+}
+
+template<typename View>
+u64 accumulate(View&& view) {
+    u64 total = 0;
+    for (auto x: view) {
+        total += x;
+    }
+    return total;
+}
+
+// zip | map | sum: 点积
+void BM_zip_index(benchmark::State& state) {
+    auto a = make_data(3), b = make_data(7);
+    const u32* x = a.data();
+    const u32* y = b.data();
+    const usize n = a.size();
+    for (auto _ : state) {
+        u64 total = 0;
+        for (usize i = 0; i < n; i++) {
+            total += u64(x[i]) * y[i];
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_zip_index);
+
+void BM_zip_mstl(benchmark::State& state) {
+    auto a = make_data(3), b = make_data(7);
+    for (auto _ : state) {
+        u64 total = zip(a.citer(), b.citer())
+            | map([](auto p) { return u64(get<0>(p)) * get<1>(p); })
+            | sum();
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_zip_mstl);
+
+void BM_zip_ranges(benchmark::State& state) {
+    auto a = make_data(3), b = make_data(7);
+    const u32* x = a.data();
+    const u32* y = b.data();
+    const usize n = a.size();
+    for (auto _ : state) {
+        u64 total = accumulate(std::views::iota(usize(0), n)
+            | std::views::transform([&](usize i) { return u64(x[i]) * y[i]; }));
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_zip_ranges);
+
+// enumerate | map | sum: 按下标加权求和
+void BM_enumerate_index(benchmark::State& state) {
+    auto a = make_data(3);
+    const u32* x = a.data();
+    const usize n = a.size();
+    for (auto _ : state) {
+        u64 total = 0;
+        for (usize i = 0; i < n; i++) {
+            total += u64(i) * x[i];
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_enumerate_index);
+
+void BM_enumerate_mstl(benchmark::State& state) {
+    auto a = make_data(3);
+    for (auto _ : state) {
+        u64 total = a.citer()
+            | enumerate()
+            | map([](auto p) { return u64(get<0>(p)) * get<1>(p); })
+            | sum();
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_enumerate_mstl);
+
+void BM_enumerate_ranges(benchmark::State& state) {
+    auto a = make_data(3);
+    const u32* x = a.data();
+    const usize n = a.size();
+    for (auto _ : state) {
+        u64 total = accumulate(std::views::iota(usize(0), n)
+            | std::views::transform([&](usize i) { return u64(i) * x[i]; }));
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_enumerate_ranges);
+
+// chain | sum
+void BM_chain_mstl(benchmark::State& state) {
+    auto a = make_data(3), b = make_data(7);
+    for (auto _ : state) {
+        u64 total = a.citer()
+            | chain(b.citer())
+            | map([](const u32& x) { return u64(x); })
+            | sum();
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE * 2);
+}
+BENCHMARK(BM_chain_mstl);
+
+void BM_chain_ranges(benchmark::State& state) {
+    auto a = make_data(3), b = make_data(7);
+    std::array<std::span<const u32>, 2> parts = {
+        std::span<const u32>(a.data(), a.size()), std::span<const u32>(b.data(), b.size())
+    };
+    for (auto _ : state) {
+        u64 total = accumulate(parts | std::views::join);
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE * 2);
+}
+BENCHMARK(BM_chain_ranges);
+
+// skip | take | sum: 保留连续迭代器时使用SIMD求和
+void BM_skip_take_mstl(benchmark::State& state) {
+    auto a = make_data(3);
+    for (auto _ : state) {
+        u32 total = a.citer() | skip(SIZE / 4) | take(SIZE / 2) | sum();
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE / 2);
+}
+BENCHMARK(BM_skip_take_mstl);
+
+void BM_skip_take_ranges(benchmark::State& state) {
+    auto a = make_data(3);
+    std::span<const u32> s(a.data(), a.size());
+    for (auto _ : state) {
+        u32 total = 0;
+        for (u32 x: s | std::views::drop(SIZE / 4) | std::views::take(SIZE / 2)) {
+            total += x;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE / 2);
+}
+BENCHMARK(BM_skip_take_ranges);
+
+// step_by | sum
+void BM_step_by_mstl(benchmark::State& state) {
+    auto a = make_data(3);
+    for (auto _ : state) {
+        u64 total = a.citer() | step_by(4) | map([](const u32& x) { return u64(x); }) | sum();
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE / 4);
+}
+BENCHMARK(BM_step_by_mstl);
+
+void BM_step_by_ranges(benchmark::State& state) {
+    auto a = make_data(3);
+    const u32* x = a.data();
+    const usize n = a.size() / 4;
+    for (auto _ : state) {
+        u64 total = accumulate(std::views::iota(usize(0), n)
+            | std::views::transform([&](usize i) { return u64(x[i * 4]); }));
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE / 4);
+}
+BENCHMARK(BM_step_by_ranges);
+
+// take_while | sum: 数据中没有元素使谓词不成立, 因此迭代全部元素
+auto below = [](const u32& x) { return x < 2000; };
+
+void BM_take_while_mstl(benchmark::State& state) {
+    auto a = make_data(3);
+    for (auto _ : state) {
+        u64 total = a.citer() | take_while(below) | map([](const u32& x) { return u64(x); }) | sum();
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_take_while_mstl);
+
+void BM_take_while_ranges(benchmark::State& state) {
+    auto a = make_data(3);
+    std::span<const u32> s(a.data(), a.size());
+    for (auto _ : state) {
+        u64 total = accumulate(s | std::views::take_while(below));
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_take_while_ranges);
+
+// skip_while | sum: 跳过开头的一半元素
+void BM_skip_while_mstl(benchmark::State& state) {
+    auto a = make_data(3);
+    const u32* half = a.data() + SIZE / 2;
+    for (auto _ : state) {
+        u64 total = a.citer()
+            | skip_while([&](const u32& x) { return &x < half; })
+            | map([](const u32& x) { return u64(x); })
+            | sum();
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_skip_while_mstl);
+
+void BM_skip_while_ranges(benchmark::State& state) {
+    auto a = make_data(3);
+    const u32* half = a.data() + SIZE / 2;
+    std::span<const u32> s(a.data(), a.size());
+    for (auto _ : state) {
+        u64 total = accumulate(s | std::views::drop_while([&](const u32& x) { return &x < half; }));
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_skip_while_ranges);
+
+// flat_map | sum: 每个外层元素展开为16个元素
+constexpr usize INNER = 16;
+
+void BM_flat_map_mstl(benchmark::State& state) {
+    auto a = make_data(3);
+    for (auto _ : state) {
+        u64 total = a.citer()
+            | take(SIZE / INNER)
+            | flat_map([](const u32& x) { return ops::Range<u64>(x, x + INNER); })
+            | sum();
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_flat_map_mstl);
+
+void BM_flat_map_ranges(benchmark::State& state) {
+    auto a = make_data(3);
+    std::span<const u32> s(a.data(), a.size() / INNER);
+    for (auto _ : state) {
+        u64 total = accumulate(s
+            | std::views::transform([](u32 x) { return std::views::iota(u64(x), u64(x) + INNER); })
+            | std::views::join);
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_flat_map_ranges);
+
+// rev | sum
+void BM_rev_index(benchmark::State& state) {
+    auto a = make_data(3);
+    const u32* x = a.data();
+    const usize n = a.size();
+    for (auto _ : state) {
+        u64 total = 0;
+        for (usize i = n; i > 0; i--) {
+            total += x[i - 1];
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_rev_index);
+
+void BM_rev_mstl(benchmark::State& state) {
+    auto a = make_data(3);
+    for (auto _ : state) {
+        u64 total = a.citer() | rev() | map([](const u32& x) { return u64(x); }) | sum();
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_rev_mstl);
+
+void BM_rev_ranges(benchmark::State& state) {
+    auto a = make_data(3);
+    std::span<const u32> s(a.data(), a.size());
+    for (auto _ : state) {
+        u64 total = accumulate(s | std::views::reverse);
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_rev_ranges);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,217 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#include <string>
+#include <mstl/mstl.h>
+
+#define BOOST_TEST_MODULE Adapters Test
+
+#include <boost/test/unit_test.hpp>
+
+using namespace mstl;
+using namespace mstl::iter;
+using namespace mstl::collection;
+using utility::get;
+
+using VIter = VectorIter<i32>;
+
+// 保留源迭代器的能力
+static_assert(ContinuousIterator<iter::_private::TakeIter<VIter>>);
+static_assert(ContinuousIterator<iter::_private::SkipIter<VIter>>);
+static_assert(DoubleEndedIterator<iter::_private::ZipIter<VIter, VIter>>);
+static_assert(ExactSizeIterator<iter::_private::ZipIter<VIter, VIter>>);
+static_assert(ExactSizeIterator<iter::_private::ChainIter<VIter, VIter>>);
+static_assert(DoubleEndedIterator<iter::_private::EnumerateIter<VIter>>);
+static_assert(ExactSizeIterator<iter::_private::StepByIter<VIter>>);
+static_assert(ExactSizeIterator<iter::_private::RevIter<VIter>>);
+static_assert(!ExactSizeIterator<iter::_private::ZipIter<decltype(List<i32>{}.iter()), VIter>>);
+
+// flat_map不接受借用自身存储的容器
+static_assert(iter::_private::FlatMapResult<Vector<i32>>);
+static_assert(!iter::_private::FlatMapResult<Array<i32, 3>>);
+
+auto copy = [](const i32& x) { return x; };
+
+Vector<i32> numbers(i32 n) {
+    Vector<i32> v;
+    for (i32 i = 0; i < n; i++) {
+        v.push_back(i);
+    }
+    return v;
+}
+
+BOOST_AUTO_TEST_CASE(ZIP_TEST) {
+    Vector<i32> a = {1, 2, 3};
+    Vector<i32> b = {4, 5, 6, 7};
+    i32 dot = zip(a.iter(), b.iter()) | map([](auto p) { return get<0>(p) * get<1>(p); }) | sum();
+    BOOST_CHECK_EQUAL(dot, 32);
+
+    auto pairs = a.iter() | zip(b.iter());
+    BOOST_REQUIRE_EQUAL(pairs.len(), 3);
+    auto last = pairs.prev().unwrap();
+    BOOST_CHECK_EQUAL(get<0>(last), 3);
+    BOOST_CHECK_EQUAL(get<1>(last), 6);
+    auto first = pairs.next().unwrap();
+    BOOST_CHECK_EQUAL(get<1>(first), 4);
+    BOOST_CHECK_EQUAL(pairs.len(), 1);
+
+    // 元素以可变引用返回时, 可以通过二元组修改源容器
+    zip(a.iter(), b.iter()) | for_each([](auto p) { get<0>(p) += get<1>(p); });
+    BOOST_CHECK_EQUAL(a[2], 9);
+
+    // 不能下标访问的迭代器, 以及按值返回的元素
+    List<std::string> names;
+    names.push_back("a");
+    names.push_back("b");
+    auto labels = zip(names.iter(), a.iter()) | map([](auto p) {
+        return get<0>(p) + std::to_string(get<1>(p));
+    }) | collect<Vector<std::string>>();
+    BOOST_REQUIRE_EQUAL(labels.size(), 2);
+    BOOST_CHECK_EQUAL(labels[1], "b7");
+
+    auto hint = iter::size_hint(zip(names.iter(), a.iter()));
+    BOOST_CHECK_EQUAL(hint.lower, 0);
+    BOOST_CHECK_EQUAL(hint.upper.unwrap(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(CHAIN_TEST) {
+    Vector<i32> a = {1, 2};
+    Vector<i32> b = {3, 4};
+    auto v = a.iter() | chain(b.iter()) | map(copy) | collect<Vector<i32>>();
+    BOOST_CHECK(v == Vector<i32>({1, 2, 3, 4}));
+
+    auto both = chain(a.iter(), b.iter());
+    BOOST_CHECK_EQUAL(both.len(), 4);
+    BOOST_CHECK_EQUAL(both.prev().unwrap(), 4);
+    BOOST_CHECK_EQUAL(both.next().unwrap(), 1);
+    BOOST_CHECK_EQUAL(both | sum(), 5);
+
+    auto found = a.iter() | chain(b.iter()) | find([](const i32& x) { return x > 2; });
+    BOOST_CHECK_EQUAL(found.unwrap(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(ENUMERATE_TEST) {
+    Vector<std::string> v = {"x", "y", "z"};
+    auto it = v.iter() | enumerate();
+    auto last = it.prev().unwrap();
+    BOOST_CHECK_EQUAL(get<0>(last), 2);
+    BOOST_CHECK_EQUAL(get<1>(last), "z");
+    auto first = it.next().unwrap();
+    BOOST_CHECK_EQUAL(get<0>(first), 0);
+
+    usize weighted = numbers(5).iter() | enumerate() | map([](auto p) {
+        return get<0>(p) * usize(get<1>(p));
+    }) | sum();
+    BOOST_CHECK_EQUAL(weighted, 30);
+}
+
+BOOST_AUTO_TEST_CASE(TAKE_SKIP_TEST) {
+    auto v = numbers(10);
+    BOOST_CHECK_EQUAL(v.iter() | take(3) | sum(), 3);
+    BOOST_CHECK_EQUAL(v.iter() | take(100) | sum(), 45);
+    BOOST_CHECK_EQUAL(v.iter() | skip(7) | sum(), 24);
+    BOOST_CHECK((v.iter() | skip(100)).next().is_none());
+    BOOST_CHECK_EQUAL(v.iter() | skip(2) | take(3) | sum(), 9);
+
+    auto window = v.iter() | skip(2) | take(3);
+    BOOST_CHECK_EQUAL(window.len(), 3);
+    BOOST_CHECK_EQUAL(*window.start_addr(), 2);
+    BOOST_CHECK_EQUAL(window.prev().unwrap(), 4);
+    BOOST_CHECK_EQUAL(window.next().unwrap(), 2);
+
+    // 不能内部迭代的源迭代器在第n个元素之后停止
+    List<i32> list;
+    for (i32 i = 0; i < 10; i++) {
+        list.push_back(i);
+    }
+    BOOST_CHECK_EQUAL(list.iter() | take(4) | sum(), 6);
+    BOOST_CHECK_EQUAL(list.iter() | skip(8) | sum(), 17);
+
+    auto taken = list.iter() | take(4);
+    BOOST_CHECK(find(taken, [](const i32& x) { return x == 5; }).is_none());
+    BOOST_CHECK(taken.next().is_none());
+}
+
+BOOST_AUTO_TEST_CASE(WHILE_TEST) {
+    Vector<i32> v = {1, 2, 5, 1, 2};
+    auto small = [](const i32& x) { return x < 3; };
+    BOOST_CHECK_EQUAL(v.iter() | take_while(small) | sum(), 3);
+    BOOST_CHECK_EQUAL(v.iter() | skip_while(small) | sum(), 8);
+
+    auto it = v.iter() | take_while(small);
+    BOOST_CHECK_EQUAL(it.next().unwrap(), 1);
+    BOOST_CHECK_EQUAL(it.next().unwrap(), 2);
+    BOOST_CHECK(it.next().is_none());
+    BOOST_CHECK(it.next().is_none());
+
+    auto rest = v.iter() | skip_while(small);
+    BOOST_CHECK_EQUAL(rest.next().unwrap(), 5);
+    BOOST_CHECK_EQUAL(find(rest, [](const i32& x) { return x == 2; }).unwrap(), 2);
+    BOOST_CHECK(rest.next().is_none());
+}
+
+BOOST_AUTO_TEST_CASE(STEP_BY_TEST) {
+    auto v = numbers(10);
+    auto evens = v.iter() | step_by(3) | map(copy) | collect<Vector<i32>>();
+    BOOST_CHECK(evens == Vector<i32>({0, 3, 6, 9}));
+
+    auto it = v.iter() | step_by(4);
+    BOOST_CHECK_EQUAL(it.len(), 3);
+    BOOST_CHECK_EQUAL(it.prev().unwrap(), 8);
+    BOOST_CHECK_EQUAL(it.next().unwrap(), 0);
+    BOOST_CHECK_EQUAL(it.next().unwrap(), 4);
+    BOOST_CHECK(it.next().is_none());
+
+    // 已经返回第一个元素后, 内部迭代仍从正确的位置开始
+    auto rest = v.iter() | step_by(3);
+    rest.next();
+    BOOST_CHECK_EQUAL(rest | sum(), 18);
+
+    List<i32> list;
+    for (i32 i = 0; i < 10; i++) {
+        list.push_back(i);
+    }
+    BOOST_CHECK_EQUAL(list.iter() | step_by(3) | sum(), 18);
+}
+
+BOOST_AUTO_TEST_CASE(FLAT_MAP_TEST) {
+    Vector<i32> v = {1, 2, 3};
+    auto ranges = v.iter() | flat_map([](const i32& x) { return ops::Range<i32>(0, x); });
+    BOOST_CHECK_EQUAL(ranges | sum(), 4);
+
+    auto words = v.iter() | flat_map([](const i32& x) {
+        Vector<std::string> w;
+        for (i32 i = 0; i < x; i++) {
+            w.push_back(std::to_string(x));
+        }
+        return w;
+    });
+    auto flat = std::move(words) | collect<Vector<std::string>>();
+    BOOST_REQUIRE_EQUAL(flat.size(), 6);
+    BOOST_CHECK_EQUAL(flat[5], "3");
+
+    // 提前停止后从内层迭代器的停止处继续
+    auto it = v.iter() | flat_map([](const i32& x) { return ops::Range<i32>(0, x); });
+    BOOST_CHECK_EQUAL(find(it, [](const i32& x) { return x == 1; }).unwrap(), 1);
+    BOOST_CHECK_EQUAL(it.next().unwrap(), 0);
+    BOOST_CHECK_EQUAL(it.next().unwrap(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(REV_TEST) {
+    auto v = numbers(5);
+    auto reversed = v.iter() | rev() | map(copy) | collect<Vector<i32>>();
+    BOOST_CHECK(reversed == Vector<i32>({4, 3, 2, 1, 0}));
+
+    auto it = v.iter() | rev();
+    BOOST_CHECK_EQUAL(it.len(), 5);
+    BOOST_CHECK_EQUAL(it.prev().unwrap(), 0);
+    BOOST_CHECK_EQUAL(find(it, [](const i32& x) { return x < 4; }).unwrap(), 3);
+    BOOST_CHECK_EQUAL(it.next().unwrap(), 2);
+
+    Array<std::string, 3> arr = {"a", "b", "c"};
+    auto joined = arr.into_iter() | rev() | fold(std::string(), [](std::string acc, std::string s) {
+        return acc + s;
+    });
+    BOOST_CHECK_EQUAL(joined, "cba");
+}
@@ -0,0 +1,117 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#include <benchmark/benchmark.h>
+#include <mstl/mstl.h>
+
+using namespace mstl;
+using namespace mstl::iter;
+using namespace mstl::collection;
+
+// 对1M个float的传感器帧计算滑动平均与分块平均.
+// *_index为以下标访问的对照组, 其余为windows/chunks_exact适配器.
+
+constexpr usize SIZE = 1 << 20;
+constexpr usize WIDTH = 8;
+
+Vector<float> make_frame() {
+    Vector<float> v;
+    v.reserve(SIZE);
+    for (usize i = 0; i < SIZE; i++) {
+        v.push_back(float(i % 97) * 0.5f);
+    }
+    return v;
+}
+
+// 滑动平均: 每个输出是相邻WIDTH个输入的平均值
+void BM_moving_avg_index(benchmark::State& state) {
+    auto frame = make_frame();
+    Vector<float> out(SIZE - WIDTH + 1);
+    const usize width = state.range(0);
+    for (auto _ : state) {
+        for (usize i = 0; i + width <= frame.size(); i++) {
+            float sum = 0;
+            for (usize j = 0; j < width; j++) {
+                sum += frame[i + j];
+            }
+            out[i] = sum / float(width);
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_moving_avg_index)->Arg(WIDTH);
+
+void BM_moving_avg_windows(benchmark::State& state) {
+    auto frame = make_frame();
+    Vector<float> out(SIZE - WIDTH + 1);
+    const usize width = state.range(0);
+    for (auto _ : state) {
+        float* dst = out.data();
+        frame.citer() | windows(width) | for_each([&](Slice<const float> w) {
+            float sum = 0;
+            w.iter() | for_each([&](const float& x) { sum += x; });
+            *dst++ = sum / float(width);
+        });
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_moving_avg_windows)->Arg(WIDTH);
+
+// 分块平均: 每WIDTH个输入输出一个平均值, 即降采样. 前两者的块大小在运行时给出, chunks_exact<N>在编译期给出
+void BM_block_avg_index(benchmark::State& state) {
+    auto frame = make_frame();
+    Vector<float> out(SIZE / WIDTH);
+    const usize width = state.range(0);
+    for (auto _ : state) {
+        for (usize i = 0; i < out.size(); i++) {
+            float sum = 0;
+            for (usize j = 0; j < width; j++) {
+                sum += frame[i * width + j];
+            }
+            out[i] = sum / float(width);
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_block_avg_index)->Arg(WIDTH);
+
+void BM_block_avg_chunks_exact(benchmark::State& state) {
+    auto frame = make_frame();
+    Vector<float> out(SIZE / WIDTH);
+    const usize width = state.range(0);
+    for (auto _ : state) {
+        float* dst = out.data();
+        frame.citer() | chunks_exact(width) | for_each([&](Slice<const float> block) {
+            float sum = 0;
+            block.iter() | for_each([&](const float& x) { sum += x; });
+            *dst++ = sum / float(width);
+        });
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_block_avg_chunks_exact)->Arg(WIDTH);
+
+void BM_block_avg_array_chunks(benchmark::State& state) {
+    auto frame = make_frame();
+    Vector<float> out(SIZE / WIDTH);
+    for (auto _ : state) {
+        float* dst = out.data();
+        frame.citer() | chunks_exact<WIDTH>() | for_each([&](const Array<float, WIDTH>& block) {
+            float sum = 0;
+            for (float x: block) {
+                sum += x;
+            }
+            *dst++ = sum / float(WIDTH);
+        });
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_block_avg_array_chunks);
+
+BENCHMARK_MAIN();
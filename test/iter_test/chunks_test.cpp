@@ -0,0 +1,111 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#include <mstl/mstl.h>
+
+#define BOOST_TEST_MODULE Chunks Adapter Test
+
+#include <boost/test/unit_test.hpp>
+
+using namespace mstl;
+using namespace mstl::iter;
+using namespace mstl::collection;
+
+static_assert(ExactSizeIterator<iter::_private::ChunksIter<VectorIter<i32>>>);
+static_assert(DoubleEndedIterator<iter::_private::WindowsIter<SliceRefIter<i32, const i32&>>>);
+static_assert(std::same_as<iter::_private::ChunksIter<VectorIter<i32>>::Item, Slice<i32>>);
+static_assert(std::same_as<iter::_private::ChunksIter<VectorIter<const i32>>::Item, Slice<const i32>>);
+static_assert(std::same_as<iter::_private::ArrayChunksIter<VectorIter<const i32>, 4>::Item, const Array<i32, 4>&>);
+
+template<typename T>
+Vector<std::remove_const_t<T>> to_vector(Slice<T> slice) {
+    Vector<std::remove_const_t<T>> v;
+    v.extend_from_slice(slice);
+    return v;
+}
+
+BOOST_AUTO_TEST_CASE(CHUNKS_TEST) {
+    Vector<i32> v = {1, 2, 3, 4, 5, 6, 7};
+    auto it = v.iter() | chunks(3);
+    BOOST_CHECK_EQUAL(it.len(), 3);
+    BOOST_CHECK(to_vector(it.next().unwrap()) == Vector<i32>({1, 2, 3}));
+    BOOST_CHECK(to_vector(it.next().unwrap()) == Vector<i32>({4, 5, 6}));
+    BOOST_CHECK(to_vector(it.next().unwrap()) == Vector<i32>({7}));
+    BOOST_CHECK(it.next().is_none());
+
+    // 从尾部迭代时, 先返回较短的最后一块
+    auto back = v.iter() | chunks(3);
+    BOOST_CHECK_EQUAL(back.prev().unwrap().len(), 1);
+    BOOST_CHECK_EQUAL(back.prev().unwrap().len(), 3);
+    BOOST_CHECK_EQUAL(back.len(), 1);
+
+    usize count = v.iter() | chunks(2) | fold(usize(0), [](usize acc, Slice<i32> s) { return acc + s.len(); });
+    BOOST_CHECK_EQUAL(count, 7);
+
+    Vector<i32> empty;
+    BOOST_CHECK((empty.iter() | chunks(3)).next().is_none());
+}
+
+BOOST_AUTO_TEST_CASE(CHUNKS_EXACT_TEST) {
+    Vector<i32> v = {1, 2, 3, 4, 5, 6, 7};
+    auto it = v.citer() | chunks_exact(3);
+    BOOST_CHECK_EQUAL(it.len(), 2);
+    BOOST_CHECK(to_vector(it.remainder()) == Vector<i32>({7}));
+    BOOST_CHECK(to_vector(it.prev().unwrap()) == Vector<i32>({4, 5, 6}));
+    BOOST_CHECK(to_vector(it.next().unwrap()) == Vector<i32>({1, 2, 3}));
+    BOOST_CHECK(it.next().is_none());
+    BOOST_CHECK(to_vector(it.remainder()) == Vector<i32>({7}));
+
+    // 可变的视图可以修改源中的元素
+    v.iter() | chunks_exact(2) | for_each([](Slice<i32> s) {
+        s.as_ptr()[0] = 0;
+    });
+    BOOST_CHECK(v == Vector<i32>({0, 2, 0, 4, 0, 6, 7}));
+}
+
+BOOST_AUTO_TEST_CASE(ARRAY_CHUNKS_TEST) {
+    Vector<i32> v = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    i32 total = v.citer() | chunks_exact<4>() | fold(0, [](i32 acc, const Array<i32, 4>& block) {
+        for (i32 x: block) {
+            acc += x;
+        }
+        return acc;
+    });
+    BOOST_CHECK_EQUAL(total, 36);
+
+    auto it = v.iter() | chunks_exact<4>();
+    BOOST_CHECK_EQUAL(it.len(), 2);
+    BOOST_CHECK_EQUAL(it.remainder().len(), 1);
+    Array<i32, 4>& first = it.next().unwrap();
+    first[3] = 40;
+    BOOST_CHECK_EQUAL(v[3], 40);
+    BOOST_CHECK_EQUAL(it.prev().unwrap()[0], 5);
+
+    // 按值迭代的ArrayIter借用数组的存储, 复制适配器后仍指向同一数组
+    Array<i32, 5> arr = {1, 2, 3, 4, 5};
+    auto by_value = arr.into_iter() | chunks_exact<2>();
+    auto copy = by_value;
+    BOOST_CHECK_EQUAL(copy.next().unwrap()[1], 2);
+    BOOST_CHECK_EQUAL(copy.next().unwrap()[0], 3);
+    BOOST_CHECK_EQUAL(*copy.remainder().as_ptr(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(WINDOWS_TEST) {
+    Vector<i32> v = {1, 2, 3, 4, 5};
+    auto it = v.as_slice().iter() | windows(3);
+    BOOST_CHECK_EQUAL(it.len(), 3);
+    BOOST_CHECK(to_vector(it.next().unwrap()) == Vector<i32>({1, 2, 3}));
+    BOOST_CHECK(to_vector(it.prev().unwrap()) == Vector<i32>({3, 4, 5}));
+    BOOST_CHECK(to_vector(it.next().unwrap()) == Vector<i32>({2, 3, 4}));
+    BOOST_CHECK(it.next().is_none());
+
+    BOOST_CHECK_EQUAL((v.iter() | windows(5)).len(), 1);
+    BOOST_CHECK_EQUAL((v.iter() | windows(6)).len(), 0);
+    BOOST_CHECK((v.iter() | windows(6)).next().is_none());
+
+    auto sums = v.citer() | windows(2) | map([](Slice<const i32> w) {
+        return w.as_ptr()[0] + w.as_ptr()[1];
+    }) | collect<Vector<i32>>();
+    BOOST_CHECK(sums == Vector<i32>({3, 5, 7, 9}));
+}
@@ -0,0 +1,121 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#include <string>
+#include <benchmark/benchmark.h>
+#include <mstl/mstl.h>
+
+using namespace mstl;
+using namespace mstl::iter;
+using namespace mstl::collection;
+
+// 迭代含有4K个元素的链表.
+// *_next以反复调用next()的方式迭代, 作为对照组; *_next_chunk以next_chunk<32>()成批取得元素; *_fold为终结操作.
+
+constexpr usize SIZE = 1 << 12;
+constexpr usize CHUNK = 32;
+
+List<u64> make_list() {
+    List<u64> list;
+    for (usize i = 0; i < SIZE; i++) {
+        list.push_back(i);
+    }
+    return list;
+}
+
+// 元素为引用时, Option<T&>只是一个指针, 各种方式的开销相近
+void BM_list_next(benchmark::State& state) {
+    auto list = make_list();
+    for (auto _ : state) {
+        u64 total = 0;
+        auto iter = list.iter();
+        for (auto next = iter.next(); next.is_some(); next = iter.next()) {
+            total += next.unwrap_unchecked();
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_list_next);
+
+void BM_list_next_chunk(benchmark::State& state) {
+    auto list = make_list();
+    for (auto _ : state) {
+        u64 total = 0;
+        auto iter = list.iter();
+        while (true) {
+            auto chunk = iter.next_chunk<CHUNK>();
+            if (chunk.is_empty()) {
+                break;
+            }
+            for (usize i = 0; i < chunk.len(); i++) {
+                total += chunk[i];
+            }
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_list_next_chunk);
+
+void BM_list_fold(benchmark::State& state) {
+    auto list = make_list();
+    for (auto _ : state) {
+        u64 total = list.iter() | fold(u64(0), [](u64 acc, const u64& x) { return acc + x; });
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_list_fold);
+
+// 元素为std::string等值时, 逐个调用next()要为每个元素移动构造并析构Option<std::string>
+auto to_label = [](const u64& x) { return std::string(20, char('a' + x % 26)); };
+
+void BM_list_label_next(benchmark::State& state) {
+    auto list = make_list();
+    for (auto _ : state) {
+        usize total = 0;
+        auto iter = list.iter() | map(to_label);
+        for (auto next = iter.next(); next.is_some(); next = iter.next()) {
+            total += next.unwrap_unchecked().size();
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_list_label_next);
+
+void BM_list_label_next_chunk(benchmark::State& state) {
+    auto list = make_list();
+    for (auto _ : state) {
+        usize total = 0;
+        auto iter = list.iter() | map(to_label);
+        while (true) {
+            auto chunk = iter.next_chunk<CHUNK>();
+            if (chunk.is_empty()) {
+                break;
+            }
+            for (usize i = 0; i < chunk.len(); i++) {
+                total += chunk[i].size();
+            }
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_list_label_next_chunk);
+
+void BM_list_label_fold(benchmark::State& state) {
+    auto list = make_list();
+    for (auto _ : state) {
+        usize total = list.iter()
+            | map(to_label)
+            | fold(usize(0), [](usize acc, std::string s) { return acc + s.size(); });
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_list_label_fold);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,148 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#include <string>
+#include <mstl/mstl.h>
+
+#define BOOST_TEST_MODULE Next Chunk Test
+
+#include <boost/test/unit_test.hpp>
+
+using namespace mstl;
+using namespace mstl::iter;
+using namespace mstl::collection;
+
+static_assert(ChunkedIterator<VectorIter<i32>>);
+static_assert(ChunkedIterator<SliceRefIter<i32, const i32&>>);
+static_assert(ChunkedIterator<decltype(List<i32>{}.iter())>);
+static_assert(!ChunkedIterator<ops::Range<i32>>);
+
+BOOST_AUTO_TEST_CASE(CONTINUOUS_TEST) {
+    Vector<i32> v = {1, 2, 3, 4, 5};
+    auto iter = v.iter();
+    auto first = iter.next_chunk<3>();
+    BOOST_REQUIRE_EQUAL(first.len(), 3);
+    BOOST_CHECK(first.is_full());
+    BOOST_CHECK_EQUAL(first[2], 3);
+    first[0] = 10;
+    BOOST_CHECK_EQUAL(v[0], 10);
+
+    auto second = iter.next_chunk<3>();
+    BOOST_REQUIRE_EQUAL(second.len(), 2);
+    BOOST_CHECK_EQUAL(second[1], 5);
+    BOOST_CHECK(iter.next_chunk<3>().is_empty());
+
+    auto slice = v.as_slice().iter();
+    BOOST_CHECK_EQUAL(slice.next_chunk<8>().len(), 5);
+    BOOST_CHECK(slice.next().is_none());
+}
+
+BOOST_AUTO_TEST_CASE(LIST_TEST) {
+    List<i32> list;
+    for (i32 i = 0; i < 10; i++) {
+        list.push_back(i);
+    }
+    auto iter = list.iter();
+    auto chunk = iter.next_chunk<4>();
+    BOOST_REQUIRE_EQUAL(chunk.len(), 4);
+    BOOST_CHECK_EQUAL(chunk[3], 3);
+    BOOST_CHECK_EQUAL(iter.next().unwrap(), 4);
+
+    i32 total = list.iter() | fold(0, [](i32 acc, const i32& x) { return acc + x; });
+    BOOST_CHECK_EQUAL(total, 45);
+}
+
+BOOST_AUTO_TEST_CASE(ADAPTER_TEST) {
+    List<i32> list;
+    for (i32 i = 0; i < 10; i++) {
+        list.push_back(i);
+    }
+
+    auto mapped = list.iter() | map([](const i32& x) { return std::to_string(x); });
+    auto labels = mapped.next_chunk<4>();
+    BOOST_REQUIRE_EQUAL(labels.len(), 4);
+    BOOST_CHECK_EQUAL(labels[1], "1");
+    std::string taken = labels.take(3);
+    BOOST_CHECK_EQUAL(taken, "3");
+
+    // 过滤后的块可能少于N个元素, 但只在耗尽时为空
+    auto filtered = list.iter() | filter([](const i32& x) { return x % 4 == 3; });
+    auto odd = filtered.next_chunk<2>();
+    BOOST_REQUIRE_EQUAL(odd.len(), 1);
+    BOOST_CHECK_EQUAL(odd[0], 3);
+    auto next = filtered.next_chunk<2>();
+    BOOST_REQUIRE_EQUAL(next.len(), 1);
+    BOOST_CHECK_EQUAL(next[0], 7);
+    BOOST_CHECK(filtered.next_chunk<2>().is_empty());
+}
+
+BOOST_AUTO_TEST_CASE(DEFAULT_TEST) {
+    auto range = ops::Range<i32>(0, 5);
+    auto chunk = next_chunk<4>(range);
+    BOOST_REQUIRE_EQUAL(chunk.len(), 4);
+    BOOST_CHECK_EQUAL(chunk[3], 3);
+    BOOST_CHECK_EQUAL(next_chunk<4>(range).len(), 1);
+}
+
+struct Counted {
+    inline static i32 alive = 0;
+    i32 value;
+
+    Counted(i32 value): value(value) { alive++; }
+    Counted(const Counted& other): value(other.value) { alive++; }
+    Counted(Counted&& other) noexcept: value(other.value) { alive++; }
+    ~Counted() { alive--; }
+};
+
+BOOST_AUTO_TEST_CASE(LIFETIME_TEST) {
+    {
+        IterChunk<Counted, 4> chunk;
+        chunk.push(Counted{1});
+        chunk.push(Counted{2});
+        BOOST_CHECK_EQUAL(Counted::alive, 2);
+
+        IterChunk<Counted, 4> moved(std::move(chunk));
+        BOOST_CHECK_EQUAL(moved[1].value, 2);
+        BOOST_CHECK_EQUAL(Counted::alive, 4);
+    }
+    BOOST_CHECK_EQUAL(Counted::alive, 0);
+}
+
+/// 只实现了next_chunk的迭代器: 终结操作应成批消耗它
+class Countdown {
+public:
+    using Item = i32;
+
+    explicit Countdown(i32 from): cur(from) {}
+
+    Option<Item> next() {
+        next_calls++;
+        return cur > 0 ? Option<Item>::some(cur--) : Option<Item>::none();
+    }
+
+    template<usize N>
+    IterChunk<Item, N> next_chunk() {
+        IterChunk<Item, N> chunk;
+        while (cur > 0 && !chunk.is_full()) {
+            chunk.push(cur--);
+        }
+        return chunk;
+    }
+
+    usize next_calls = 0;
+
+private:
+    i32 cur;
+};
+
+BOOST_AUTO_TEST_CASE(TERMINAL_TEST) {
+    static_assert(ChunkedIterator<Countdown>);
+    Countdown countdown(100);
+    i32 total = 0;
+    for_each_internal(countdown, [&](i32 x) { total += x; });
+    BOOST_CHECK_EQUAL(total, 5050);
+    BOOST_CHECK_EQUAL(countdown.next_calls, 0);
+
+    BOOST_CHECK_EQUAL(Countdown(10) | fold(0, [](i32 acc, i32 x) { return acc + x; }), 55);
+}
@@ -0,0 +1,123 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#include <benchmark/benchmark.h>
+#include <mstl/mstl.h>
+
+using namespace mstl;
+using namespace mstl::iter;
+using namespace mstl::collection;
+
+// 模拟每个周期的指标聚合: 对1M个u32/float求和, 求最值, 统计与查找.
+// *_fold为以fold逐个处理的对照组, *_simd为对应的数值终结操作.
+
+constexpr usize SIZE = 1 << 20;
+
+template<typename T>
+Vector<T> make_values() {
+    Vector<T> v;
+    v.reserve(SIZE);
+    for (usize i = 0; i < SIZE; i++) {
+        v.push_back(T(i * 7 % 1000));
+    }
+    return v;
+}
+
+template<typename T>
+void BM_sum_fold(benchmark::State& state) {
+    auto v = make_values<T>();
+    for (auto _ : state) {
+        T total = v.iter() | fold(T(0), [](T acc, const T& x) { return acc + x; });
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(state.iterations() * SIZE * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_sum_fold, u32);
+BENCHMARK_TEMPLATE(BM_sum_fold, float);
+
+template<typename T>
+void BM_sum_simd(benchmark::State& state) {
+    auto v = make_values<T>();
+    for (auto _ : state) {
+        T total = v.iter() | sum();
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(state.iterations() * SIZE * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_sum_simd, u32);
+BENCHMARK_TEMPLATE(BM_sum_simd, float);
+
+template<typename T>
+void BM_max_fold(benchmark::State& state) {
+    auto v = make_values<T>();
+    for (auto _ : state) {
+        T m = v.iter() | fold(v[0], [](T acc, const T& x) { return x > acc ? x : acc; });
+        benchmark::DoNotOptimize(m);
+    }
+    state.SetBytesProcessed(state.iterations() * SIZE * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_max_fold, u32);
+BENCHMARK_TEMPLATE(BM_max_fold, float);
+
+template<typename T>
+void BM_max_simd(benchmark::State& state) {
+    auto v = make_values<T>();
+    for (auto _ : state) {
+        auto m = v.iter() | max();
+        benchmark::DoNotOptimize(m);
+    }
+    state.SetBytesProcessed(state.iterations() * SIZE * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_max_simd, u32);
+BENCHMARK_TEMPLATE(BM_max_simd, float);
+
+template<typename T>
+void BM_count_fold(benchmark::State& state) {
+    auto v = make_values<T>();
+    for (auto _ : state) {
+        usize n = v.iter() | fold(usize(0), [](usize acc, const T& x) { return acc + (x == T(42)); });
+        benchmark::DoNotOptimize(n);
+    }
+    state.SetBytesProcessed(state.iterations() * SIZE * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_count_fold, u32);
+
+template<typename T>
+void BM_count_simd(benchmark::State& state) {
+    auto v = make_values<T>();
+    for (auto _ : state) {
+        usize n = v.iter() | count(T(42));
+        benchmark::DoNotOptimize(n);
+    }
+    state.SetBytesProcessed(state.iterations() * SIZE * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_count_simd, u32);
+
+// 查找位于末尾的元素
+template<typename T>
+void BM_position_find(benchmark::State& state) {
+    auto v = make_values<T>();
+    v[SIZE - 1] = T(5000);
+    for (auto _ : state) {
+        auto iter = v.iter();
+        auto found = find(iter, [](const T& x) { return x == T(5000); });
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetBytesProcessed(state.iterations() * SIZE * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_position_find, u32);
+
+template<typename T>
+void BM_position_simd(benchmark::State& state) {
+    auto v = make_values<T>();
+    v[SIZE - 1] = T(5000);
+    for (auto _ : state) {
+        auto pos = v.iter() | position(T(5000));
+        benchmark::DoNotOptimize(pos);
+    }
+    state.SetBytesProcessed(state.iterations() * SIZE * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_position_simd, u32);
+
+BENCHMARK_MAIN();
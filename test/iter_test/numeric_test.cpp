@@ -0,0 +1,168 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#include <random>
+#include <mstl/mstl.h>
+
+#define BOOST_TEST_MODULE Numeric Terminal Test
+
+#include <boost/test/unit_test.hpp>
+
+using namespace mstl;
+using namespace mstl::iter;
+using namespace mstl::collection;
+
+static_assert(ContinuousIterator<VectorIter<const u32>>);
+static_assert(NumericIterator<ops::Range<i32>>);
+static_assert(!NumericIterator<VectorIter<bool>>);
+
+template<typename T>
+Vector<T> random_vector(usize n, int lo, int hi, u32 seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(lo, hi);
+    Vector<T> v;
+    for (usize i = 0; i < n; i++) {
+        v.push_back(T(dist(gen)));
+    }
+    return v;
+}
+
+// 以逐个处理的实现为基准, 检查某一指令集的实现
+template<typename T, typename Kernels>
+void check_kernels(Kernels kernels) {
+    for (usize n = 0; n < 300; n++) {
+        auto v = random_vector<T>(n, 0, 9, n);
+        const T* p = v.data();
+        BOOST_TEST_CHECK(kernels.sum(p, n) == simd::scalar::sum(p, n));
+        BOOST_TEST_CHECK(kernels.product(p, n) == simd::scalar::product(p, n));
+        BOOST_TEST_CHECK(kernels.count(p, n, T(3)) == simd::scalar::count(p, n, T(3)));
+        BOOST_TEST_CHECK(kernels.position(p, n, T(9)) == simd::scalar::position(p, n, T(9)));
+        if (n > 0) {
+            BOOST_TEST_CHECK(kernels.min(p, n) == simd::scalar::min(p, n));
+            BOOST_TEST_CHECK(kernels.max(p, n) == simd::scalar::max(p, n));
+        }
+    }
+
+    // 较大的元素位于末尾的剩余部分
+    auto v = random_vector<T>(77, 10, 20, 1);
+    v[76] = T(1);
+    v[75] = T(30);
+    BOOST_TEST_CHECK(kernels.min(v.data(), 77) == T(1));
+    BOOST_TEST_CHECK(kernels.max(v.data(), 77) == T(30));
+    BOOST_TEST_CHECK(kernels.position(v.data(), 77, T(1)) == 76);
+}
+
+template<typename Kernels>
+void check_all_types(Kernels kernels) {
+    check_kernels<i8>(kernels);
+    check_kernels<u8>(kernels);
+    check_kernels<i16>(kernels);
+    check_kernels<u16>(kernels);
+    check_kernels<i32>(kernels);
+    check_kernels<u32>(kernels);
+    check_kernels<i64>(kernels);
+    check_kernels<u64>(kernels);
+    check_kernels<float>(kernels);
+    check_kernels<double>(kernels);
+}
+
+// 将某一命名空间中的实现包装为类型, 以便传入check_all_types
+#define KERNELS(NAME, NS)                                                                           \
+    struct NAME {                                                                                   \
+        template<typename T> T sum(const T* p, usize n) { return NS::sum(p, n); }                   \
+        template<typename T> T product(const T* p, usize n) { return NS::product(p, n); }           \
+        template<typename T> T min(const T* p, usize n) { return NS::min(p, n); }                   \
+        template<typename T> T max(const T* p, usize n) { return NS::max(p, n); }                   \
+        template<typename T> usize count(const T* p, usize n, T v) { return NS::count(p, n, v); }   \
+        template<typename T> usize position(const T* p, usize n, T v) { return NS::position(p, n, v); } \
+    }
+
+KERNELS(Dispatched, simd);
+#if defined(MSTL_SIMD_X86)
+KERNELS(Avx2, simd::avx2);
+KERNELS(Sse42, simd::sse42);
+#endif
+
+BOOST_AUTO_TEST_CASE(KERNEL_TEST) {
+    check_all_types(Dispatched{});
+#if defined(MSTL_SIMD_X86)
+    if (__builtin_cpu_supports("avx2")) {
+        check_all_types(Avx2{});
+    }
+    if (__builtin_cpu_supports("sse4.2")) {
+        check_all_types(Sse42{});
+    }
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(CONTINUOUS_TEST) {
+    Vector<u32> v;
+    for (u32 i = 1; i <= 1000; i++) {
+        v.push_back(i);
+    }
+    BOOST_TEST_CHECK((v.iter() | sum()) == 500500u);
+    BOOST_TEST_CHECK((v.iter() | min()).unwrap() == 1u);
+    BOOST_TEST_CHECK((v.iter() | max()).unwrap() == 1000u);
+    BOOST_TEST_CHECK((v.iter() | count(7)) == 1);
+    BOOST_TEST_CHECK((v.iter() | position(500)).unwrap() == 499);
+    BOOST_CHECK((v.iter() | position(0)).is_none());
+
+    // 溢出时回绕
+    Vector<u8> bytes = { 200, 100 };
+    BOOST_TEST_CHECK((bytes.iter() | sum()) == u8(44));
+    Vector<i32> signs = { i32(0x7fffffff), 1 };
+    BOOST_TEST_CHECK((signs.iter() | sum()) == i32(0x80000000));
+
+    // 计数超过单个通道的范围
+    Vector<u8> ones;
+    ones.resize(100000, 1);
+    BOOST_TEST_CHECK((ones.iter() | count(1)) == 100000);
+    BOOST_TEST_CHECK((ones.iter() | sum()) == u8(100000 % 256));
+
+    Vector<float> f = { 1.5f, -2.0f, 4.0f, 0.5f };
+    BOOST_TEST_CHECK((f.iter() | sum()) == 4.0f);
+    BOOST_TEST_CHECK((f.iter() | product()) == -6.0f);
+    BOOST_TEST_CHECK((f.iter() | min()).unwrap() == -2.0f);
+
+    Array<i64, 5> arr = { 5, -3, 8, 8, 2 };
+    BOOST_TEST_CHECK((arr.iter() | max()).unwrap() == 8);
+    BOOST_TEST_CHECK((arr.iter() | position(8)).unwrap() == 2);
+    BOOST_TEST_CHECK((arr.iter() | count(8)) == 2);
+
+    // 从迭代器的当前位置开始
+    auto iter = v.iter();
+    iter.next();
+    iter.next();
+    BOOST_TEST_CHECK((iter | sum()) == 500497u);
+    BOOST_TEST_CHECK((iter | position(3)).unwrap() == 0);
+
+    Vector<u32> empty;
+    BOOST_CHECK((empty.iter() | min()).is_none());
+    BOOST_CHECK((empty.iter() | max()).is_none());
+    BOOST_TEST_CHECK((empty.iter() | sum()) == 0u);
+    BOOST_TEST_CHECK((empty.iter() | product()) == 1u);
+}
+
+BOOST_AUTO_TEST_CASE(GENERIC_TEST) {
+    BOOST_TEST_CHECK((ops::Range<i32>(1, 11) | sum()) == 55);
+    BOOST_TEST_CHECK((ops::Range<i32>(1, 6) | product()) == 120);
+    BOOST_TEST_CHECK((ops::Range<i32>(-4, 6) | min()).unwrap() == -4);
+    BOOST_TEST_CHECK((ops::Range<i32>(-4, 6) | max()).unwrap() == 5);
+    BOOST_TEST_CHECK((ops::Range<i32>(0, 10) | count(3)) == 1);
+    BOOST_TEST_CHECK((ops::Range<i32>(5, 10) | position(7)).unwrap() == 2);
+    BOOST_CHECK((ops::Range<i32>(5, 10) | position(70)).is_none());
+    BOOST_CHECK((ops::Range<i32>(0, 0) | min()).is_none());
+
+    Vector<u32> v = { 1, 2, 3, 4 };
+    auto doubled = v.iter() | map([](const u32& x) { return x * 2; });
+    BOOST_TEST_CHECK((doubled | sum()) == 20u);
+
+    BOOST_TEST_CHECK(combine(v.iter(), Sum{}) == 10u);
+    BOOST_TEST_CHECK(combine(v.iter(), Count{}, 3) == 1);
+    BOOST_TEST_CHECK(combine(v.iter(), Max{}).unwrap() == 4u);
+}
+
+BOOST_AUTO_TEST_CASE(CONSTEXPR_TEST) {
+    static_assert((ops::Range<i32>(1, 5) | sum()) == 10);
+}
@@ -0,0 +1,78 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#include <cmath>
+#include <benchmark/benchmark.h>
+#include <mstl/mstl.h>
+#include <mstl/iter/par/par.h>
+
+using namespace mstl;
+using namespace mstl::iter;
+using namespace mstl::collection;
+
+// 对4M个元素执行 map | fold, 每个元素的开销约为数十个周期.
+// BM_seq为顺序执行的对照组, BM_par以参数指定线程池的线程数, 观察随线程数的扩展性.
+
+constexpr usize SIZE = 1 << 22;
+
+Vector<double> make_values() {
+    Vector<double> v;
+    v.reserve(SIZE);
+    for (usize i = 0; i < SIZE; i++) {
+        v.push_back(double(i % 1000) * 0.001);
+    }
+    return v;
+}
+
+constexpr auto work = [](const double& x) { return std::sqrt(x) * std::log1p(x); };
+constexpr auto add = [](double acc, double x) { return acc + x; };
+
+void BM_seq(benchmark::State& state) {
+    auto v = make_values();
+    for (auto _ : state) {
+        double total = v.iter() | map(work) | fold(0.0, add);
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_seq)->Unit(benchmark::kMillisecond);
+
+void BM_par(benchmark::State& state) {
+    auto v = make_values();
+    thread::ThreadPool pool(state.range(0));
+    for (auto _ : state) {
+        double total = pool.install([&] {
+            return par::par_iter(v) | map(work) | par::fold(0.0, add);
+        });
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_par)->RangeMultiplier(2)->Range(1, 16)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// 每个元素的开销很小时, 划分与同步的开销所占的比例
+void BM_seq_cheap(benchmark::State& state) {
+    auto v = make_values();
+    for (auto _ : state) {
+        double total = v.iter() | fold(0.0, add);
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_seq_cheap)->Unit(benchmark::kMillisecond);
+
+void BM_par_cheap(benchmark::State& state) {
+    auto v = make_values();
+    thread::ThreadPool pool(state.range(0));
+    for (auto _ : state) {
+        double total = pool.install([&] {
+            return par::par_iter(v) | par::fold(0.0, add);
+        });
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+BENCHMARK(BM_par_cheap)->RangeMultiplier(2)->Range(1, 16)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_MAIN();
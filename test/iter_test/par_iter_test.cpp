@@ -0,0 +1,251 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <stdexcept>
+#include <mstl/mstl.h>
+#include <mstl/iter/par/par.h>
+
+#define BOOST_TEST_MODULE Parallel Iterator Test
+
+#include <boost/test/unit_test.hpp>
+
+using namespace mstl;
+using namespace mstl::iter;
+using namespace mstl::collection;
+
+static_assert(par::Producer<par::SliceProducer<i32>>);
+static_assert(par::Producer<par::RangeProducer<usize>>);
+
+Vector<u32> sequence(u32 n) {
+    Vector<u32> v;
+    for (u32 i = 0; i < n; i++) {
+        v.push_back(i);
+    }
+    return v;
+}
+
+BOOST_AUTO_TEST_CASE(FOLD_TEST) {
+    auto v = sequence(100000);
+    u64 total = par::par_iter(v) | par::fold(u64(0), [](u64 acc, u64 x) { return acc + x; });
+    BOOST_CHECK_EQUAL(total, 4999950000ull);
+
+    u64 squares = par::par_iter(v)
+        | map([](const u32& x) { return u64(x) * x; })
+        | par::fold(u64(0), [](u64 acc, u64 x) { return acc + x; });
+    u64 expected = v.iter() | fold(u64(0), [](u64 acc, const u32& x) { return acc + u64(x) * x; });
+    BOOST_CHECK_EQUAL(squares, expected);
+
+    // 累积与合并的类型不同
+    usize odd = par::par_iter(v) | par::fold(usize(0),
+        [](usize acc, const u32& x) { return acc + (x & 1); },
+        [](usize lhs, usize rhs) { return lhs + rhs; });
+    BOOST_CHECK_EQUAL(odd, 50000);
+
+    Vector<u32> empty;
+    BOOST_CHECK_EQUAL(par::par_iter(empty) | par::fold(u32(7), [](u32 acc, u32 x) { return acc + x; }), 7);
+}
+
+BOOST_AUTO_TEST_CASE(REDUCE_TEST) {
+    auto max = par::par_iter(ops::Range<i64>(0, 12345))
+        | map([](i64 x) { return (x * 7919) % 12345; })
+        | par::reduce([](i64 lhs, i64 rhs) { return lhs < rhs ? rhs : lhs; });
+    BOOST_CHECK_EQUAL(max.unwrap(), 12344);
+
+    auto none = par::par_iter(ops::Range<i64>(5, 5)) | par::reduce([](i64 lhs, i64 rhs) { return lhs + rhs; });
+    BOOST_CHECK(none.is_none());
+}
+
+BOOST_AUTO_TEST_CASE(FOR_EACH_TEST) {
+    auto v = sequence(50000);
+    std::atomic<u64> sum{0};
+    par::par_iter(v) | par::for_each([&](const u32& x) { sum.fetch_add(x, std::memory_order_relaxed); });
+    BOOST_CHECK_EQUAL(sum.load(), 1249975000ull);
+}
+
+/// 依赖元素位置的适配器作用于每个分块时结果与分块的方式有关, 不能用于并行迭代器
+template<typename Par, typename Holder>
+concept Pipeable = requires(Par par, Holder holder) { std::move(par) | std::move(holder); };
+
+using VecParIter = decltype(par::par_iter(std::declval<const Vector<u32>&>()));
+static_assert(Pipeable<VecParIter, decltype(map([](const u32& x) { return x; }))>);
+static_assert(Pipeable<VecParIter, decltype(filter([](const u32& x) { return x > 0; }))>);
+static_assert(!Pipeable<VecParIter, decltype(enumerate())>);
+static_assert(!Pipeable<VecParIter, decltype(skip(1))>);
+static_assert(!Pipeable<VecParIter, decltype(take(10))>);
+static_assert(!Pipeable<VecParIter, decltype(step_by(2))>);
+static_assert(!Pipeable<VecParIter, decltype(rev())>);
+
+template<typename P, typename Adapt>
+constexpr bool writes_in_place(const par::ParIter<P, Adapt>&) {
+    return par::_private::ElementWise<Adapt>::value;
+}
+
+BOOST_AUTO_TEST_CASE(COLLECT_TEST) {
+    auto v = sequence(100000);
+
+    // 仅有map: 直接写入最终位置
+    BOOST_CHECK(writes_in_place(par::par_iter(v) | map([](const u32& x) { return x * 2; })));
+    BOOST_CHECK(!writes_in_place(par::par_iter(v) | filter([](const u32& x) { return x > 0; })));
+    auto doubled = par::par_iter(v) | map([](const u32& x) { return x * 2; }) | par::collect<Vector<u32>>();
+    BOOST_REQUIRE_EQUAL(doubled.size(), v.size());
+    for (usize i = 0; i < v.size(); i++) {
+        BOOST_REQUIRE_EQUAL(doubled[i], v[i] * 2);
+    }
+
+    // 含有filter: 各分块分别收集后按顺序合并
+    auto multiples = par::par_iter(v)
+        | map([](const u32& x) { return x; })
+        | filter([](const u32& x) { return x % 3 == 0; })
+        | par::collect<Vector<u32>>();
+    BOOST_REQUIRE_EQUAL(multiples.size(), 33334);
+    for (usize i = 0; i < multiples.size(); i++) {
+        BOOST_REQUIRE_EQUAL(multiples[i], u32(i * 3));
+    }
+
+    // 元素不可平凡复制时同样按顺序合并
+    auto strings = par::par_iter(v).with_min_len(1000)
+        | filter([](const u32& x) { return x % 2 == 1; })
+        | map([](const u32& x) { return std::to_string(x); })
+        | par::collect<Vector<std::string>>();
+    BOOST_REQUIRE_EQUAL(strings.size(), 50000);
+    for (usize i = 0; i < strings.size(); i++) {
+        BOOST_REQUIRE_EQUAL(strings[i], std::to_string(2 * i + 1));
+    }
+}
+
+/// 记录存活的对象数量, 移动构造值为thrower的对象时抛出异常
+struct Tracked {
+    static inline std::atomic<i64> live{0};
+    static inline u32 thrower = u32(-1);
+
+    explicit Tracked(u32 value): value(value) { live++; }
+    Tracked(const Tracked& other): value(other.value) { live++; }
+    Tracked(Tracked&& other): value(other.value) {
+        if (value == thrower) {
+            throw std::runtime_error("Tracked");
+        }
+        live++;
+    }
+    ~Tracked() { live--; }
+
+    u32 value;
+};
+
+BOOST_AUTO_TEST_CASE(COLLECT_EXCEPTION_TEST) {
+    auto v = sequence(100000);
+    for (u32 thrower : {0u, 12345u, 77777u, 99999u}) {
+        Tracked::thrower = thrower;
+        BOOST_CHECK_THROW(par::par_iter(v).with_min_len(1000)
+            | map([](const u32& x) { return Tracked{ x }; })
+            | par::collect<Vector<Tracked>>(), std::runtime_error);
+        // 已在预留空间中构造的元素均被析构
+        BOOST_CHECK_EQUAL(Tracked::live.load(), 0);
+    }
+
+    Tracked::thrower = u32(-1);
+    {
+        auto tracked = par::par_iter(v) | map([](const u32& x) { return Tracked{ x }; }) | par::collect<Vector<Tracked>>();
+        BOOST_REQUIRE_EQUAL(tracked.size(), v.size());
+        BOOST_CHECK_EQUAL(tracked[54321].value, 54321);
+        BOOST_CHECK_EQUAL(Tracked::live.load(), i64(v.size()));
+    }
+    BOOST_CHECK_EQUAL(Tracked::live.load(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(SOURCE_TEST) {
+    Array<i32, 5> arr = {1, 2, 3, 4, 5};
+    BOOST_CHECK_EQUAL(par::par_iter(arr) | par::fold(0, [](i32 acc, i32 x) { return acc + x; }), 15);
+
+    auto v = sequence(1000);
+    auto slice = Slice<const u32>::from_raw(v.data() + 100, 100);
+    u32 total = par::par_iter(slice) | par::fold(u32(0), [](u32 acc, u32 x) { return acc + x; });
+    BOOST_CHECK_EQUAL(total, 14950);
+
+    usize count = par::par_iter(ops::Range<usize>(0, 1000)).with_min_len(64)
+        | filter([](const usize& x) { return x % 10 == 0; })
+        | par::fold(usize(0), [](usize acc, usize) { return acc + 1; }, [](usize lhs, usize rhs) { return lhs + rhs; });
+    BOOST_CHECK_EQUAL(count, 100);
+}
+
+BOOST_AUTO_TEST_CASE(POOL_TEST) {
+    auto v = sequence(100000);
+    for (usize threads : {1, 2, 4}) {
+        thread::ThreadPool pool(threads);
+        BOOST_CHECK_EQUAL(pool.num_threads(), threads);
+        u64 total = pool.install([&] {
+            BOOST_CHECK(&thread::ThreadPool::current() == &pool);
+            return par::par_iter(v) | par::fold(u64(0), [](u64 acc, u64 x) { return acc + x; });
+        });
+        BOOST_CHECK_EQUAL(total, 4999950000ull);
+    }
+}
+
+u64 fib(u64 n) {
+    if (n < 2) {
+        return n;
+    }
+    u64 a = 0, b = 0;
+    thread::join([&] { a = fib(n - 1); }, [&] { b = fib(n - 2); });
+    return a + b;
+}
+
+BOOST_AUTO_TEST_CASE(JOIN_TEST) {
+    thread::ThreadPool pool(4);
+    BOOST_CHECK_EQUAL(pool.install([] { return fib(20); }), 6765);
+
+    // 在线程池以外调用join
+    i32 a = 0, b = 0;
+    thread::join([&] { a = 1; }, [&] { b = 2; });
+    BOOST_CHECK_EQUAL(a + b, 3);
+
+    // 在并行迭代中嵌套并行迭代
+    u64 nested = pool.install([] {
+        return par::par_iter(ops::Range<u64>(0, 100))
+            | map([](u64 i) {
+                return par::par_iter(ops::Range<u64>(0, i)) | par::fold(u64(0), [](u64 acc, u64 x) { return acc + x; });
+            })
+            | par::fold(u64(0), [](u64 acc, u64 x) { return acc + x; });
+    });
+    BOOST_CHECK_EQUAL(nested, 161700);
+}
+
+BOOST_AUTO_TEST_CASE(EXCEPTION_TEST) {
+    thread::ThreadPool pool(4);
+    BOOST_CHECK_THROW(pool.install([]() -> i32 { throw std::runtime_error("install"); }), std::runtime_error);
+
+    // a抛出异常时, b位于join的栈帧中, 须在b完成后才传播异常
+    for (i32 i = 0; i < 100; i++) {
+        std::atomic<bool> started{false}, finished{false};
+        BOOST_CHECK_THROW(pool.install([&] {
+            thread::join(
+                [] {
+                    std::this_thread::yield();
+                    throw std::runtime_error("a");
+                },
+                [&] {
+                    started.store(true);
+                    std::this_thread::yield();
+                    finished.store(true);
+                });
+        }), std::runtime_error);
+        // b未被窃取时被丢弃; 若已被窃取, 则此时已经完成
+        BOOST_CHECK_EQUAL(started.load(), finished.load());
+    }
+
+    // b抛出的异常在join中重新抛出, 无论b是否被窃取
+    for (i32 i = 0; i < 100; i++) {
+        BOOST_CHECK_THROW(pool.install([] {
+            thread::join([] { std::this_thread::yield(); }, [] { throw std::logic_error("b"); });
+        }), std::logic_error);
+    }
+
+    // 异常不影响线程池之后的使用
+    auto v = sequence(1000);
+    BOOST_CHECK_EQUAL(pool.install([&] {
+        return par::par_iter(v) | par::fold(u64(0), [](u64 acc, u64 x) { return acc + x; });
+    }), 499500ull);
+}
@@ -0,0 +1,89 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <mstl/mstl.h>
+
+using namespace mstl;
+using namespace mstl::collection;
+using namespace mstl::memory::allocator;
+using namespace mstl::str::encoding;
+
+// 模拟请求处理: 把一行以逗号分隔的整数切分为临时的token并解析, 变换后格式化为字符串, 然后丢弃所有临时对象
+constexpr usize FIELDS = 256;
+constexpr usize REQUESTS = 1000;
+
+static std::string make_input() {
+    std::string line;
+    for (usize i = 0; i < FIELDS; i++) {
+        line += std::to_string(i * 7919 % 100003);
+        line += ',';
+    }
+    return line;
+}
+
+template<typename A>
+void handle(const std::string& line) {
+    Vector<i64, A> fields{A{}};
+    Vector<u8, A> token{A{}};
+    for (char c: line) {
+        if (c != ',') {
+            token.push_back(u8(c));
+            continue;
+        }
+        i64 value = 0;
+        for (u8 d: token) {
+            value = value * 10 + (d - '0');
+        }
+        fields.push_back(value);
+        token = Vector<u8, A>{A{}};
+    }
+
+    Vector<i64, A> squares{A{}};
+    squares.reserve(fields.size());
+    for (i64 v: fields) {
+        squares.push_back(v * v + 1);
+    }
+
+    str::BasicString<Ascii, A> out{A{}};
+    for (usize i = 0; i < squares.size(); i += 16) {
+        out.push_back(ValidBytes<1, Ascii>{{u8('0' + squares[i] % 10)}});
+    }
+    benchmark::DoNotOptimize(out);
+}
+
+// Arena变体在每个请求结束时回到请求开始时的位置; Allocator变体不需要回收
+template<typename A>
+struct Rewind {
+    explicit Rewind(MonotonicArena<>&) {}
+};
+
+template<>
+struct Rewind<ArenaAllocator<>> {
+    ArenaRewindScope<> scope;
+    explicit Rewind(MonotonicArena<>& arena): scope(arena) {}
+};
+
+template<typename A>
+void BM_parse_transform_discard(benchmark::State& state) {
+    std::string line = make_input();
+    MonotonicArena<> arena;
+    ArenaScope scope{arena};
+
+    for (auto _ : state) {
+        for (usize i = 0; i < REQUESTS; i++) {
+            Rewind<A> rewind{arena};
+            handle<A>(line);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * REQUESTS);
+    state.counters["arena_bytes"] = (double) arena.reserved();
+}
+BENCHMARK_TEMPLATE(BM_parse_transform_discard, Allocator);
+BENCHMARK_TEMPLATE(BM_parse_transform_discard, ArenaAllocator<>);
+
+BENCHMARK_MAIN();
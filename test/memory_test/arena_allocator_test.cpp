@@ -0,0 +1,159 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#include <string>
+#include <mstl/mstl.h>
+
+#define BOOST_TEST_MODULE Arena Allocator Test
+#include <boost/test/unit_test.hpp>
+
+using namespace mstl;
+using namespace mstl::memory;
+using namespace mstl::memory::allocator;
+using mstl::utility::to_string;
+
+BOOST_AUTO_TEST_CASE(ALIGN_TEST) {
+    MonotonicArena<> arena(256);
+    ArenaAllocator<> alloc{arena};
+
+    auto* c = (u8*)alloc.allocate(Layout::from_type<u8>(), 1);
+    auto* d = (u8*)alloc.allocate(Layout::from_size_align_unchecked(8, 64), 1);
+    BOOST_CHECK(c != nullptr);
+    BOOST_CHECK((usize)d % 64 == 0);
+
+    // 大于chunk的分配将使用单独的chunk
+    auto* big = (u8*)alloc.allocate(Layout::from_type<u64>(), 1024);
+    BOOST_CHECK((usize)big % alignof(u64) == 0);
+    BOOST_CHECK(arena.reserved() >= 1024 * sizeof(u64));
+}
+
+BOOST_AUTO_TEST_CASE(RESET_TEST) {
+    MonotonicArena<> arena(1024);
+    ArenaAllocator<> alloc{arena};
+
+    void* first = alloc.allocate(Layout::from_type<u64>(), 16);
+    for (usize i = 0; i < 100; i++) {
+        alloc.allocate(Layout::from_type<u64>(), 16);
+    }
+    usize reserved = arena.reserved();
+
+    arena.reset();
+    BOOST_CHECK(alloc.allocate(Layout::from_type<u64>(), 16) == first);
+    for (usize i = 0; i < 100; i++) {
+        alloc.allocate(Layout::from_type<u64>(), 16);
+    }
+    BOOST_CHECK(arena.reserved() == reserved);  // chunk被复用
+
+    arena.release();
+    BOOST_CHECK(arena.reserved() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(GROW_TEST) {
+    MonotonicArena<> arena(1024);
+    ArenaAllocator<> alloc{arena};
+
+    // 最近一次分配的空间将被原地扩展
+    auto* a = (u64*)alloc.allocate(Layout::from_type<u64>(), 4);
+    a[3] = 42;
+    BOOST_CHECK(alloc.grow(a, Layout::from_type<u64>(), 4, 16) == a);
+    BOOST_CHECK(alloc.shrink(a, Layout::from_type<u64>(), 16, 8) == a);
+    BOOST_CHECK(alloc.allocate(Layout::from_type<u64>(), 1) == a + 8);
+
+    // 否则, 复制到新的空间
+    auto* b = (u64*)alloc.grow(a, Layout::from_type<u64>(), 8, 16);
+    BOOST_CHECK(b != a);
+    BOOST_CHECK(b[3] == 42);
+
+    // 超过chunk剩余空间时, 同样复制到新的空间
+    auto* c = (u64*)alloc.grow(b, Layout::from_type<u64>(), 16, 1024);
+    BOOST_CHECK(c != b);
+    BOOST_CHECK(c[3] == 42);
+}
+
+BOOST_AUTO_TEST_CASE(CONTAINER_TEST) {
+    MonotonicArena<> arena;
+    {
+        ArenaScope scope{arena};
+
+        collection::Vector<std::string, ArenaAllocator<>> vec;
+        BOOST_CHECK(vec.get_allocator().get_arena() == &arena);
+        for (usize i = 0; i < 100; i++) {
+            vec.push_back(std::to_string(i));
+        }
+        BOOST_CHECK(vec.size() == 100);
+        BOOST_CHECK(vec[99] == "99");
+
+        collection::List<std::string, ArenaAllocator<>> ls = {"a", "b"};
+        ls.push_back("c");
+        BOOST_CHECK(to_string(ls) == "List [a, b, c]");
+    }
+    BOOST_CHECK(arena.reserved() > 0);
+    BOOST_CHECK(MonotonicArena<>::current() == nullptr);
+
+    // 未设置Arena时, 使用上游分配器
+    collection::Vector<int, ArenaAllocator<>> vec = {1, 2, 3};
+    BOOST_CHECK(vec.get_allocator().get_arena() == nullptr);
+    BOOST_CHECK(vec[2] == 3);
+
+    // 上游分配器可带有状态
+    NodePool<> pool;
+    {
+        using ToPool = ArenaAllocator<PoolAllocator<>>;
+        collection::Vector<u64, ToPool> to_pool{ToPool{PoolAllocator<>{pool}}};
+        to_pool.push_back(1);
+        BOOST_CHECK(to_pool.get_allocator().get_arena() == nullptr);
+        BOOST_CHECK(!(to_pool.get_allocator() == ToPool{}));
+    }
+    BOOST_CHECK(pool.reserved() > 0);
+}
+
+BOOST_AUTO_TEST_CASE(REWIND_TEST) {
+    MonotonicArena<> arena(1024);
+    ArenaAllocator<> alloc{arena};
+
+    // 尚未分配chunk时记录的位置
+    auto start = arena.mark();
+    void* first = alloc.allocate(Layout::from_type<u64>(), 4);
+
+    auto outer = arena.mark();
+    void* a = alloc.allocate(Layout::from_type<u64>(), 4);
+    {
+        ArenaRewindScope inner{arena};
+        for (usize i = 0; i < 100; i++) {
+            alloc.allocate(Layout::from_type<u64>(), 16);   // 跨越多个chunk
+        }
+    }
+    usize reserved = arena.reserved();
+    BOOST_CHECK(alloc.allocate(Layout::from_type<u64>(), 16) != nullptr);
+
+    arena.rewind(outer);
+    BOOST_CHECK(alloc.allocate(Layout::from_type<u64>(), 4) == a);
+    for (usize i = 0; i < 100; i++) {
+        alloc.allocate(Layout::from_type<u64>(), 16);
+    }
+    BOOST_CHECK(arena.reserved() == reserved);  // chunk被复用
+
+    arena.rewind(start);
+    BOOST_CHECK(alloc.allocate(Layout::from_type<u64>(), 4) == first);
+}
+
+BOOST_AUTO_TEST_CASE(REWIND_LOOP_TEST) {
+    MonotonicArena<> arena(4096);
+    ArenaScope scope{arena};
+
+    void* data = nullptr;
+    for (usize i = 0; i < 100; i++) {
+        ArenaRewindScope rewind{arena};
+        collection::Vector<u64, ArenaAllocator<>> vec{ArenaAllocator<>{}};
+        for (usize j = 0; j < 64; j++) {
+            vec.push_back(j);
+        }
+        BOOST_CHECK(vec[63] == 63);
+        if (data == nullptr) {
+            data = vec.data();
+        }
+        BOOST_CHECK(vec.data() == data);    // 每次迭代复用相同的空间
+    }
+    BOOST_CHECK(arena.reserved() == 4096);
+}
@@ -0,0 +1,79 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <vector>
+#include <string>
+#include <algorithm>
+
+#include <mstl/mstl.h>
+
+using namespace mstl;
+using namespace mstl::collection;
+using namespace mstl::memory::allocator;
+using namespace mstl::str::encoding;
+
+// 工作线程反复分配并释放若干种固定大小的Vector缓冲区
+constexpr usize SIZES[] = { 4, 16, 60, 250, 1000 };
+constexpr usize OPS = 10000;
+
+template<typename A>
+void work(std::vector<i64>& latencies) {
+    using Clock = std::chrono::steady_clock;
+
+    for (usize i = 0; i < OPS; i++) {
+        auto start = Clock::now();
+        {
+            Vector<u64, A> a(SIZES[i % std::size(SIZES)]);
+            Vector<u64, A> b(SIZES[(i * 7 + 3) % std::size(SIZES)]);
+            benchmark::DoNotOptimize(a.data());
+            benchmark::DoNotOptimize(b.data());
+        }
+        auto end = Clock::now();
+        latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    }
+}
+
+template<typename A>
+void BM_vector_churn(benchmark::State& state) {
+    std::vector<i64> latencies;
+    latencies.reserve(OPS * 64);
+
+    for (auto _ : state) {
+        if (latencies.size() + OPS > latencies.capacity()) {
+            latencies.clear();
+        }
+        work<A>(latencies);
+    }
+    state.SetItemsProcessed(state.iterations() * OPS);
+
+    // 尾延迟: 每个线程各自统计p50与p99, 报告各线程的平均值
+    std::sort(latencies.begin(), latencies.end());
+    state.counters["p50_ns"] = benchmark::Counter(
+            (double) latencies[latencies.size() / 2], benchmark::Counter::kAvgThreads);
+    state.counters["p99_ns"] = benchmark::Counter(
+            (double) latencies[latencies.size() * 99 / 100], benchmark::Counter::kAvgThreads);
+}
+BENCHMARK_TEMPLATE(BM_vector_churn, Allocator)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_vector_churn, CachingAllocator<>)->ThreadRange(1, 8)->UseRealTime();
+
+template<typename A>
+void BM_string_churn(benchmark::State& state) {
+    for (auto _ : state) {
+        for (usize i = 0; i < OPS; i++) {
+            str::BasicString<str::encoding::Ascii, A> s = "The quick brown fox"_ascii;
+            for (usize j = 0; j < i % 32; j++) {
+                s.push_back("!"_ascii);
+            }
+            benchmark::DoNotOptimize(s);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * OPS);
+}
+BENCHMARK_TEMPLATE(BM_string_churn, Allocator)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_string_churn, CachingAllocator<>)->ThreadRange(1, 8)->UseRealTime();
+
+BENCHMARK_MAIN();
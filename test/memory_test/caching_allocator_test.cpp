@@ -0,0 +1,74 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#include <string>
+#include <mstl/mstl.h>
+
+#define BOOST_TEST_MODULE Caching Allocator Test
+#include <boost/test/unit_test.hpp>
+
+using namespace mstl;
+using namespace mstl::memory;
+using namespace mstl::memory::allocator;
+using namespace mstl::str::encoding;
+
+using Caching = CachingAllocator<>;
+
+BOOST_AUTO_TEST_CASE(REUSE_TEST) {
+    Caching alloc;
+    Caching::flush();
+
+    void* a = alloc.allocate(Layout::from_type<u64>(), 100);
+    alloc.deallocate(a, Layout::from_type<u64>(), 100);
+    BOOST_CHECK(Caching::cached() == 1);
+
+    // 同一大小级别的请求复用缓存的空间
+    void* b = alloc.allocate(Layout::from_type<u32>(), 199);
+    BOOST_CHECK(a == b);
+    BOOST_CHECK(Caching::cached() == 0);
+    alloc.deallocate(b, Layout::from_type<u32>(), 199);
+
+    // 过大或对齐要求过高的请求不会被缓存
+    void* big = alloc.allocate(Layout::from_type<u8>(), Caching::MAX_CACHED_SIZE + 1);
+    alloc.deallocate(big, Layout::from_type<u8>(), Caching::MAX_CACHED_SIZE + 1);
+    void* aligned = alloc.allocate(Layout::from_size_align_unchecked(64, 64), 1);
+    BOOST_CHECK((usize)aligned % 64 == 0);
+    alloc.deallocate(aligned, Layout::from_size_align_unchecked(64, 64), 1);
+    BOOST_CHECK(Caching::cached() == 1);
+
+    Caching::flush();
+    BOOST_CHECK(Caching::cached() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(FLUSH_TEST) {
+    Caching alloc;
+    Caching::flush();
+
+    void* ptrs[Caching::BUCKET_LIMIT + 1];
+    for (auto& p: ptrs) {
+        p = alloc.allocate(Layout::from_type<u8>(), 1000);
+    }
+    for (auto& p: ptrs) {
+        alloc.deallocate(p, Layout::from_type<u8>(), 1000);
+    }
+    // 超过上限时, 一批空间被归还给被包装的分配器
+    BOOST_CHECK(Caching::cached() == Caching::BUCKET_LIMIT + 1 - Caching::FLUSH_BATCH);
+
+    Caching::flush();
+}
+
+BOOST_AUTO_TEST_CASE(CONTAINER_TEST) {
+    for (usize n = 1; n < 20000; n = n * 3 + 1) {
+        collection::Vector<u64, Caching> vec(n, n);
+        BOOST_CHECK(vec[n - 1] == n);
+    }
+
+    collection::List<std::string, Caching> ls = {"a", "b"};
+    ls.push_back("c");
+    BOOST_CHECK(utility::to_string(ls) == "List [a, b, c]");
+
+    str::BasicString<Ascii, Caching> s = "0123456789abcdefg"_ascii;
+    s.push_back("h"_ascii);
+    BOOST_CHECK(s.size() == 18);
+}
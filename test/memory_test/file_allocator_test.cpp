@@ -0,0 +1,110 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#include <cstdio>
+#include <string>
+#include <filesystem>
+#include <mstl/mstl.h>
+
+#define BOOST_TEST_MODULE File Allocator Test
+#include <boost/test/unit_test.hpp>
+
+using namespace mstl;
+using namespace mstl::memory;
+using namespace mstl::memory::allocator;
+using namespace mstl::collection;
+
+#ifdef MSTL_HAS_FILE_ALLOCATOR
+
+static std::string temp_path(const char* name) {
+    auto path = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove(path);
+    return path.string();
+}
+
+BOOST_AUTO_TEST_CASE(REOPEN_TEST) {
+    auto path = temp_path("mstl_file_allocator_reopen.bin");
+    constexpr usize N = 100000;
+
+    {
+        MappedFile file(path.c_str());
+        BOOST_REQUIRE(file.is_open());
+        BOOST_CHECK(file.data<u64>() == nullptr);
+
+        Vector<u64, FileAllocator> vec{FileAllocator{file}};
+        for (usize i = 0; i < N; i++) {
+            vec.push_back(i * i);
+        }
+        BOOST_CHECK(file.data<u64>() == &vec[0]);
+        BOOST_CHECK(file.sync(vec.size()));
+    }
+
+    BOOST_CHECK(std::filesystem::file_size(path) >= MappedFile::HEADER_SIZE + N * sizeof(u64));
+
+    {
+        MappedFile file(path.c_str());
+        BOOST_REQUIRE(file.is_open());
+        BOOST_CHECK(file.data<u32>() == nullptr);   // 元素大小不符
+        BOOST_REQUIRE(file.length<u64>() == N);
+
+        auto vec = Vector<u64, FileAllocator>::from_raw_parts(
+                file.data<u64>(), file.length<u64>(), file.capacity<u64>(), FileAllocator{file});
+        BOOST_REQUIRE(vec.size() == N);
+        for (usize i = 0; i < N; i++) {
+            BOOST_REQUIRE(vec[i] == i * i);
+        }
+
+        // 重新打开后继续增长
+        usize cap = vec.capacity();
+        for (usize i = 0; i <= cap; i++) {
+            vec.push_back(i);
+        }
+        BOOST_CHECK(vec[N - 1] == (N - 1) * (N - 1));
+        BOOST_CHECK(vec[N + cap] == cap);
+        BOOST_CHECK(file.sync(vec.size()));
+    }
+
+    {
+        MappedFile file(path.c_str());
+        BOOST_CHECK(file.length<u64>() > N);
+        BOOST_CHECK(file.data<u64>()[N - 1] == (N - 1) * (N - 1));
+    }
+
+    std::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(RESIZE_TEST) {
+    auto path = temp_path("mstl_file_allocator_resize.bin");
+    MappedFile file(path.c_str());
+    FileAllocator alloc{file};
+
+    auto block = alloc.allocate_at_least(Layout::from_type<u32>(), 10);
+    BOOST_REQUIRE(block.ptr != nullptr);
+    BOOST_CHECK(block.length >= 10);
+    BOOST_CHECK(block.length == file.capacity<u32>());
+
+    auto* p = (u32*)block.ptr;
+    p[9] = 9;
+    p = (u32*)alloc.grow(p, Layout::from_type<u32>(), block.length, 1 << 20);
+    BOOST_REQUIRE(p != nullptr);
+    BOOST_CHECK(p[9] == 9);
+    p[(1 << 20) - 1] = 1;
+
+    p = (u32*)alloc.shrink(p, Layout::from_type<u32>(), 1 << 20, 16);
+    BOOST_REQUIRE(p != nullptr);
+    BOOST_CHECK(p[9] == 9);
+    BOOST_CHECK(std::filesystem::file_size(path) < (1 << 20));
+
+    // 不属于该文件的空间
+    BOOST_CHECK(alloc.grow(p + 1, Layout::from_type<u32>(), 1, 2) == nullptr);
+    BOOST_CHECK(alloc.allocate(Layout::from_size_align_unchecked(128, 128), 1) == nullptr);
+
+    alloc.deallocate(p, Layout::from_type<u32>(), 16);
+    BOOST_CHECK(file.data<u32>() == nullptr);
+    BOOST_CHECK(FileAllocator{}.allocate(Layout::from_type<u32>(), 1) == nullptr);
+
+    std::filesystem::remove(path);
+}
+
+#endif
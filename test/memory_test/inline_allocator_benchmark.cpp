@@ -0,0 +1,79 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#include <benchmark/benchmark.h>
+
+#include <mstl/mstl.h>
+
+using namespace mstl;
+using namespace mstl::collection;
+using namespace mstl::memory::allocator;
+
+constexpr usize CAPACITY = 512;
+using Inline = InlineAllocator<CAPACITY>;
+
+// 在循环中反复创建短生命周期的容器. Inline变体在每次循环中使用栈上的InlineArena.
+template<typename A>
+struct Frame {};
+
+template<>
+struct Frame<Inline> {
+    InlineArena<CAPACITY> arena;
+    InlineScope<CAPACITY> scope{arena};
+};
+
+template<typename A>
+void BM_default_vector(benchmark::State& state) {
+    for (auto _ : state) {
+        [[maybe_unused]] Frame<A> frame;
+        Vector<i32, A> vec;
+        benchmark::DoNotOptimize(vec.data());
+    }
+}
+BENCHMARK_TEMPLATE(BM_default_vector, Allocator);
+BENCHMARK_TEMPLATE(BM_default_vector, Inline);
+
+template<typename A>
+void BM_short_vector(benchmark::State& state) {
+    for (auto _ : state) {
+        [[maybe_unused]] Frame<A> frame;
+        Vector<i32, A> vec;
+        for (i32 i = 0; i < 32; i++) {
+            vec.push_back(i);
+        }
+        benchmark::DoNotOptimize(vec.data());
+    }
+}
+BENCHMARK_TEMPLATE(BM_short_vector, Allocator);
+BENCHMARK_TEMPLATE(BM_short_vector, Inline);
+
+template<typename A>
+void BM_short_list(benchmark::State& state) {
+    for (auto _ : state) {
+        [[maybe_unused]] Frame<A> frame;
+        List<i32, A> ls;
+        for (i32 i = 0; i < 8; i++) {
+            ls.push_back(i);
+        }
+        benchmark::DoNotOptimize(ls.size());
+    }
+}
+BENCHMARK_TEMPLATE(BM_short_list, Allocator);
+BENCHMARK_TEMPLATE(BM_short_list, Inline);
+
+template<typename A>
+void BM_short_forward_list(benchmark::State& state) {
+    for (auto _ : state) {
+        [[maybe_unused]] Frame<A> frame;
+        ForwardList<i32, A> ls;
+        for (i32 i = 0; i < 8; i++) {
+            ls.push_front(i);
+        }
+        benchmark::DoNotOptimize(ls.size());
+    }
+}
+BENCHMARK_TEMPLATE(BM_short_forward_list, Allocator);
+BENCHMARK_TEMPLATE(BM_short_forward_list, Inline);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,83 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#include <string>
+#include <mstl/mstl.h>
+#include "../TrackingAllocator.h"
+
+#define BOOST_TEST_MODULE Inline Allocator Test
+#include <boost/test/unit_test.hpp>
+
+using namespace mstl;
+using namespace mstl::memory;
+using namespace mstl::memory::allocator;
+using mstl::utility::to_string;
+
+using Tracking = TrackingAllocator<>;
+template<usize N>
+using Inline = InlineAllocator<N, Tracking>;
+
+BOOST_AUTO_TEST_CASE(ARENA_TEST) {
+    InlineArena<64> arena;
+
+    auto* a = (u64*)arena.allocate(Layout::from_type<u64>(), 2);
+    BOOST_CHECK(arena.owns(a));
+    BOOST_CHECK(arena.used() == 16);
+
+    // 最近一次分配的空间可被原地扩展和回收
+    BOOST_CHECK(arena.resize(a, Layout::from_type<u64>(), 2, 4));
+    BOOST_CHECK(arena.used() == 32);
+    BOOST_CHECK(!arena.resize(a, Layout::from_type<u64>(), 4, 16));
+    arena.deallocate(a, Layout::from_type<u64>(), 4);
+    BOOST_CHECK(arena.used() == 0);
+
+    BOOST_CHECK(arena.allocate(Layout::from_type<u64>(), 9) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(ZERO_HEAP_TEST) {
+    usize count = Tracking::get_allocation_count();
+    {
+        InlineArena<512> arena;
+        InlineScope scope{arena};
+
+        collection::Vector<i32, Inline<512>> vec;
+        for (i32 i = 0; i < 64; i++) {
+            vec.push_back(i);
+        }
+        BOOST_CHECK(vec[63] == 63);
+
+        collection::List<i32, Inline<512>> ls = {1, 2, 3};
+        BOOST_CHECK(to_string(ls) == "List [1, 2, 3]");
+    }
+    BOOST_CHECK(Tracking::get_allocation_count() == count);
+    BOOST_CHECK(InlineArena<512>::current() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(FALLBACK_TEST) {
+    usize count = Tracking::get_allocation_count();
+    {
+        InlineArena<64> arena;
+        collection::Vector<std::string, Inline<64>> vec{Inline<64>{arena}};
+        for (usize i = 0; i < 100; i++) {
+            vec.push_back(std::to_string(i));
+        }
+        BOOST_CHECK(vec[99] == "99");
+    }
+    BOOST_CHECK(Tracking::get_allocation_count() > count);
+    BOOST_CHECK(Tracking::get_beholding_memory() == 0);
+
+    // 缓冲区不足时使用构造时给定的上游分配器, 而不是默认构造的上游分配器
+    MonotonicArena<> upstream;
+    {
+        using ToArena = InlineAllocator<64, ArenaAllocator<>>;
+        InlineArena<64> arena;
+        collection::Vector<u64, ToArena> vec{ToArena{arena, ArenaAllocator<>{upstream}}};
+        for (u64 i = 0; i < 100; i++) {
+            vec.push_back(i);
+        }
+        BOOST_CHECK(vec[99] == 99);
+        BOOST_CHECK(!arena.owns(vec.data()));
+    }
+    BOOST_CHECK(upstream.reserved() > 0);
+}
@@ -0,0 +1,60 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#include <benchmark/benchmark.h>
+
+#include <mstl/mstl.h>
+
+using namespace mstl;
+using namespace mstl::memory;
+using namespace mstl::memory::allocator;
+
+constexpr usize OPS = 10000;
+
+using Instrumented = InstrumentedAllocator<Allocator>;
+using InstrumentedSlab = InstrumentedAllocator<SlabAllocator<32>>;
+
+// 统计的开销: 与被包装的分配器对比每对分配/解分配的耗时
+template<typename A>
+void BM_pair(benchmark::State& state) {
+    A alloc;
+    constexpr Layout layout = Layout::from_size_align_unchecked(24, 8);
+    for (auto _ : state) {
+        for (usize i = 0; i < OPS; i++) {
+            void* p = alloc.allocate(layout, 1);
+            benchmark::DoNotOptimize(p);
+            alloc.deallocate(p, layout, 1);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * OPS);
+}
+BENCHMARK_TEMPLATE(BM_pair, Allocator)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_pair, Instrumented)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_pair, SlabAllocator<32>)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_pair, InstrumentedSlab)->ThreadRange(1, 8)->UseRealTime();
+
+void BM_pair_sampled(benchmark::State& state) {
+    Instrumented alloc;
+    constexpr Layout layout = Layout::from_size_align_unchecked(24, 8);
+    Instrumented::set_sample_interval(state.range(0));
+    for (auto _ : state) {
+        for (usize i = 0; i < OPS; i++) {
+            void* p = alloc.allocate(layout, 1);
+            benchmark::DoNotOptimize(p);
+            alloc.deallocate(p, layout, 1);
+        }
+    }
+    Instrumented::set_sample_interval(0);
+    state.SetItemsProcessed(state.iterations() * OPS);
+}
+BENCHMARK(BM_pair_sampled)->Arg(1024)->Arg(65536);
+
+void BM_snapshot(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Instrumented::snapshot());
+    }
+}
+BENCHMARK(BM_snapshot);
+
+BENCHMARK_MAIN();
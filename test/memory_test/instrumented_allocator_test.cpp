@@ -0,0 +1,100 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#include <thread>
+#include <vector>
+#include <mstl/mstl.h>
+
+#define BOOST_TEST_MODULE Instrumented Allocator Test
+#include <boost/test/unit_test.hpp>
+
+using namespace mstl;
+using namespace mstl::memory;
+using namespace mstl::memory::allocator;
+
+BOOST_AUTO_TEST_CASE(COUNTER_TEST) {
+    using Alloc = InstrumentedAllocator<Allocator, struct CounterTag>;
+    Alloc alloc;
+
+    void* a = alloc.allocate(Layout::from_type<u8>(), 100);
+    void* b = alloc.allocate(Layout::from_type<u64>(), 1000);
+    alloc.deallocate(a, Layout::from_type<u8>(), 100);
+
+    auto s = Alloc::snapshot();
+    BOOST_CHECK(s.allocations == 2);
+    BOOST_CHECK(s.deallocations == 1);
+    BOOST_CHECK(s.allocated_bytes == 8100);
+    BOOST_CHECK(s.freed_bytes == 100);
+    BOOST_CHECK(s.live_bytes == 8000);
+    BOOST_CHECK(s.peak_live_bytes >= 8000);
+    // 100 ∈ [64, 128), 8000 ∈ [4096, 8192)
+    BOOST_CHECK(s.histogram[7] == 1);
+    BOOST_CHECK(s.histogram[13] == 1);
+
+    alloc.deallocate(b, Layout::from_type<u64>(), 1000);
+    BOOST_CHECK(Alloc::snapshot().live_bytes == 0);
+}
+
+BOOST_AUTO_TEST_CASE(PEAK_TEST) {
+    using Alloc = InstrumentedAllocator<Allocator, struct PeakTag>;
+    Alloc alloc;
+
+    constexpr usize N = Alloc::PEAK_GRANULARITY * 4;
+    void* p = alloc.allocate(Layout::from_type<u8>(), N);
+    alloc.deallocate(p, Layout::from_type<u8>(), N);
+
+    auto s = Alloc::snapshot();
+    BOOST_CHECK(s.live_bytes == 0);
+    BOOST_CHECK(s.peak_live_bytes >= N);
+}
+
+BOOST_AUTO_TEST_CASE(CONCURRENT_TEST) {
+    using Alloc = InstrumentedAllocator<Allocator, struct ConcurrentTag>;
+    constexpr usize THREADS = 8;
+    constexpr usize N = 10000;
+
+    std::vector<std::thread> threads;
+    for (usize t = 0; t < THREADS; t++) {
+        threads.emplace_back([] {
+            collection::Vector<u64, Alloc> vec;
+            for (usize i = 0; i < N; i++) {
+                collection::Vector<u8, Alloc> tmp(16);
+                vec.push_back(i);
+            }
+        });
+    }
+    // 在分配的同时读取统计数据
+    for (usize i = 0; i < 100; i++) {
+        auto s = Alloc::snapshot();
+        BOOST_CHECK(s.allocated_bytes >= s.live_bytes);
+    }
+    for (auto& th: threads) {
+        th.join();
+    }
+
+    auto s = Alloc::snapshot();
+    BOOST_CHECK(s.live_bytes == 0);
+    BOOST_CHECK(s.allocations == s.deallocations);
+    BOOST_CHECK(s.histogram[5] >= THREADS * N);     // 16 ∈ [16, 32)
+}
+
+BOOST_AUTO_TEST_CASE(SAMPLE_TEST) {
+    using Alloc = InstrumentedAllocator<Allocator, struct SampleTag>;
+    Alloc alloc;
+    Alloc::set_sample_interval(10);
+
+    for (usize i = 0; i < 100; i++) {
+        void* p = alloc.allocate(Layout::from_type<u8>(), 24);
+        alloc.deallocate(p, Layout::from_type<u8>(), 24);
+    }
+    Alloc::set_sample_interval(0);
+
+    usize count = 0;
+    Alloc::for_each_sample([&count](const AllocationSample& sample) {
+        BOOST_CHECK(sample.bytes == 24);
+        BOOST_CHECK(sample.depth > 0);
+        count++;
+    });
+    BOOST_CHECK(count == 10);
+}
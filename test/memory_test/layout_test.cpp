@@ -0,0 +1,67 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#include <mstl/mstl.h>
+
+#define BOOST_TEST_MODULE Layout Test
+#include <boost/test/unit_test.hpp>
+
+using namespace mstl;
+using namespace mstl::memory;
+
+struct Header {
+    u64 len;
+    u8 tag;
+};
+
+BOOST_AUTO_TEST_CASE(ARRAY_TEST) {
+    auto layout = Layout::array<u32>(10).unwrap();
+    BOOST_CHECK_EQUAL(layout.size, 40);
+    BOOST_CHECK_EQUAL(layout.align, alignof(u32));
+
+    BOOST_CHECK(Layout::array<u64>(usize(-1) / 4).is_err());
+}
+
+BOOST_AUTO_TEST_CASE(PAD_TEST) {
+    auto layout = Layout::from_size_align_unchecked(9, 8);
+    BOOST_CHECK_EQUAL(layout.padding_needed_for(8), 7);
+    BOOST_CHECK_EQUAL(layout.padding_needed_for(1), 0);
+    BOOST_CHECK_EQUAL(layout.pad_to_align().size, 16);
+}
+
+BOOST_AUTO_TEST_CASE(REPEAT_TEST) {
+    auto res = Layout::from_size_align_unchecked(9, 8).repeat(3).unwrap();
+    BOOST_CHECK_EQUAL(res.second(), 16);
+    BOOST_CHECK_EQUAL(res.first().size, 48);
+    BOOST_CHECK_EQUAL(res.first().align, 8);
+}
+
+BOOST_AUTO_TEST_CASE(EXTEND_TEST) {
+    // [Header | u16 x 5 | u64]
+    auto r1 = Layout::from_type<Header>().extend(Layout::array<u16>(5).unwrap()).unwrap();
+    auto h = r1.first();
+    usize o1 = r1.second();
+    auto r2 = h.extend(Layout::from_type<u64>()).unwrap();
+    auto l = r2.first();
+    usize o2 = r2.second();
+    BOOST_CHECK_EQUAL(o1, sizeof(Header));
+    BOOST_CHECK_EQUAL(o2 % alignof(u64), 0);
+    BOOST_CHECK_EQUAL(o2, o1 + 16);
+    BOOST_CHECK_EQUAL(l.pad_to_align().size, o2 + sizeof(u64));
+
+    // 与编译器为等价结构体计算的布局一致
+    struct Equivalent {
+        Header h;
+        u16 a[5];
+        u64 x;
+    };
+    BOOST_CHECK(l.pad_to_align() == Layout::from_type<Equivalent>());
+    BOOST_CHECK_EQUAL(o2, offsetof(Equivalent, x));
+}
+
+BOOST_AUTO_TEST_CASE(CONSTEXPR_TEST) {
+    constexpr usize offset = Layout::from_type<u8>().extend(Layout::from_type<u32>()).unwrap().second();
+    static_assert(offset == 4);
+    BOOST_CHECK_EQUAL(offset, 4);
+}
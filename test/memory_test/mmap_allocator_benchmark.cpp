@@ -0,0 +1,67 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#include <benchmark/benchmark.h>
+
+#include <mstl/mstl.h>
+
+using namespace mstl;
+using namespace mstl::collection;
+using namespace mstl::memory::allocator;
+
+#ifdef MSTL_HAS_MMAP_ALLOCATOR
+
+constexpr usize LEN = usize(1) << 26;   // 512MiB
+
+// 首次访问: 构造时写入每个元素, 触发缺页中断
+template<typename Vec>
+void BM_first_touch(benchmark::State& state) {
+    for (auto _ : state) {
+        Vec vec(LEN, 1);
+        benchmark::DoNotOptimize(vec.data());
+    }
+    state.SetBytesProcessed(state.iterations() * LEN * sizeof(u64));
+}
+BENCHMARK_TEMPLATE(BM_first_touch, Vector<u64>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_first_touch, Vector<u64, MmapAllocator>)->Unit(benchmark::kMillisecond);
+
+// 随机访问: 以xorshift生成下标, 避免下标数组本身占用TLB
+template<typename Vec>
+void BM_random_access(benchmark::State& state) {
+    Vec vec(LEN, 1);
+    u64 x = 88172645463325252ull;
+    constexpr usize ACCESSES = 1 << 20;
+
+    for (auto _ : state) {
+        u64 sum = 0;
+        for (usize i = 0; i < ACCESSES; i++) {
+            x ^= x << 13;
+            x ^= x >> 7;
+            x ^= x << 17;
+            sum += vec[x & (LEN - 1)];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * ACCESSES);
+}
+BENCHMARK_TEMPLATE(BM_random_access, Vector<u64>);
+BENCHMARK_TEMPLATE(BM_random_access, Vector<u64, MmapAllocator>);
+
+// 增长: 逐个push_back, 大块空间以mremap扩展
+template<typename Vec>
+void BM_grow(benchmark::State& state) {
+    for (auto _ : state) {
+        Vec vec;
+        for (usize i = 0; i < LEN / 4; i++) {
+            vec.push_back(i);
+        }
+        benchmark::DoNotOptimize(vec.data());
+    }
+}
+BENCHMARK_TEMPLATE(BM_grow, Vector<u64>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_grow, Vector<u64, MmapAllocator>)->Unit(benchmark::kMillisecond);
+
+#endif
+
+BENCHMARK_MAIN();
@@ -0,0 +1,108 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#include <mstl/mstl.h>
+
+#define BOOST_TEST_MODULE Mmap Allocator Test
+#include <boost/test/unit_test.hpp>
+
+using namespace mstl;
+using namespace mstl::memory;
+using namespace mstl::memory::allocator;
+
+#ifdef MSTL_HAS_MMAP_ALLOCATOR
+
+BOOST_AUTO_TEST_CASE(MAP_TEST) {
+    MmapAllocator alloc;
+    constexpr usize N = MmapAllocator::THRESHOLD / sizeof(u64);
+
+    // 小于阈值的请求交给Allocator
+    auto* small = (u64*)alloc.allocate(Layout::from_type<u64>(), 16);
+    small[15] = 15;
+    alloc.deallocate(small, Layout::from_type<u64>(), 16);
+
+    auto block = alloc.allocate_at_least(Layout::from_type<u64>(), N + 1);
+    BOOST_CHECK((usize)block.ptr % MmapAllocator::HUGE_PAGE_SIZE == 0);
+    BOOST_CHECK(block.length == 2 * N);
+    auto* big = (u64*)block.ptr;
+    big[block.length - 1] = 42;
+    alloc.deallocate(big, Layout::from_type<u64>(), N + 1);
+}
+
+BOOST_AUTO_TEST_CASE(THRESHOLD_TEST) {
+    MmapAllocator alloc;
+    constexpr usize N = MmapAllocator::THRESHOLD - 7;
+
+    // 略小于阈值的请求由malloc分配, 其返回的长度不能达到阈值, 否则释放时会被当作映射的空间
+    auto block = alloc.allocate_at_least(Layout::from_type<u8>(), N);
+    BOOST_REQUIRE(block.ptr != nullptr);
+    BOOST_CHECK(block.length >= N);
+    BOOST_CHECK(block.length < MmapAllocator::THRESHOLD);
+    alloc.deallocate(block.ptr, Layout::from_type<u8>(), block.length);
+
+    auto grown = alloc.grow_at_least(alloc.allocate(Layout::from_type<u8>(), 16), Layout::from_type<u8>(), 16, N);
+    BOOST_REQUIRE(grown.ptr != nullptr);
+    BOOST_CHECK(grown.length >= N);
+    BOOST_CHECK(grown.length < MmapAllocator::THRESHOLD);
+    alloc.deallocate(grown.ptr, Layout::from_type<u8>(), grown.length);
+
+    for (i32 i = 0; i < 3; i++) {
+        collection::Vector<u8, MmapAllocator> vec{MmapAllocator{}};
+        vec.reserve(N);
+        BOOST_CHECK(vec.capacity() < MmapAllocator::THRESHOLD);
+        vec.push_back(1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(GROW_TEST) {
+    MmapAllocator alloc;
+    constexpr usize N = MmapAllocator::THRESHOLD / sizeof(u64);
+
+    // 跨越阈值时复制内容
+    auto* p = (u64*)alloc.allocate(Layout::from_type<u64>(), 1024);
+    for (usize i = 0; i < 1024; i++) {
+        p[i] = i;
+    }
+    p = (u64*)alloc.grow(p, Layout::from_type<u64>(), 1024, N);
+    BOOST_REQUIRE(p != nullptr);
+    BOOST_CHECK(p[1023] == 1023);
+
+    // 映射的空间使用mremap扩展和收缩
+    p[N - 1] = 7;
+    p = (u64*)alloc.grow(p, Layout::from_type<u64>(), N, 8 * N);
+    BOOST_REQUIRE(p != nullptr);
+    BOOST_CHECK(p[1023] == 1023);
+    BOOST_CHECK(p[N - 1] == 7);
+    p[8 * N - 1] = 8;
+
+    p = (u64*)alloc.shrink(p, Layout::from_type<u64>(), 8 * N, 2 * N);
+    BOOST_REQUIRE(p != nullptr);
+    BOOST_CHECK(p[N - 1] == 7);
+
+    p = (u64*)alloc.shrink(p, Layout::from_type<u64>(), 2 * N, 16);
+    BOOST_REQUIRE(p != nullptr);
+    BOOST_CHECK(p[15] == 15);
+    alloc.deallocate(p, Layout::from_type<u64>(), 16);
+}
+
+BOOST_AUTO_TEST_CASE(CONTAINER_TEST) {
+    collection::Vector<u64, MmapAllocator> vec;
+    for (usize i = 0; i < 1000000; i++) {
+        vec.push_back(i);
+    }
+    vec.reserve(4000000);
+    // 以mremap扩展后, 容量为映射的空间实际能容纳的元素数量
+    BOOST_CHECK(vec.capacity() * sizeof(u64) % MmapAllocator::HUGE_PAGE_SIZE == 0);
+    BOOST_CHECK(vec.size() == 1000000);
+    BOOST_CHECK(vec[999999] == 999999);
+    BOOST_CHECK((usize)vec.data() % MmapAllocator::HUGE_PAGE_SIZE == 0);
+}
+
+#else
+
+BOOST_AUTO_TEST_CASE(UNSUPPORTED) {
+    BOOST_TEST_MESSAGE("MmapAllocator is not available on this platform");
+}
+
+#endif
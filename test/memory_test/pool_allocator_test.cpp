@@ -0,0 +1,84 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#include <string>
+#include <mstl/mstl.h>
+
+#define BOOST_TEST_MODULE Pool Allocator Test
+#include <boost/test/unit_test.hpp>
+
+using namespace mstl;
+using namespace mstl::memory;
+using namespace mstl::memory::allocator;
+using mstl::utility::to_string;
+
+BOOST_AUTO_TEST_CASE(REUSE_TEST) {
+    NodePool<> pool(1024);
+    PoolAllocator<> alloc{pool};
+
+    auto* a = (u64*)alloc.allocate(Layout::from_type<u64>(), 3);
+    auto* b = (u64*)alloc.allocate(Layout::from_type<u64>(), 3);
+    BOOST_CHECK((usize)a % alignof(std::max_align_t) == 0);
+    BOOST_CHECK((usize)b % alignof(std::max_align_t) == 0);
+    BOOST_CHECK(a != b);
+
+    // 被解分配的slot将被同一大小级别的分配复用
+    alloc.deallocate(a, Layout::from_type<u64>(), 3);
+    BOOST_CHECK(alloc.allocate(Layout::from_size_align_unchecked(20, 4), 1) == a);
+
+    usize reserved = pool.reserved();
+    for (usize i = 0; i < 1000; i++) {
+        void* p = alloc.allocate(Layout::from_type<u64>(), 4);
+        alloc.deallocate(p, Layout::from_type<u64>(), 4);
+    }
+    BOOST_CHECK(pool.reserved() == reserved);
+
+    // 过大的请求交给上游分配器
+    auto* big = (u8*)alloc.allocate(Layout::from_type<u8>(), 4096);
+    BOOST_CHECK(big != nullptr);
+    BOOST_CHECK(pool.reserved() == reserved);
+    alloc.deallocate(big, Layout::from_type<u8>(), 4096);
+
+    pool.release();
+    BOOST_CHECK(pool.reserved() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(CONTAINER_TEST) {
+    NodePool<> pool;
+    {
+        collection::List<std::string, PoolAllocator<>> ls(PoolAllocator<>{pool});
+        BOOST_CHECK(ls.get_allocator().get_pool() == &pool);
+        for (usize i = 0; i < 1000; i++) {
+            ls.push_back(std::to_string(i));
+        }
+        usize reserved = pool.reserved();
+        for (usize i = 0; i < 1000; i++) {
+            ls.pop_front();
+            ls.push_back(std::to_string(i));
+        }
+        BOOST_CHECK(pool.reserved() == reserved);
+        BOOST_CHECK(ls.size() == 1000);
+
+        collection::ForwardList<int, PoolAllocator<>> fl({3, 1, 2}, PoolAllocator<>{pool});
+        fl.sort();
+        BOOST_CHECK(to_string(fl) == "ForwardList [1, 2, 3]");
+    }
+    BOOST_CHECK(pool.reserved() > 0);
+
+    // 未引用节点池时, 使用上游分配器
+    collection::List<int, PoolAllocator<>> ls = {1, 2, 3};
+    BOOST_CHECK(ls.get_allocator().get_pool() == nullptr);
+    BOOST_CHECK(to_string(ls) == "List [1, 2, 3]");
+
+    // 上游分配器可带有状态
+    MonotonicArena<> upstream;
+    {
+        using ToArena = PoolAllocator<ArenaAllocator<>>;
+        collection::List<int, ToArena> to_arena(ToArena{ArenaAllocator<>{upstream}});
+        to_arena.push_back(1);
+        BOOST_CHECK(to_arena.get_allocator() == ToArena{ArenaAllocator<>{upstream}});
+        BOOST_CHECK(!(to_arena.get_allocator() == ToArena{}));
+    }
+    BOOST_CHECK(upstream.reserved() > 0);
+}
@@ -0,0 +1,77 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#include <benchmark/benchmark.h>
+
+#include <mstl/mstl.h>
+
+using namespace mstl;
+using namespace mstl::collection;
+using namespace mstl::memory;
+using namespace mstl::memory::allocator;
+
+using Slab = SlabAllocator<32>;
+
+constexpr usize OPS = 10000;
+constexpr usize BURST = 256;
+
+// 每个线程反复分配并立即释放一个节点大小的空间
+template<typename A>
+void BM_pair(benchmark::State& state) {
+    A alloc;
+    constexpr Layout layout = Layout::from_size_align_unchecked(24, 8);
+    for (auto _ : state) {
+        for (usize i = 0; i < OPS; i++) {
+            void* p = alloc.allocate(layout, 1);
+            benchmark::DoNotOptimize(p);
+            alloc.deallocate(p, layout, 1);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * OPS);
+}
+BENCHMARK_TEMPLATE(BM_pair, Allocator)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_pair, CachingAllocator<>)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_pair, Slab)->ThreadRange(1, 32)->UseRealTime();
+
+// 每个线程先连续分配BURST个节点再全部释放, 使slot在线程的弹匣与全局仓库之间流动
+template<typename A>
+void BM_burst(benchmark::State& state) {
+    A alloc;
+    constexpr Layout layout = Layout::from_size_align_unchecked(24, 8);
+    void* ptrs[BURST];
+    for (auto _ : state) {
+        for (usize i = 0; i < OPS / BURST; i++) {
+            for (auto& p: ptrs) {
+                p = alloc.allocate(layout, 1);
+            }
+            benchmark::DoNotOptimize(ptrs);
+            for (auto& p: ptrs) {
+                alloc.deallocate(p, layout, 1);
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * (OPS / BURST) * BURST);
+}
+BENCHMARK_TEMPLATE(BM_burst, Allocator)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_burst, CachingAllocator<>)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_burst, Slab)->ThreadRange(1, 32)->UseRealTime();
+
+template<typename A>
+void BM_forward_list(benchmark::State& state) {
+    for (auto _ : state) {
+        ForwardList<u64, A> ls;
+        for (usize i = 0; i < OPS; i++) {
+            ls.push_front(i);
+            if (i % 2 == 0) {
+                ls.pop_front();
+            }
+        }
+        benchmark::DoNotOptimize(ls);
+    }
+    state.SetItemsProcessed(state.iterations() * OPS);
+}
+BENCHMARK_TEMPLATE(BM_forward_list, Allocator)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_forward_list, Slab)->ThreadRange(1, 32)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,107 @@
+//
+// Created by Shiroan on 2026/10/16.
+//
+
+#include <thread>
+#include <vector>
+#include <mstl/mstl.h>
+
+#define BOOST_TEST_MODULE Slab Allocator Test
+#include <boost/test/unit_test.hpp>
+
+using namespace mstl;
+using namespace mstl::memory;
+using namespace mstl::memory::allocator;
+
+using Slab = SlabAllocator<32>;
+
+BOOST_AUTO_TEST_CASE(REUSE_TEST) {
+    Slab alloc;
+
+    void* a = alloc.allocate(Layout::from_type<u64>(), 4);
+    BOOST_CHECK((usize)a % Slab::SLOT_ALIGN == 0);
+    usize cached = Slab::cached();
+    alloc.deallocate(a, Layout::from_type<u64>(), 4);
+    BOOST_CHECK(Slab::cached() == cached + 1);
+
+    // 最近释放的slot最先被复用
+    void* b = alloc.allocate(Layout::from_type<u8>(), 1);
+    BOOST_CHECK(a == b);
+    alloc.deallocate(b, Layout::from_type<u8>(), 1);
+
+    // 过大或对齐要求过高的请求交给上游分配器
+    void* big = alloc.allocate(Layout::from_type<u8>(), Slab::SLOT_SIZE + 1);
+    alloc.deallocate(big, Layout::from_type<u8>(), Slab::SLOT_SIZE + 1);
+    void* aligned = alloc.allocate(Layout::from_size_align_unchecked(32, 64), 1);
+    BOOST_CHECK((usize)aligned % 64 == 0);
+    alloc.deallocate(aligned, Layout::from_size_align_unchecked(32, 64), 1);
+}
+
+BOOST_AUTO_TEST_CASE(MAGAZINE_TEST) {
+    Slab alloc;
+    constexpr usize N = Slab::BATCH * 5;
+
+    std::vector<void*> ptrs;
+    for (usize i = 0; i < N; i++) {
+        ptrs.push_back(alloc.allocate(Layout::from_type<u64>(), 1));
+    }
+    usize reserved = Slab::reserved();
+    for (void* p: ptrs) {
+        alloc.deallocate(p, Layout::from_type<u64>(), 1);
+    }
+    // 每个线程至多缓存两个弹匣, 其余slot被归还给仓库
+    BOOST_CHECK(Slab::cached() <= 2 * Slab::BATCH);
+
+    for (auto& p: ptrs) {
+        p = alloc.allocate(Layout::from_type<u64>(), 1);
+    }
+    BOOST_CHECK(Slab::reserved() == reserved);
+    for (void* p: ptrs) {
+        alloc.deallocate(p, Layout::from_type<u64>(), 1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(CONCURRENT_TEST) {
+    constexpr usize THREADS = 8;
+    constexpr usize N = 20000;
+
+    // 每个线程构建自己的链表, 并在另一个线程中销毁它
+    std::vector<collection::ForwardList<u64, Slab>> lists(THREADS);
+    std::vector<std::thread> threads;
+    for (usize t = 0; t < THREADS; t++) {
+        threads.emplace_back([&lists, t] {
+            for (usize i = 0; i < N; i++) {
+                lists[t].push_front(i);
+                if (i % 3 == 0) {
+                    lists[t].pop_front();
+                }
+            }
+        });
+    }
+    for (auto& th: threads) {
+        th.join();
+    }
+    threads.clear();
+
+    // Boost.Test的断言不是线程安全的, 在主线程中检查结果
+    std::vector<u8> ok(THREADS, 1);
+    for (usize t = 0; t < THREADS; t++) {
+        threads.emplace_back([&lists, &ok, t] {
+            auto ls = std::move(lists[(t + 1) % THREADS]);
+            u64 expected = N - 1;
+            for (auto& x: ls) {
+                if (expected % 3 == 0) {
+                    expected--;
+                }
+                ok[t] &= x == expected;
+                expected--;
+            }
+        });
+    }
+    for (auto& th: threads) {
+        th.join();
+    }
+    for (u8 o: ok) {
+        BOOST_CHECK(o);
+    }
+}